@@ -26,6 +26,7 @@
 #include "gt_datamodel.h"
 #include "gt_refusedpluginsdialog.h"
 #include "gt_mdilauncher.h"
+#include "internal/gt_startupprofiler.h"
 
 #include "gt_mementoviewer.h"
 #include "gt_templateviewer.h"
@@ -73,6 +74,9 @@ registerWidgets()
 int
 main(int argc, char* argv[])
 {
+    // all startup phases are measured relative to this point
+    gt::detail::StartupProfiler::instance();
+
     constexpr int delay = 100;
 
     QCoreApplication::setAttribute(Qt::AA_ShareOpenGLContexts);
@@ -217,6 +221,9 @@ main(int argc, char* argv[])
                                  qApp);
 #endif
 
+    auto mainWinPhase =
+            gt::detail::startupPhase(QStringLiteral("create main window"));
+
     GtMainWin w;
 
     splash.processEvents();
@@ -228,5 +235,7 @@ main(int argc, char* argv[])
 
     splash.finish(&w);
 
+    mainWinPhase.end();
+
     return a.exec();
 }
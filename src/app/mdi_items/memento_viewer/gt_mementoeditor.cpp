@@ -33,12 +33,11 @@ GtMementoEditor::dropEvent(QDropEvent* event)
         return;
     }
 
-    const QString droppedContent = event->mimeData()->data("GtObject");
-
     if (!content.isEmpty())
     {
         GtObjectMemento contentM(content.toUtf8());
-        GtObjectMemento droppedM(droppedContent.toUtf8());
+        // object data may be binary
+        GtObjectMemento droppedM(event->mimeData()->data("GtObject"));
 
         if (!contentM.isNull() && !droppedM.isNull())
         {
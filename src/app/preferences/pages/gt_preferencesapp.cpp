@@ -154,10 +154,22 @@ GtPreferencesApp::GtPreferencesApp() :
     m_autostartProcessExecutor =
             new QCheckBox(tr("Autostart Process Runner on task execution"));
 
+    m_processRunnerPoolSpin = new QSpinBox;
+    m_processRunnerPoolSpin->setRange(0, 8);
+    m_processRunnerPoolSpin->setToolTip(
+                tr("Number of autostarted Process Runners, which are kept "
+                   "running in the background to execute the next tasks "
+                   "without startup delay"));
+
+    QFormLayout* processRunnerFormLay = new QFormLayout;
+    processRunnerFormLay->addRow(tr("Warm Process Runners:"),
+                                 m_processRunnerPoolSpin);
+
     QVBoxLayout* processRunnerLayout = new QVBoxLayout(processRunnerPage);
 
     processRunnerLayout->addWidget(m_useExtendedProcessExecutor);
     processRunnerLayout->addWidget(m_autostartProcessExecutor);
+    processRunnerLayout->addLayout(processRunnerFormLay);
 
     processRunnerLayout->addStretch(1);
 
@@ -175,6 +187,7 @@ GtPreferencesApp::GtPreferencesApp() :
                 settings->useExtendedProcessExecutor());
     m_autostartProcessExecutor->setChecked(
                 settings->autostartProcessRunner());
+    m_processRunnerPoolSpin->setValue(settings->processRunnerPoolSize());
 
     // log length
     m_maxLogSpin->setValue(settings->maxLogLength());
@@ -216,6 +229,7 @@ GtPreferencesApp::saveSettings(GtSettings& settings) const
                 m_useExtendedProcessExecutor->isChecked());
     settings.setAutostartProcessRunner(
                 m_autostartProcessExecutor->isChecked());
+    settings.setProcessRunnerPoolSize(m_processRunnerPoolSpin->value());
 
     // theme selection
     int index = m_themeSelection->currentIndex();
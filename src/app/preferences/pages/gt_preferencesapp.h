@@ -56,6 +56,9 @@ private:
     /// Checkbox to autostart process runner
     QCheckBox* m_autostartProcessExecutor;
 
+    /// Number of process runners kept running
+    QSpinBox* m_processRunnerPoolSpin;
+
     /// Max. logging length spin box
     QSpinBox* m_maxLogSpin;
 
@@ -35,6 +35,7 @@
 #include "gt_hostinfo.h"
 #include "gt_remoteprocessrunner.h"
 #include "settings/gt_settings.h"
+#include "internal/gt_startupprofiler.h"
 
 int list(const QStringList&);
 
@@ -167,6 +168,15 @@ processRunner(QStringList const& args)
     p.addOption("timeout", {"timeout", "t"},
                 "Timeout in seconds to wait for the initial connection "
                 "(default value is "  + QString::number(timeout) + "s).");
+    p.addOption("persistent", {"persistent"},
+                "Accepts successive sessions instead of exiting once the "
+                "task has been collected. The runner exits once no new "
+                "session was started within the timeout.");
+    p.addOption("sessions", {"sessions", "s"},
+                "Maximum number of sessions served concurrently (default "
+                "value is 1). Using more than one session implies "
+                "--persistent. The tasks of all sessions are executed in "
+                "parallel, as long as they belong to the same project.");
 
     // args are optional
     p.parse(args);
@@ -221,6 +231,22 @@ processRunner(QStringList const& args)
         }
     }
 
+    // update max sessions
+    int sessions = 1;
+    if (p.option("sessions"))
+    {
+        bool ok = true;
+        sessions = p.optionValue("sessions").toInt(&ok);
+
+        if (!ok || sessions < 1)
+        {
+            std::cout << "Invalid number of sessions specified! "
+                         "Set sessions using --sessions=<count>"
+                      << std::endl;
+            return -1;
+        }
+    }
+
     // resolve client address name into an ip-address
     std::cout << "Resolving client address '" << address.toStdString()
               << "'..." << std::endl;
@@ -234,6 +260,8 @@ processRunner(QStringList const& args)
     }
 
     GtRemoteProcessRunner runner;
+    runner.setPersistent(p.option("persistent"));
+    runner.setMaxSessions(sessions);
 
     return runner.exec(client, port, timeout * 1000);
 }
@@ -818,6 +846,8 @@ initModuleTest(QStringList const& arguments, GtCoreApplication& app)
 
 int main(int argc, char* argv[])
 {
+    // all startup phases are measured relative to this point
+    gt::detail::StartupProfiler::instance();
 
     QApplication a(argc, argv);
 
@@ -919,6 +949,9 @@ int main(int argc, char* argv[])
     // initialize modules
     app.initModules();
 
+    // the startup of the application is complete
+    gt::detail::StartupProfiler::instance().finish();
+
     QStringList commands =
             GtCommandLineFunctionHandler::instance().getRegisteredFunctionIDs();
 
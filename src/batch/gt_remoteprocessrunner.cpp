@@ -20,91 +20,70 @@
 
 #include "gt_coreapplication.h"
 #include "gt_eventloop.h"
+#include "gt_externalizationmanager.h"
 #include "gt_task.h"
 #include "gt_utilities.h"
 #include "gt_coreprocessexecutor.h"
 #include "gt_processrunnercommand.h"
-#include "gt_remoteprocessrunnerstates.h"
+#include "gt_remoteprocessrunnersession.h"
 
+#include <QDir>
 #include <QLockFile>
 #include <QStandardPaths>
 
-static int S_SENDING_TIMEOUT = 3 * 1000;
-
-static uint S_MAX_RETRIES = 3;
-
-namespace
-{
-
-/**
- * @brief Helper function to send data. If writing fails retry x more times
- * @param connection COnnection strategy
- * @param data Data to write
- * @return Success
- */
-template <typename Data>
-inline GtEventLoop::State
-sendData(GtProcessRunnerConnectionStrategy& connection, Data const& data)
+GtRemoteProcessRunner::GtRemoteProcessRunner()
 {
-    uint retries = 0;
-
-    do {
-        GtEventLoop loop{S_SENDING_TIMEOUT};
-
-        connection.writeData(loop, data);
-
-        if (loop.exec() == GtEventLoop::Success)
-        {
-            return GtEventLoop::Success;
-        }
-
-        // sending failed
-        retries += 1;
-
-        gtWarningId(GT_EXEC_ID) << QObject::tr("Failed to send data! (%1/%2)")
-                              .arg(retries)
-                              .arg(S_MAX_RETRIES);
+    setObjectName("RemoteProcessRunner");
 
-        // connection may have been lost
-        if (!connection.hasConnection())
-        {
-            gtDebugId(GT_EXEC_ID) << QObject::tr("No connection!");
-            return GtEventLoop::Aborted;
-        }
-    }
-    while(retries < S_MAX_RETRIES);
+    m_idleTimer.setSingleShot(true);
 
-    return (retries < S_MAX_RETRIES) ? GtEventLoop::Success :
-                                       GtEventLoop::Failed;
+    connect(&m_idleTimer, &QTimer::timeout,
+            this, &GtRemoteProcessRunner::onIdleTimeout);
 }
 
-} // namespace
+GtRemoteProcessRunner::~GtRemoteProcessRunner() = default;
 
+void
+GtRemoteProcessRunner::setPersistent(bool persistent)
+{
+    m_persistent = persistent;
+}
 
-GtRemoteProcessRunner::GtRemoteProcessRunner() :
-    m_connection{new GtProcessRunnerTcpConnection{this}}
+bool
+GtRemoteProcessRunner::isPersistent() const
 {
-    setObjectName("RemoteProcessRunner");
+    return m_persistent;
+}
 
-    setNextState(gt::process_runner::UninitializedState);
+void
+GtRemoteProcessRunner::setMaxSessions(int count)
+{
+    m_maxSessions = std::max(1, count);
+}
 
-    // setup connections
-    connect(m_connection.data(), &ConnectionStrategy::disconnected,
-            this, &GtRemoteProcessRunner::onDisconnected,
-            Qt::QueuedConnection);
+int
+GtRemoteProcessRunner::maxSessions() const
+{
+    return m_maxSessions;
+}
 
-    connect(m_connection.data(), &ConnectionStrategy::recievedCommand,
-            this, &GtRemoteProcessRunner::onCommandRecieved,
-            Qt::QueuedConnection);
+bool
+GtRemoteProcessRunner::keepAlive() const
+{
+    return m_persistent || m_maxSessions > 1;
 }
 
-void
-GtRemoteProcessRunner::setNextState(gt::process_runner::State state)
+GtRemoteProcessRunnerSession*
+GtRemoteProcessRunner::findSession(QString const& sessionId) const
 {
-    m_state = gt::process_runner::makeState(state, m_metaData, *this);
+    if (sessionId.isEmpty()) return nullptr;
+
+    auto iter = std::find_if(m_sessions.cbegin(), m_sessions.cend(),
+                             [&sessionId](QPointer<Session> const& session) {
+        return session && session->sessionId() == sessionId;
+    });
 
-    connect(m_state.data(), &GtAbstractProcessRunnerState::stateFinished,
-            this, &GtRemoteProcessRunner::onStateFinished);
+    return iter != m_sessions.cend() ? iter->data() : nullptr;
 }
 
 void
@@ -114,7 +93,12 @@ GtRemoteProcessRunner::exit(ExitCode code)
 
     m_exitCode = code;
 
-    m_connection->close();
+    m_idleTimer.stop();
+
+    for (auto const& connection : qAsConst(m_connections))
+    {
+        if (connection) connection->close();
+    }
 
     if (m_eventLoop)
     {
@@ -123,99 +107,197 @@ GtRemoteProcessRunner::exit(ExitCode code)
 }
 
 void
-GtRemoteProcessRunner::onDisconnected()
+GtRemoteProcessRunner::abortSession(Session& session)
 {
-    gtInfoId(GT_EXEC_ID) << "Connection closed!";
+    bool initialized = m_sessions.contains(&session);
+
+    // a single session runner is terminated
+    if (m_maxSessions <= 1 && (initialized || m_sessions.isEmpty()))
+    {
+        return exit(AbortExit);
+    }
 
-    exit(Disconnected);
+    // nothing to abort
+    if (!initialized) return;
+
+    gtInfoId(GT_EXEC_ID) << tr("Aborting session %1...")
+                                .arg(session.sessionId());
+
+    closeSession(session);
 }
 
-void
-GtRemoteProcessRunner::onStateFinished()
+bool
+GtRemoteProcessRunner::reserveProjectDir(Session const& session,
+                                         QString const& projectDir)
 {
-    gtDebugId(GT_EXEC_ID) << "On State Changed!" << m_state;
-    assert(m_state);
+    QString dir = QDir::cleanPath(projectDir);
 
-    auto oldState = m_state;
+    for (auto iter = m_projectDirs.cbegin(); iter != m_projectDirs.cend();
+         ++iter)
+    {
+        if (iter.key() != &session && iter.value() != dir)
+        {
+            gtWarningId(GT_EXEC_ID)
+                    << tr("Project directory is in use by session %1!")
+                           .arg(iter.key()->sessionId())
+                    << gt::brackets(iter.value());
+            return false;
+        }
+    }
+
+    m_projectDirs.insert(&session, dir);
 
-    setNextState(m_state->nextState());
+    gtExternalizationManager->setProjectDir(projectDir);
+
+    return true;
+}
 
-    oldState->deleteLater();
+void
+GtRemoteProcessRunner::releaseProjectDir(Session const& session)
+{
+    m_projectDirs.remove(&session);
 }
 
 void
-GtRemoteProcessRunner::onTaskFinished()
+GtRemoteProcessRunner::closeSession(Session& session)
 {
-    gtInfoId(GT_EXEC_ID) << "Task finished!";
+    // session is no longer addressable
+    m_sessions.removeAll(&session);
 
-    // advance to next state
-    onStateFinished();
+    connect(&session, &Session::closed,
+            &session, &QObject::deleteLater,
+            Qt::UniqueConnection);
 
-    assert(m_metaData.task);
+    session.close();
 
-    // check success state of task
-    bool success =
-            m_metaData.task->currentState() == GtProcessComponent::FINISHED ||
-            m_metaData.task->currentState() == GtProcessComponent::WARN_FINISHED;
+    updateIdleTimer();
+}
 
-    // task doesnt need to be collected
-    if (!success)
+void
+GtRemoteProcessRunner::onNewConnection()
+{
+    while (m_server && m_server->hasPendingConnections())
     {
-        onStateFinished();
-    }
+        QPointer<Connection> connection = new Connection{this};
+
+        connect(connection.data(), &Connection::disconnected,
+                this, [this, connection](){
+            onDisconnected(connection);
+        }, Qt::QueuedConnection);
+
+        connect(connection.data(), &Connection::recievedCommand,
+                this, [this, connection](){
+            onCommandRecieved(connection);
+        }, Qt::QueuedConnection);
 
-    auto notificationType =
-            success ? gt::process_runner::TaskFinishedNotification :
-                      gt::process_runner::TaskFailedNotification;
+        connection->connectTo(std::unique_ptr<QTcpSocket>(
+                                  m_server->nextPendingConnection()));
 
-    auto notification = std::make_unique<GtProcessRunnerNotification>(
-        m_metaData.sessionId,
-        notificationType,
-        true // non optional notification
-    );
+        m_connections.append(connection);
+        m_hadConnection = true;
+
+        std::cout << "Client connected!" << std::endl;
+    }
 
-    sendNotification(std::move(notification));
+    updateIdleTimer();
 }
 
 void
-GtRemoteProcessRunner::onTaskStateChanged(GtProcessComponent::STATE)
+GtRemoteProcessRunner::onDisconnected(Connection* connection)
 {
-    auto* pc = qobject_cast<GtProcessComponent*>(sender());
-    if (!pc)
+    if (!connection || m_exitCode != Undefined) return;
+
+    gtInfoId(GT_EXEC_ID) << "Connection closed!";
+
+    m_connections.removeAll(connection);
+    connection->deleteLater();
+
+    // sessions bound to this connection
+    auto sessions = m_sessions;
+    for (auto const& session : qAsConst(sessions))
     {
-        return;
+        if (!session || session->connection() != connection) continue;
+
+        session->setConnection(nullptr);
+
+        // session is finished
+        if (session->stateType() == gt::process_runner::FinishStateType)
+        {
+            if (!keepAlive())
+            {
+                return exit(Success);
+            }
+
+            closeSession(*session);
+
+            gtInfoId(GT_EXEC_ID)
+                    << tr("Session finished (%1 served)")
+                           .arg(m_sessionCount);
+        }
+        // dont yet close the session, the client may reconnect to continue
+        // the process execution
+    }
+
+    // process runner was not initialized (persistent runners may be
+    // probed without initializing a session)
+    if (!keepAlive() && m_sessions.isEmpty() && m_connections.isEmpty())
+    {
+        gtErrorId(GT_EXEC_ID)
+                << tr("Failed to initialize Process Runner in time!");
+        return exit(UninitializedError);
     }
 
-    // state changed notification
-    auto notifyTaskChange = std::make_unique<GtProcessRunnerNotification>(
-        m_metaData.sessionId,
-        gt::process_runner::TaskStateChangeNotification
-    );
+    updateIdleTimer();
+}
 
-    // notification will take ownership
-    notifyTaskChange->appendPayload(
-                new gt::process_runner::ProcessComponentStatePayload{pc});
+void
+GtRemoteProcessRunner::onIdleTimeout()
+{
+    if (!m_hadConnection)
+    {
+        std::cout << "Failed to connect to a client!" << std::endl;
+        return exit(UninitializedError);
+    }
 
-    sendNotification(std::move(notifyTaskChange));
+    gtInfoId(GT_EXEC_ID) << tr("Idle timeout, no new session!");
+    exit(Success);
+}
 
-    // update monitoring property once process component finished
-    if (pc->isComponentReady() && !pc->monitoringProperties().isEmpty())
+void
+GtRemoteProcessRunner::updateIdleTimer()
+{
+    bool idle = m_sessions.isEmpty() && m_connections.isEmpty();
+
+    if (!idle || m_exitCode != Undefined || m_timeout < 0)
     {
-        // monitoring property change notification
-        auto notifyPropChange = std::make_unique<GtProcessRunnerNotification>(
-            m_metaData.sessionId,
-            gt::process_runner::TaskPropertyChangeNotification
-        );
+        return m_idleTimer.stop();
+    }
 
-        // notification will take ownership
-        notifyPropChange->appendPayload(pc->clone());
+    if (!m_idleTimer.isActive())
+    {
+        gtInfoId(GT_EXEC_ID) << "Waiting for a new connection...";
+        m_idleTimer.start(m_timeout);
+    }
+}
 
-        sendNotification(std::move(notifyPropChange));
+void
+GtRemoteProcessRunner::onSendFailed(Session& session)
+{
+    if (!keepAlive())
+    {
+        gtErrorId(GT_EXEC_ID) << tr("aborting execution!");
+        return exit(SocketWriteError);
     }
+
+    // the client cannot be notified about the task anymore
+    gtErrorId(GT_EXEC_ID) << tr("Closing session %1!")
+                                 .arg(session.sessionId());
+    closeSession(session);
 }
 
 void
-GtRemoteProcessRunner::sendResponse(GtProcessRunnerResponse& response)
+GtRemoteProcessRunner::sendResponse(Connection& connection,
+                                    GtProcessRunnerResponse& response)
 {
     if (m_exitCode != Undefined)
     {
@@ -229,6 +311,7 @@ GtRemoteProcessRunner::sendResponse(GtProcessRunnerResponse& response)
     {
         gtErrorId(GT_EXEC_ID)
                 << tr("Response was not finalized!");
+        if (keepAlive()) return;
         return exit(SocketWriteError);
     }
 
@@ -238,117 +321,106 @@ GtRemoteProcessRunner::sendResponse(GtProcessRunnerResponse& response)
     if (!response.success())
     {
         gtWarningId(GT_EXEC_ID).verbose().nospace()
-                << tr("Error occured in state ") << m_state->state()
+                << tr("Error occured in state ") << response.runnerState()
                 << ": " << gt::quoted(response.error());
     }
 
     // send data
-    auto res = sendData(*m_connection, response.toMemento().toByteArray());
+    auto res = gt::process_runner::sendData(connection,
+                                            response.toMemento().toBinary());
 
     // Aborted
     if (res != GtEventLoop::Success)
     {
         gtErrorId(GT_EXEC_ID)
-                << tr("Failed to send non-optional response")
-                << tr("aborting execution!");
-        return exit(SocketWriteError);
-    }
-}
+                << tr("Failed to send non-optional response");
 
-void
-GtRemoteProcessRunner::sendNotification(
-        std::unique_ptr<Notification> notification)
-{
-    m_pendingNotifications.emplace(std::move(notification));
+        // the client may reconnect
+        if (keepAlive())
+        {
+            connection.close();
+            return;
+        }
 
-    processPendingNotifications();
+        gtErrorId(GT_EXEC_ID) << tr("aborting execution!");
+        return exit(SocketWriteError);
+    }
 }
 
 void
-GtRemoteProcessRunner::processPendingNotifications()
+GtRemoteProcessRunner::onCommandRecieved(Connection* connection)
 {
-    // While data is beeing send other notifications may call this function
-    // However each notification should be written one by one as they are in
-    // the queue. Therefore we use this mutex like flag.
-    static bool isBeeingProcessed = false;
+    if (!connection) return;
 
-    // exit if notifications are beeing processed
-    if (isBeeingProcessed)
+    auto command = connection->nextCommand();
+    if (!command)
     {
+        gtWarningId(GT_EXEC_ID) << "Invalid command!";
         return;
     }
 
-    if (!m_connection->hasConnection())
-    {
-        return;
-    }
+    gtDebugId(GT_EXEC_ID)
+            << "Recieved command: " << command->objectName() << command->uuid();
 
-    isBeeingProcessed = true;
+    // find the session addressed
+    QPointer<Session> session = findSession(command->sessionId());
 
-    // process pending notifications
-    while (!m_pendingNotifications.empty())
+    // commands of unknown sessions are handled by a new session, which is
+    // discarded unless it was initialized
+    std::unique_ptr<Session> newSession;
+    if (!session)
     {
-        auto& notification = *m_pendingNotifications.front();
-
-        gtDebugId(GT_EXEC_ID).verbose()
-                << "Sending notification..." << notification.notificationType();
-
-        // send data
-        auto res = sendData(
-                       *m_connection, notification.toMemento().toByteArray());
-
-        // abort (e.g. connection lost)
-        if (res == GtEventLoop::Aborted)
-        {
-            break;
-        }
+        newSession = std::make_unique<Session>(*this);
+        session = newSession.get();
+    }
+    // client may have reconnected
+    else if (session->connection() != connection)
+    {
+        session->setConnection(connection);
+    }
 
-        bool optional = notification.isOptional();
+    std::unique_ptr<GtProcessRunnerResponse> response;
 
-        // unqueue (notification is now invalid)
-        m_pendingNotifications.pop();
+    bool isInitCommand =
+            qobject_cast<GtProcessRunnerInitSessionCommand*>(command.get());
 
-        // exit if non-optional
-        if (!optional && res == GtEventLoop::Failed)
-        {
-            gtErrorId(GT_EXEC_ID) << tr("Failed to send non-optional notification!")
-                             << tr("aborting execution!");
-            exit(SocketWriteError);
-            break;
-        }
+    if (newSession && isInitCommand && m_sessions.size() >= m_maxSessions)
+    {
+        response = session->state().makeResponse(*command,
+            gt::process_runner::InvalidStateError,
+            tr("Maximum number of sessions reached (%1)!").arg(m_maxSessions)
+        );
     }
-
-    isBeeingProcessed = false;
-}
-void
-GtRemoteProcessRunner::onCommandRecieved()
-{
-    auto command = m_connection->nextCommand();
-    if (!command)
+    else
     {
-        gtWarningId(GT_EXEC_ID) << "Invalid command!";
-        return;
+        response = session->handleCommand(*command);
     }
 
-    gtDebugId(GT_EXEC_ID)
-            << "Recieved command: " << command->objectName() << command->uuid();
+    // register initialized session
+    if (newSession &&
+        newSession->stateType() != gt::process_runner::StartStateType)
+    {
+        Session* s = newSession.release();
+        s->setParent(this);
+        s->setConnection(connection);
 
-    gtDebugId(GT_EXEC_ID) << "Current state:     " << m_state;
-    gtDebugId(GT_EXEC_ID) << "Session id:        " << m_metaData.sessionId;
-    gtDebugId(GT_EXEC_ID) << "Command session id:" << command->sessionId();
+        connect(s, &Session::sendFailed, this, [this, s](){
+            onSendFailed(*s);
+        });
 
-    auto response = m_state->handleCommand(*command);
+        m_sessions.append(s);
+        m_sessionCount += 1;
 
-    // command was not handled
-    if (!response)
-    {
-        response = m_state->makeResponse(*command,
-            gt::process_runner::UnkownCommandError,
-            tr("Command could not be handled by current state!")
-        );
+        gtInfoId(GT_EXEC_ID)
+                << tr("Session %1 initialized (%2/%3 active)")
+                       .arg(s->sessionId())
+                       .arg(m_sessions.size())
+                       .arg(m_maxSessions);
+
+        updateIdleTimer();
     }
 
-    return sendResponse(*response);
+    return sendResponse(*connection, *response);
 }
 
 GtRemoteProcessRunner::ExitCode
@@ -386,12 +458,9 @@ GtRemoteProcessRunner::exec(const QHostAddress& client,
         return PortUnavailableError;
     }
 
-    // initialize executor
-    gt::currentProcessExecutor().setCoreExecutorFlags(gt::NonBlockingExecution);
-
     // initialize server
     QTcpServer server;
-    server.setMaxPendingConnections(2);
+    server.setMaxPendingConnections(std::max(2, m_maxSessions + 1));
 
     // start
     std::cout << "Executing process runner. Listening to "
@@ -399,21 +468,31 @@ GtRemoteProcessRunner::exec(const QHostAddress& client,
               << port << "..." << std::endl;
 
     // start listening
-    server.listen(client, port);
-
-    // blocking call
-    if (!server.waitForNewConnection(timeout))
+    if (!server.listen(client, port))
     {
-        std::cout << "Failed to connect to a client!";
+        std::cout << "Failed to listen on port " << port << "!" << std::endl;
         std::cout << "Error: " << server.errorString().toStdString()
                   << std::endl;
-        return UninitializedError;
+        return PortUnavailableError;
+    }
+
+    std::cout << gt::process_runner::S_READY_MESSAGE.toStdString()
+              << std::endl;
+
+    if (m_maxSessions > 1)
+    {
+        std::cout << "Serving up to " << m_maxSessions << " sessions "
+                  << "concurrently (idle timeout: "
+                  << timeout / 1000 << "s)" << std::endl;
+    }
+    else if (m_persistent)
+    {
+        std::cout << "Accepting successive sessions (idle timeout: "
+                  << timeout / 1000 << "s)" << std::endl;
     }
 
-    // connect to client
-    m_connection->connectTo(std::unique_ptr<QTcpSocket>(
-                                server.nextPendingConnection()));
-    std::cout << "Client connected!" << std::endl;
+    // the runner exits if no client connected within the timeout
+    m_timeout = timeout;
 
     printOutputSeparator("START");
 
@@ -444,69 +523,33 @@ GtRemoteProcessRunner::exec(const QHostAddress& client,
 GtRemoteProcessRunner::ExitCode
 GtRemoteProcessRunner::execMainLoop(QTcpServer& server)
 {
-    // main loop
-    while (m_connection->hasConnection() && m_exitCode == Undefined)
-    {
-        // execution event loop
-        GtEventLoop loop{-1};
-        m_eventLoop = &loop;
-
-        processPendingNotifications();
-
-        // eventloop will be canceld by exit function
-        loop.exec();
-
-        switch (m_exitCode)
-        {
-        case Disconnected:
-        {
-            auto type = m_state->stateType();
-            // process runner is finished
-            if (type == gt::process_runner::FinishStateType)
-            {
-                return Success;
-            }
-            // process runner was not initialized
-            if (type == gt::process_runner::StartStateType)
-            {
-                gtErrorId(GT_EXEC_ID)
-                        << tr("Failed to initialize Process Runner in time!");
-                return UninitializedError;
-            }
-            // dont yet return, continue process execution
-            break;
-        }
-        default:
-            return m_exitCode;
-        }
+    m_server = &server;
 
-        // clear exit code
-        m_exitCode = Undefined;
+    connect(&server, &QTcpServer::newConnection,
+            this, &GtRemoteProcessRunner::onNewConnection);
+    connect(&server, &QTcpServer::acceptError,
+            this, [&server](){
+        gtWarningId(GT_EXEC_ID) << tr("Failed to accept connection!")
+                                << server.errorString();
+    });
 
-        // reconnect
-        gtInfoId(GT_EXEC_ID) << "Waiting for a new connection...";
+    // execution event loop, will be canceld by exit function
+    GtEventLoop loop{-1};
+    m_eventLoop = &loop;
 
-        // wait for new connection
-        GtEventLoop waitForConnection{-1};
-        // QPointer will take care of "dangling life time"
-        // cppcheck-suppress danglingLifetime
-        m_eventLoop = &waitForConnection;
+    // there might be a pending connection
+    onNewConnection();
 
-        waitForConnection.connectSuccess(&server, &QTcpServer::newConnection);
-        waitForConnection.connectFailed(&server, &QTcpServer::acceptError);
+    loop.exec();
 
-        // there might be a pending execution
-        if (!server.hasPendingConnections())
-        {
-            waitForConnection.exec();
-        }
+    disconnect(&server, nullptr, this, nullptr);
 
-        gtInfoId(GT_EXEC_ID) << "Connecting...";
-        m_connection->connectTo(std::unique_ptr<QTcpSocket>(
-                                    server.nextPendingConnection()));
+    if (m_exitCode == Undefined)
+    {
+        gtErrorId(GT_EXEC_ID)
+                << tr("Unexpected exit (no connection/invalid state)");
+        return UnexpectedExit;
     }
 
-    gtErrorId(GT_EXEC_ID) << tr("Unexpected exit (no connection/invalid state)");
-    return UnexpectedExit;
+    return m_exitCode;
 }
-
@@ -11,28 +11,37 @@
 #ifndef GTREMOTEPROCESSRUNNER_H
 #define GTREMOTEPROCESSRUNNER_H
 
+#include <QHash>
 #include <QObject>
-#include <queue>
+#include <QPointer>
+#include <QTimer>
 
-#include "gt_processcomponent.h"
 #include "gt_processrunnertcpconnection.h"
-#include "gt_processrunnernotification.h"
 #include "gt_processrunnerresponse.h"
-#include "gt_remoteprocessrunnerstates.h"
 
-class GtProcessRunnerCommand;
-class GtProcessRunnerRunTaskCommand;
-class GtProcessRunnerCollectTaskCommand;
-class GtProcessRunnerInitSessionCommand;
+class GtEventLoop;
+class GtRemoteProcessRunnerSession;
 class QTcpServer;
 class QHostAddress;
 
+/**
+ * @brief The GtRemoteProcessRunner class.
+ * TCP server executing the tasks of remote clients. Each client initializes
+ * a session, which runs one task at a time on its own executor. Commands are
+ * dispatched to the sessions by their session id, thus several clients may
+ * be connected at once and the tasks of all sessions are executed
+ * concurrently. As the externalization directory is global to the process,
+ * only tasks of the same project are executed at once.
+ *
+ * By default only a single session is served and the runner exits once the
+ * task has been collected.
+ */
 class GtRemoteProcessRunner : public QObject
 {
     Q_OBJECT
 
-    using ConnectionStrategy = GtProcessRunnerTcpConnection;
-    using Notification = GtProcessRunnerNotification;
+    using Connection = GtProcessRunnerTcpConnection;
+    using Session = GtRemoteProcessRunnerSession;
 
 public:
 
@@ -55,6 +64,8 @@ public:
      */
     GtRemoteProcessRunner();
 
+    ~GtRemoteProcessRunner() override;
+
     /**
      * @brief Main exec function. Blocking call.
      * Executes the Remote Proess Runner. Runner will open a tcp server and
@@ -79,77 +90,164 @@ public:
      */
     void exit(ExitCode code);
 
-public slots:
+    /**
+     * @brief Sets whether the runner accepts successive sessions. A
+     * persistent runner resets its state once a task has been collected and
+     * waits for the next session instead of exiting. The timeout passed to
+     * exec is used as idle timeout, i.e. the runner exits once no client
+     * connected within the timeout.
+     * @param persistent Persistent
+     */
+    void setPersistent(bool persistent);
 
     /**
-     * @brief Notifies the client, that the task has finished executing
+     * @brief Returns whether the runner accepts successive sessions
+     * @return Is persistent
      */
-    void onTaskFinished();
+    bool isPersistent() const;
 
     /**
-     * @brief Notifies the client about an state or monitoring property change
+     * @brief Sets the maximum number of sessions served at once. A runner
+     * serving more than one session runs in server mode: it is persistent
+     * and aborting a session only terminates the task of this session.
+     * Default is 1.
+     * @param count Maximum number of sessions
      */
-    void onTaskStateChanged(GtProcessComponent::STATE);
+    void setMaxSessions(int count);
 
-private slots:
+    /**
+     * @brief Returns the maximum number of sessions served at once
+     * @return Maximum number of sessions
+     */
+    int maxSessions() const;
 
     /**
-     * @brief Handles disconnects
+     * @brief Aborts the session. In single session mode the runner exits.
+     * Otherwise the task of the session is terminated and the session is
+     * closed.
+     * @param session Session to abort
      */
-    void onDisconnected();
+    void abortSession(Session& session);
 
     /**
-     * @brief Advances to the next state
+     * @brief Reserves the project directory for the task of the session and
+     * sets it as externalization directory. The externalization directory
+     * is global to the process, thus the sessions may only execute tasks
+     * concurrently if they use the same project directory.
+     * @param session Session
+     * @param projectDir Project directory of the task
+     * @return Whether the directory was reserved. False if another session
+     * reserved a different directory.
      */
-    void onStateFinished();
+    bool reserveProjectDir(Session const& session, QString const& projectDir);
 
     /**
-     * @brief Forwards command recieved to the state handlers
+     * @brief Releases the project directory reserved by the session
+     * @param session Session
      */
-    void onCommandRecieved();
+    void releaseProjectDir(Session const& session);
+
+private slots:
+
+    /**
+     * @brief Accepts the pending connections
+     */
+    void onNewConnection();
+
+    /**
+     * @brief Exits the runner if no client connected within the timeout
+     */
+    void onIdleTimeout();
 
 private:
 
-    /// pointer to current state handler
-    QPointer<GtAbstractProcessRunnerState> m_state;
+    /// Tcp server
+    QPointer<QTcpServer> m_server;
+
+    /// Client connections
+    QList<QPointer<Connection>> m_connections;
 
-    /// meta data for the state handlers
-    gt::process_runner::MetaData m_metaData;
+    /// Initialized sessions (owned by this)
+    QList<QPointer<Session>> m_sessions;
 
-    /// Connection strategy
-    QPointer<ConnectionStrategy> m_connection;
+    /// Project directories reserved by the sessions
+    QHash<Session const*, QString> m_projectDirs;
 
     /// Main event loop
     QPointer<GtEventLoop> m_eventLoop;
 
+    /// Exits the runner if no client is connected for too long
+    QTimer m_idleTimer;
+
+    /// Idle timeout in ms (negative if the runner should wait forever)
+    int m_timeout{-1};
+
     /// Current exit code
     ExitCode m_exitCode{Undefined};
 
-    /// Queue for pending notifications
-    std::queue<std::unique_ptr<Notification>> m_pendingNotifications;
+    /// Whether the runner accepts successive sessions
+    bool m_persistent{false};
+
+    /// Maximum number of sessions served at once
+    int m_maxSessions{1};
+
+    /// Number of sessions served
+    int m_sessionCount{0};
+
+    /// Whether a client has connected yet
+    bool m_hadConnection{false};
 
     /**
-     * @brief Advances tothe next state
-     * @param state Next state
+     * @brief Returns whether the runner keeps running once a session has
+     * finished
+     * @return Keep alive
      */
-    void setNextState(gt::process_runner::State state);
+    bool keepAlive() const;
 
     /**
-     * @brief Helper fucntion for sending responses
-     * @param response Resonse to send
+     * @brief Returns the initialized session with the given id
+     * @param sessionId Session id
+     * @return Session (may be null)
      */
-    void sendResponse(GtProcessRunnerResponse& response);
+    Session* findSession(QString const& sessionId) const;
 
     /**
-     * @brief Helper function for sending notifications
-     * @param notification Notification to send
+     * @brief Closes the session and deletes it once its task has finished
+     * @param session Session to close
      */
-    void sendNotification(std::unique_ptr<Notification> notification);
+    void closeSession(Session& session);
 
     /**
-     * @brief Process the notifications queue
+     * @brief Handles a closed client connection
+     * @param connection Connection
+     */
+    void onDisconnected(Connection* connection);
+
+    /**
+     * @brief Forwards the command recieved to the session addressed
+     * @param connection Connection the command was recieved from
+     */
+    void onCommandRecieved(Connection* connection);
+
+    /**
+     * @brief Handles a non-optional notification that could not be sent
+     * @param session Session
+     */
+    void onSendFailed(Session& session);
+
+    /**
+     * @brief Starts the idle timer if no client is connected and no session
+     * is active. Stops it otherwise.
+     */
+    void updateIdleTimer();
+
+    /**
+     * @brief Helper fucntion for sending responses
+     * @param connection Connection to send the response to
+     * @param response Resonse to send
      */
-    void processPendingNotifications();
+    void sendResponse(Connection& connection,
+                      GtProcessRunnerResponse& response);
 
     /**
      * @brief Helper function for executing the main event loop of the
@@ -0,0 +1,347 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gt_remoteprocessrunnersession.h"
+
+#include "gt_coreprocessexecutor.h"
+#include "gt_processrunnercommand.h"
+#include "gt_processrunnertcpconnection.h"
+#include "gt_remoteprocessrunner.h"
+#include "gt_logging.h"
+
+static int S_SENDING_TIMEOUT = 3 * 1000;
+
+static uint S_MAX_RETRIES = 3;
+
+GtEventLoop::State
+gt::process_runner::sendData(GtProcessRunnerConnectionStrategy& connection,
+                             QByteArray const& data)
+{
+    uint retries = 0;
+
+    do {
+        GtEventLoop loop{S_SENDING_TIMEOUT};
+
+        connection.writeData(loop, data);
+
+        if (loop.exec() == GtEventLoop::Success)
+        {
+            return GtEventLoop::Success;
+        }
+
+        // sending failed
+        retries += 1;
+
+        gtWarningId(GT_EXEC_ID) << QObject::tr("Failed to send data! (%1/%2)")
+                              .arg(retries)
+                              .arg(S_MAX_RETRIES);
+
+        // connection may have been lost
+        if (!connection.hasConnection())
+        {
+            gtDebugId(GT_EXEC_ID) << QObject::tr("No connection!");
+            return GtEventLoop::Aborted;
+        }
+    }
+    while(retries < S_MAX_RETRIES);
+
+    return (retries < S_MAX_RETRIES) ? GtEventLoop::Success :
+                                       GtEventLoop::Failed;
+}
+
+GtRemoteProcessRunnerSession::GtRemoteProcessRunnerSession(
+        GtRemoteProcessRunner& runner) :
+    m_runner{&runner},
+    m_executor{new GtCoreProcessExecutor{this, gt::NonBlockingExecution}}
+{
+    setObjectName("Session");
+
+    setNextState(gt::process_runner::UninitializedState);
+}
+
+GtRemoteProcessRunnerSession::~GtRemoteProcessRunnerSession()
+{
+    if (isTaskRunning())
+    {
+        gtWarningId(GT_EXEC_ID)
+                << tr("Closing session while the task is still running!");
+    }
+
+    // notifications and executor signals of this session
+    disconnect(m_executor, nullptr, this, nullptr);
+
+    if (m_runner) m_runner->releaseProjectDir(*this);
+}
+
+QString const&
+GtRemoteProcessRunnerSession::sessionId() const
+{
+    return m_metaData.sessionId;
+}
+
+GtAbstractProcessRunnerState&
+GtRemoteProcessRunnerSession::state() const
+{
+    assert(m_state);
+    return *m_state;
+}
+
+gt::process_runner::StateType
+GtRemoteProcessRunnerSession::stateType() const
+{
+    return state().stateType();
+}
+
+GtCoreProcessExecutor&
+GtRemoteProcessRunnerSession::executor()
+{
+    return *m_executor;
+}
+
+bool
+GtRemoteProcessRunnerSession::isTaskRunning() const
+{
+    return m_state &&
+           m_state->state() == gt::process_runner::RunningTaskState;
+}
+
+void
+GtRemoteProcessRunnerSession::setNextState(gt::process_runner::State state)
+{
+    // the task no longer accesses the project directory
+    if (state == gt::process_runner::CollectedState && m_runner)
+    {
+        m_runner->releaseProjectDir(*this);
+    }
+
+    m_state = gt::process_runner::makeState(state, m_metaData, *this);
+
+    connect(m_state.data(), &GtAbstractProcessRunnerState::stateFinished,
+            this, &GtRemoteProcessRunnerSession::onStateFinished);
+}
+
+std::unique_ptr<GtProcessRunnerResponse>
+GtRemoteProcessRunnerSession::handleCommand(GtProcessRunnerCommand& command)
+{
+    gtDebugId(GT_EXEC_ID) << "Current state:     " << m_state;
+    gtDebugId(GT_EXEC_ID) << "Session id:        " << m_metaData.sessionId;
+    gtDebugId(GT_EXEC_ID) << "Command session id:" << command.sessionId();
+
+    // keep state alive, the state may advance while handling the command
+    QPointer<GtAbstractProcessRunnerState> state = m_state;
+
+    auto response = state->handleCommand(command);
+
+    // command was not handled
+    if (!response)
+    {
+        response = state->makeResponse(command,
+            gt::process_runner::UnkownCommandError,
+            tr("Command could not be handled by current state!")
+        );
+    }
+
+    return response;
+}
+
+void
+GtRemoteProcessRunnerSession::setConnection(Connection* connection)
+{
+    m_connection = connection;
+
+    processPendingNotifications();
+}
+
+GtProcessRunnerTcpConnection*
+GtRemoteProcessRunnerSession::connection() const
+{
+    return m_connection;
+}
+
+void
+GtRemoteProcessRunnerSession::abort()
+{
+    if (m_runner)
+    {
+        m_runner->abortSession(*this);
+    }
+}
+
+bool
+GtRemoteProcessRunnerSession::reserveProjectDir(QString const& projectDir)
+{
+    return m_runner && m_runner->reserveProjectDir(*this, projectDir);
+}
+
+void
+GtRemoteProcessRunnerSession::close()
+{
+    m_closing = true;
+
+    if (!isTaskRunning())
+    {
+        emit closed();
+        return;
+    }
+
+    gtDebugId(GT_EXEC_ID) << "Terminating task...";
+
+    // session is closed once the task has finished
+    m_executor->terminateAllTasks();
+}
+
+void
+GtRemoteProcessRunnerSession::onStateFinished()
+{
+    gtDebugId(GT_EXEC_ID) << "On State Changed!" << m_state;
+    assert(m_state);
+
+    auto oldState = m_state;
+
+    setNextState(m_state->nextState());
+
+    oldState->deleteLater();
+}
+
+void
+GtRemoteProcessRunnerSession::onTaskFinished()
+{
+    gtInfoId(GT_EXEC_ID) << "Task finished!" << m_metaData.sessionId;
+
+    // advance to next state
+    onStateFinished();
+
+    if (m_closing)
+    {
+        emit closed();
+        return;
+    }
+
+    assert(m_metaData.task);
+
+    // check success state of task
+    bool success =
+            m_metaData.task->currentState() == GtProcessComponent::FINISHED ||
+            m_metaData.task->currentState() == GtProcessComponent::WARN_FINISHED;
+
+    // task doesnt need to be collected
+    if (!success)
+    {
+        onStateFinished();
+    }
+
+    auto notificationType =
+            success ? gt::process_runner::TaskFinishedNotification :
+                      gt::process_runner::TaskFailedNotification;
+
+    auto notification = std::make_unique<GtProcessRunnerNotification>(
+        m_metaData.sessionId,
+        notificationType,
+        true // non optional notification
+    );
+
+    sendNotification(std::move(notification));
+}
+
+void
+GtRemoteProcessRunnerSession::onTaskStateChanged(GtProcessComponent::STATE)
+{
+    auto* pc = qobject_cast<GtProcessComponent*>(sender());
+    if (!pc || m_closing)
+    {
+        return;
+    }
+
+    // state changed notification
+    auto notifyTaskChange = std::make_unique<GtProcessRunnerNotification>(
+        m_metaData.sessionId,
+        gt::process_runner::TaskStateChangeNotification
+    );
+
+    // notification will take ownership
+    notifyTaskChange->appendPayload(
+                new gt::process_runner::ProcessComponentStatePayload{pc});
+
+    sendNotification(std::move(notifyTaskChange));
+
+    // update monitoring property once process component finished
+    if (pc->isComponentReady() && !pc->monitoringProperties().isEmpty())
+    {
+        // monitoring property change notification
+        auto notifyPropChange = std::make_unique<GtProcessRunnerNotification>(
+            m_metaData.sessionId,
+            gt::process_runner::TaskPropertyChangeNotification
+        );
+
+        // notification will take ownership
+        notifyPropChange->appendPayload(pc->clone());
+
+        sendNotification(std::move(notifyPropChange));
+    }
+}
+
+void
+GtRemoteProcessRunnerSession::sendNotification(
+        std::unique_ptr<Notification> notification)
+{
+    m_pendingNotifications.emplace(std::move(notification));
+
+    processPendingNotifications();
+}
+
+void
+GtRemoteProcessRunnerSession::processPendingNotifications()
+{
+    // While data is beeing send other notifications may call this function
+    // However each notification should be written one by one as they are in
+    // the queue. Therefore we use this mutex like flag.
+    if (m_processingNotifications)
+    {
+        return;
+    }
+
+    if (!m_connection || !m_connection->hasConnection())
+    {
+        return;
+    }
+
+    m_processingNotifications = true;
+
+    // process pending notifications
+    while (!m_pendingNotifications.empty() && m_connection)
+    {
+        auto& notification = *m_pendingNotifications.front();
+
+        gtDebugId(GT_EXEC_ID).verbose()
+                << "Sending notification..." << notification.notificationType();
+
+        // send data
+        auto res = gt::process_runner::sendData(
+                       *m_connection, notification.toMemento().toBinary());
+
+        // abort (e.g. connection lost)
+        if (res == GtEventLoop::Aborted)
+        {
+            break;
+        }
+
+        bool optional = notification.isOptional();
+
+        // unqueue (notification is now invalid)
+        m_pendingNotifications.pop();
+
+        // exit if non-optional
+        if (!optional && res == GtEventLoop::Failed)
+        {
+            gtErrorId(GT_EXEC_ID)
+                    << tr("Failed to send non-optional notification!");
+            emit sendFailed();
+            break;
+        }
+    }
+
+    m_processingNotifications = false;
+}
@@ -0,0 +1,219 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef GTREMOTEPROCESSRUNNERSESSION_H
+#define GTREMOTEPROCESSRUNNERSESSION_H
+
+#include <QObject>
+#include <QPointer>
+#include <queue>
+
+#include "gt_eventloop.h"
+#include "gt_processcomponent.h"
+#include "gt_processrunnernotification.h"
+#include "gt_processrunnerresponse.h"
+#include "gt_remoteprocessrunnerstates.h"
+
+class GtCoreProcessExecutor;
+class GtProcessRunnerCommand;
+class GtProcessRunnerConnectionStrategy;
+class GtProcessRunnerTcpConnection;
+class GtRemoteProcessRunner;
+
+namespace gt
+{
+namespace process_runner
+{
+
+/**
+ * @brief Helper function to send data. If writing fails retry a few more
+ * times.
+ * @param connection Connection strategy
+ * @param data Data to write
+ * @return Success
+ */
+GtEventLoop::State sendData(GtProcessRunnerConnectionStrategy& connection,
+                            QByteArray const& data);
+
+} // namespace process_runner
+
+} // namespace gt
+
+/**
+ * @brief The GtRemoteProcessRunnerSession class.
+ * A session of the remote process runner. Each session has its own state
+ * machine and its own executor, thus the tasks of different sessions are
+ * executed concurrently.
+ *
+ * The session is bound to the client connection that sent the last command.
+ * Notifications are queued while the client is not connected.
+ */
+class GtRemoteProcessRunnerSession : public QObject
+{
+    Q_OBJECT
+
+    using Connection = GtProcessRunnerTcpConnection;
+    using Notification = GtProcessRunnerNotification;
+
+public:
+
+    /**
+     * @brief Constructor
+     * @param runner Process runner hosting this session
+     */
+    explicit GtRemoteProcessRunnerSession(GtRemoteProcessRunner& runner);
+
+    ~GtRemoteProcessRunnerSession() override;
+
+    /**
+     * @brief Returns the session id. Empty if the session was not
+     * initialized yet.
+     * @return Session id
+     */
+    QString const& sessionId() const;
+
+    /**
+     * @brief Returns the current state handler
+     * @return State handler
+     */
+    GtAbstractProcessRunnerState& state() const;
+
+    /**
+     * @brief Returns the type of the current state
+     * @return State type
+     */
+    gt::process_runner::StateType stateType() const;
+
+    /**
+     * @brief Returns the executor of this session
+     * @return Executor
+     */
+    GtCoreProcessExecutor& executor();
+
+    /**
+     * @brief Returns whether the task of this session is being executed
+     * @return Is running
+     */
+    bool isTaskRunning() const;
+
+    /**
+     * @brief Forwards the command to the current state handler
+     * @param command Command to handle
+     * @return Response
+     */
+    std::unique_ptr<GtProcessRunnerResponse> handleCommand(
+            GtProcessRunnerCommand& command);
+
+    /**
+     * @brief Binds the session to the connection. Pending notifications are
+     * sent once a valid connection was set.
+     * @param connection Client connection (may be null)
+     */
+    void setConnection(Connection* connection);
+
+    /**
+     * @brief Returns the client connection the session is bound to
+     * @return Connection (may be null)
+     */
+    Connection* connection() const;
+
+    /**
+     * @brief Requests the process runner to abort this session
+     */
+    void abort();
+
+    /**
+     * @brief Reserves the project directory for the task of this session.
+     * The reservation is released once the task was collected or the
+     * session was deleted.
+     * @param projectDir Project directory of the task
+     * @return Whether the directory was reserved. False if another session
+     * executes a task of a different project.
+     */
+    bool reserveProjectDir(QString const& projectDir);
+
+    /**
+     * @brief Terminates the running task. The signal `closed` is emitted once
+     * the task has finished or immediately if no task is running.
+     */
+    void close();
+
+    /**
+     * @brief Process the notifications queue
+     */
+    void processPendingNotifications();
+
+public slots:
+
+    /**
+     * @brief Notifies the client, that the task has finished executing
+     */
+    void onTaskFinished();
+
+    /**
+     * @brief Notifies the client about an state or monitoring property change
+     */
+    void onTaskStateChanged(GtProcessComponent::STATE);
+
+signals:
+
+    /**
+     * @brief Emitted once the session was closed and can be deleted
+     */
+    void closed();
+
+    /**
+     * @brief Emitted if a non-optional notification could not be sent
+     */
+    void sendFailed();
+
+private slots:
+
+    /**
+     * @brief Advances to the next state
+     */
+    void onStateFinished();
+
+private:
+
+    /// pointer to the process runner
+    QPointer<GtRemoteProcessRunner> m_runner;
+
+    /// pointer to current state handler
+    QPointer<GtAbstractProcessRunnerState> m_state;
+
+    /// meta data for the state handlers
+    gt::process_runner::MetaData m_metaData;
+
+    /// executor of this session (owned by this)
+    GtCoreProcessExecutor* m_executor{};
+
+    /// client connection
+    QPointer<Connection> m_connection;
+
+    /// queue for pending notifications
+    std::queue<std::unique_ptr<Notification>> m_pendingNotifications;
+
+    /// whether notifications are being sent
+    bool m_processingNotifications{false};
+
+    /// whether the session is being closed
+    bool m_closing{false};
+
+    /**
+     * @brief Advances to the next state
+     * @param state Next state
+     */
+    void setNextState(gt::process_runner::State state);
+
+    /**
+     * @brief Helper function for sending notifications
+     * @param notification Notification to send
+     */
+    void sendNotification(std::unique_ptr<Notification> notification);
+};
+
+#endif // GTREMOTEPROCESSRUNNERSESSION_H
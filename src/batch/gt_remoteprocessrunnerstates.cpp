@@ -13,18 +13,18 @@
 #include "gt_objectmementodiff.h"
 #include "gt_package.h"
 #include "gt_processdata.h"
-#include "gt_externalizationmanager.h"
 #include "gt_processrunnercommand.h"
-#include "gt_remoteprocessrunner.h"
+#include "gt_remoteprocessrunnersession.h"
 #include "gt_exceptions.h"
 
 
 QPointer<GtAbstractProcessRunnerState>
 gt::process_runner::makeState(State state,
                               MetaData& metaData,
-                              GtRemoteProcessRunner& runner) noexcept(false)
+                              GtRemoteProcessRunnerSession& session
+                              ) noexcept(false)
 {
-    QPointer<GtRemoteProcessRunner> ptr{&runner};
+    QPointer<GtRemoteProcessRunnerSession> ptr{&session};
     MetaData* m = &metaData;
 
     switch (state)
@@ -48,13 +48,13 @@ gt::process_runner::makeState(State state,
 }
 
 GtAbstractProcessRunnerState::GtAbstractProcessRunnerState(
-        QPointer<GtRemoteProcessRunner> runner,
+        QPointer<GtRemoteProcessRunnerSession> session,
         gt::process_runner::MetaData* metaData) :
-    QObject{runner},
-    m_runner{std::move(runner)},
+    QObject{session},
+    m_session{std::move(session)},
     m_metaData{metaData}
 {
-    assert(m_runner);
+    assert(m_session);
     assert(m_metaData);
 }
 
@@ -63,8 +63,12 @@ GtAbstractProcessRunnerState::makeResponse(Command& command,
                                            gt::process_runner::Error code,
                                            QString error)
 {
+    // session may not be initialized yet
+    QString sessionId = m_metaData->sessionId.isEmpty() ?
+                            command.sessionId() : m_metaData->sessionId;
+
     return std::make_unique<GtProcessRunnerResponse>(
-        m_metaData->sessionId,
+        sessionId,
         command.uuid(),
         state(),
         code,
@@ -91,7 +95,8 @@ GtAbstractProcessRunnerState::handleCommand(Command& command)
     if (qobject_cast<GtProcessRunnerAbortCommand*>(&command))
     {
         gtDebugId(GT_EXEC_ID).medium() << "Abort Command!";
-        m_runner->exit(GtRemoteProcessRunner::AbortExit);
+        m_session->abort();
+        return makeResponse(command);
     }
 
     return {};
@@ -160,9 +165,9 @@ GtAbstractProcessRunnerState::checkSession(Command& command)
 }
 
 GtUninitializedProcessRunnerState::GtUninitializedProcessRunnerState(
-        QPointer<GtRemoteProcessRunner> runner,
+        QPointer<GtRemoteProcessRunnerSession> session,
         gt::process_runner::MetaData* metaData) :
-    GtAbstractProcessRunnerState{runner, metaData}
+    GtAbstractProcessRunnerState{session, metaData}
 {
     setObjectName("UninitializedState");
 }
@@ -181,9 +186,9 @@ GtUninitializedProcessRunnerState::handleCommand(Command& command)
 
 
 GtInitializedProcessRunnerState::GtInitializedProcessRunnerState(
-        QPointer<GtRemoteProcessRunner> runner,
+        QPointer<GtRemoteProcessRunnerSession> session,
         gt::process_runner::MetaData* metaData) :
-    GtAbstractProcessRunnerState{runner, metaData}
+    GtAbstractProcessRunnerState{session, metaData}
 {
     setObjectName("InitializedState");
 }
@@ -207,11 +212,25 @@ GtInitializedProcessRunnerState::handleCommand(Command& command)
 
     gtDebugId(GT_EXEC_ID) << "Run Task Command!";
 
+    // project path
+    QString projectPath = runCmd->projectPath();
+
+    gtDebugId(GT_EXEC_ID) << tr("Using project path: %1").arg(projectPath);
+
+    // the externalization directory is shared by all sessions, thus only
+    // tasks of the same project may be executed concurrently
+    if (!m_session->reserveProjectDir(projectPath))
+    {
+        return makeResponse(command, gt::process_runner::RunTaskError,
+                            tr("Another session is executing a task of a "
+                               "different project!"));
+    }
+
     // sanity check
     assert(!m_metaData->task);
     assert(!m_metaData->source);
 
-    auto& executor = gt::currentProcessExecutor();
+    auto& executor = m_session->executor();
 
     // shortcut for meta dasta
     auto* m = m_metaData;
@@ -229,18 +248,11 @@ GtInitializedProcessRunnerState::handleCommand(Command& command)
 
     // setup process data
     auto* processData = new GtProcessData;
-    processData->setParent(m_runner);
+    processData->setParent(m_session);
 
     // take ownership
     processData->appendChild(m->task);
-    m->source->setParent(m_runner);
-
-    // project path
-    QString projectPath = runCmd->projectPath();
-
-    gtDebugId(GT_EXEC_ID) << tr("Using project path: %1").arg(projectPath);
-
-    gtExternalizationManager->setProjectDir(projectPath);
+    m->source->setParent(m_session);
 
     if (!executor.setCustomProjectPath(projectPath))
     {
@@ -256,7 +268,7 @@ GtInitializedProcessRunnerState::handleCommand(Command& command)
     {
         auto success =
             connect(pc, &GtProcessComponent::stateChanged,
-                    m_runner, &GtRemoteProcessRunner::onTaskStateChanged,
+                    m_session, &GtRemoteProcessRunnerSession::onTaskStateChanged,
                     Qt::QueuedConnection);
         assert(success);
     }
@@ -264,7 +276,7 @@ GtInitializedProcessRunnerState::handleCommand(Command& command)
     // connect task finished signal
     auto success =
         connect(&executor, &GtCoreProcessExecutor::allTasksCompleted,
-                m_runner, &GtRemoteProcessRunner::onTaskFinished,
+                m_session, &GtRemoteProcessRunnerSession::onTaskFinished,
                 Qt::QueuedConnection);
     assert(success);
 
@@ -299,9 +311,9 @@ GtInitializedProcessRunnerState::handleCommand(Command& command)
 
 
 GtRunningTaskProcessRunnerState::GtRunningTaskProcessRunnerState(
-        QPointer<GtRemoteProcessRunner> runner,
+        QPointer<GtRemoteProcessRunnerSession> session,
         gt::process_runner::MetaData* metaData) :
-    GtAbstractProcessRunnerState{runner, metaData}
+    GtAbstractProcessRunnerState{session, metaData}
 {
     setObjectName("RunningTaskState");
 }
@@ -314,9 +326,9 @@ GtRunningTaskProcessRunnerState::handleCommand(Command& command)
 }
 
 GtFinishedTaskProcessRunnerState::GtFinishedTaskProcessRunnerState(
-        QPointer<GtRemoteProcessRunner> runner,
+        QPointer<GtRemoteProcessRunnerSession> session,
         gt::process_runner::MetaData* metaData) :
-    GtAbstractProcessRunnerState{runner, metaData}
+    GtAbstractProcessRunnerState{session, metaData}
 {
     setObjectName("FinishedTaskState");
 }
@@ -419,9 +431,9 @@ GtFinishedTaskProcessRunnerState::handleCommand(Command& command)
 }
 
 GtCollectedProcessRunnerState::GtCollectedProcessRunnerState(
-        QPointer<GtRemoteProcessRunner> runner,
+        QPointer<GtRemoteProcessRunnerSession> session,
         gt::process_runner::MetaData* metaData) :
-    GtAbstractProcessRunnerState{runner, metaData}
+    GtAbstractProcessRunnerState{session, metaData}
 {
     setObjectName("CollectedState");
 }
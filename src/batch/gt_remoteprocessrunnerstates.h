@@ -16,7 +16,7 @@
 #include <QObject>
 
 class GtProcessRunnerCommand;
-class GtRemoteProcessRunner;
+class GtRemoteProcessRunnerSession;
 class GtAbstractProcessRunnerState;
 
 namespace gt
@@ -27,7 +27,7 @@ namespace process_runner
 
 /**
  * @brief The MetaData struct
- * Meta data for the state handlers
+ * Meta data for the state handlers. Each session has its own meta data.
  */
 struct MetaData
 {
@@ -63,16 +63,16 @@ enum StateType
 
 /**
  * @brief Creates and returns a pointer to the new state handler. State is owned
- * by the runner.
+ * by the session.
  * @param state Next state
  * @param metaData Meta data for the state
- * @param runner Process runner
+ * @param session Session of the process runner
  * @return Pointer to state
  */
-QPointer<GtAbstractProcessRunnerState> makeState(State state,
-                                                 MetaData& metaData,
-                                                 GtRemoteProcessRunner& runner
-                                                 ) noexcept(false);
+QPointer<GtAbstractProcessRunnerState> makeState(
+        State state,
+        MetaData& metaData,
+        GtRemoteProcessRunnerSession& session) noexcept(false);
 
 
 } // namespace process_runner
@@ -141,14 +141,14 @@ protected:
 
     /**
      * @brief constructor
-     * @param runner Pointer to runner (may not be null)
+     * @param session Pointer to session (may not be null)
      * @param metaData Pointer to meta data (may not be null)
      */
-    GtAbstractProcessRunnerState(QPointer<GtRemoteProcessRunner> runner,
+    GtAbstractProcessRunnerState(QPointer<GtRemoteProcessRunnerSession> session,
                                  gt::process_runner::MetaData* metaData);
 
-    /// pointer to runner instance
-    QPointer<GtRemoteProcessRunner> m_runner{};
+    /// pointer to session instance
+    QPointer<GtRemoteProcessRunnerSession> m_session{};
 
     /// pointer to meta data
     gt::process_runner::MetaData* m_metaData{};
@@ -175,7 +175,7 @@ class GtUninitializedProcessRunnerState : public GtAbstractProcessRunnerState
 public:
 
     explicit GtUninitializedProcessRunnerState(
-                                 QPointer<GtRemoteProcessRunner> runner,
+                                 QPointer<GtRemoteProcessRunnerSession> session,
                                  gt::process_runner::MetaData* metaData = {});
 
     gt::process_runner::StateType stateType() const override
@@ -205,7 +205,7 @@ class GtInitializedProcessRunnerState : public GtAbstractProcessRunnerState
 
 public:
 
-    GtInitializedProcessRunnerState(QPointer<GtRemoteProcessRunner> runner,
+    GtInitializedProcessRunnerState(QPointer<GtRemoteProcessRunnerSession> session,
                                     gt::process_runner::MetaData* metaData);
 
     gt::process_runner::State state() const override
@@ -230,7 +230,7 @@ class GtRunningTaskProcessRunnerState : public GtAbstractProcessRunnerState
 
 public:
 
-    GtRunningTaskProcessRunnerState(QPointer<GtRemoteProcessRunner> runner,
+    GtRunningTaskProcessRunnerState(QPointer<GtRemoteProcessRunnerSession> session,
                                     gt::process_runner::MetaData* metaData);
 
     gt::process_runner::State state() const override
@@ -255,7 +255,7 @@ class GtFinishedTaskProcessRunnerState : public GtAbstractProcessRunnerState
 
 public:
 
-    GtFinishedTaskProcessRunnerState(QPointer<GtRemoteProcessRunner> runner,
+    GtFinishedTaskProcessRunnerState(QPointer<GtRemoteProcessRunnerSession> session,
                                      gt::process_runner::MetaData* metaData);
 
     gt::process_runner::State state() const override
@@ -280,7 +280,7 @@ class GtCollectedProcessRunnerState : public GtAbstractProcessRunnerState
 
 public:
 
-    GtCollectedProcessRunnerState(QPointer<GtRemoteProcessRunner> runner,
+    GtCollectedProcessRunnerState(QPointer<GtRemoteProcessRunnerSession> session,
                                   gt::process_runner::MetaData* metaData);
 
     gt::process_runner::StateType stateType() const override
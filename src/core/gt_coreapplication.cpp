@@ -40,6 +40,7 @@
 #include "gt_algorithms.h"
 #include "gt_moduleinterface.h"
 #include "gt_taskgroup.h"
+#include "internal/gt_startupprofiler.h"
 
 #include <gt_logdest.h>
 
@@ -154,6 +155,8 @@ GtCoreApplication::init()
         return;
     }
 
+    auto phase = gt::detail::startupPhase(QStringLiteral("init application"));
+
     m_self = this;
 
     initLogging();
@@ -228,18 +231,24 @@ GtCoreApplication::loadLastSession()
 void
 GtCoreApplication::initDatamodel()
 {
+    auto phase = gt::detail::startupPhase(QStringLiteral("init data model"));
+
     gtObjectFactory;
 }
 
 void
 GtCoreApplication::initCalculators()
 {
+    auto phase = gt::detail::startupPhase(QStringLiteral("init calculators"));
+
     gtProcessFactory;
 }
 
 void
 GtCoreApplication::initLanguage()
 {
+    auto phase = gt::detail::startupPhase(QStringLiteral("init language"));
+
     QString language = settings()->language();
 
     if (language.isEmpty())
@@ -255,6 +264,8 @@ GtCoreApplication::initLanguage()
 void
 GtCoreApplication::initSession(const QString& id)
 {
+    auto phase = gt::detail::startupPhase(QStringLiteral("init session"));
+
     if (!m_session)
     {
         // load session info
@@ -511,6 +522,8 @@ GtCoreApplication::deleteSession(const QString& id)
 void
 GtCoreApplication::loadModules()
 {
+    auto phase = gt::detail::startupPhase(QStringLiteral("load modules"));
+
     if (!m_moduleLoader)
     {
         m_moduleLoader = std::make_unique<GtCoreModuleLoader>();
@@ -784,6 +797,8 @@ GtCoreApplication::checkLicence()
 void
 GtCoreApplication::initModules()
 {
+    auto phase = gt::detail::startupPhase(QStringLiteral("init modules"));
+
     if (m_moduleLoader)
     {
         m_moduleLoader->initModules();
@@ -793,6 +808,9 @@ GtCoreApplication::initModules()
 void
 GtCoreApplication::saveSystemEnvironment() const
 {
+     auto phase = gt::detail::startupPhase(
+                 QStringLiteral("save system environment"));
+
      QMap<QString, QString> modEnv = GtModuleLoader::moduleEnvironmentVars();
 
      gt::for_each_key(modEnv, [](const QString& e)
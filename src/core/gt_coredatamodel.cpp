@@ -24,6 +24,62 @@
 
 #include "gt_coredatamodel.h"
 
+namespace
+{
+
+/// mime type of the object data in the binary memento format
+const QString S_BINARY_MIME_TYPE = QStringLiteral("GtObjectBinary");
+
+/// mime type of the object data in the xml memento format
+const QString S_XML_MIME_TYPE = QStringLiteral("GtObject");
+
+/**
+ * @brief Mime data of an object. The binary memento format is set directly,
+ * the xml format is only created if it is requested (e.g. by another
+ * application or an older GTlab version).
+ */
+class ObjectMimeData : public QMimeData
+{
+public:
+
+    explicit ObjectMimeData(GtObjectMemento memento) :
+        m_memento(std::move(memento))
+    {
+        setData(S_BINARY_MIME_TYPE, m_memento.toBinary());
+    }
+
+    QStringList formats() const override
+    {
+        QStringList retval = QMimeData::formats();
+        retval << S_XML_MIME_TYPE;
+        return retval;
+    }
+
+    bool hasFormat(const QString& mimeType) const override
+    {
+        return mimeType == S_XML_MIME_TYPE || QMimeData::hasFormat(mimeType);
+    }
+
+protected:
+
+    QVariant retrieveData(const QString& mimeType,
+                          QVariant::Type type) const override
+    {
+        if (mimeType == S_XML_MIME_TYPE)
+        {
+            return m_memento.toByteArray();
+        }
+
+        return QMimeData::retrieveData(mimeType, type);
+    }
+
+private:
+
+    GtObjectMemento m_memento;
+};
+
+} // namespace
+
 GtCoreDatamodel* GtCoreDatamodel::m_self = 0;
 
 GtCoreDatamodel::GtCoreDatamodel(QObject* parent) : QAbstractItemModel(parent),
@@ -142,6 +198,25 @@ GtCoreDatamodel::initProjectStates(GtProject* project)
                                     project->objectPath(),
                                     false, project);
 
+    // initialize storage layout states of externalized data
+    GtState* chunkedState = gtStateHandler->initializeState(project,
+                                    QStringLiteral("ExternalizationSettings"),
+                                    QStringLiteral("Chunked Layout"),
+                                    project->objectPath() + ";chunkedLayout",
+                                    false, project);
+
+    GtState* compressionState = gtStateHandler->initializeState(project,
+                                    QStringLiteral("ExternalizationSettings"),
+                                    QStringLiteral("Compression Level"),
+                                    project->objectPath() + ";compressionLevel",
+                                    0, project);
+
+    GtState* shuffleState = gtStateHandler->initializeState(project,
+                                    QStringLiteral("ExternalizationSettings"),
+                                    QStringLiteral("Shuffle Filter"),
+                                    project->objectPath() + ";shuffleFilter",
+                                    false, project);
+
     // initialize last task group state
     gtStateHandler->initializeState(project,
                                     QStringLiteral("Project Settings"),
@@ -151,11 +226,23 @@ GtCoreDatamodel::initProjectStates(GtProject* project)
 
     // set init values
     gtExternalizationManager->enableExternalization(enableState->getValue());
+    gtExternalizationManager->enableChunkedLayout(chunkedState->getValue());
+    gtExternalizationManager->setCompressionLevel(compressionState->getValue());
+    gtExternalizationManager->enableShuffle(shuffleState->getValue());
 
     // update values if states change
     connect(enableState, SIGNAL(valueChanged(const QVariant&)),
             gtExternalizationManager,
             SLOT(enableExternalization(const QVariant&)));
+    connect(chunkedState, SIGNAL(valueChanged(const QVariant&)),
+            gtExternalizationManager,
+            SLOT(enableChunkedLayout(const QVariant&)));
+    connect(compressionState, SIGNAL(valueChanged(const QVariant&)),
+            gtExternalizationManager,
+            SLOT(setCompressionLevel(const QVariant&)));
+    connect(shuffleState, SIGNAL(valueChanged(const QVariant&)),
+            gtExternalizationManager,
+            SLOT(enableShuffle(const QVariant&)));
 }
 
 GtSession*
@@ -507,7 +594,7 @@ GtCoreDatamodel::rowCount(const QModelIndex& parent) const
     }
 
     // return number of child objects
-    return parentItem->findDirectChildren<GtObject*>().size();
+    return parentItem->childCount<GtObject*>();
 }
 
 QModelIndex
@@ -546,17 +633,8 @@ GtCoreDatamodel::index(int row, int col, const QModelIndex& parent) const
         return {};
     }
 
-    QList<GtObject*> childItems =
-            parentItem->findDirectChildren<GtObject*>();
-
-    // check array size
-    if (row >= childItems.size())
-    {
-        return {};
-    }
-
     // get child object corresponding to row number
-    GtObject* childItem = childItems[row];
+    GtObject* childItem = parentItem->childAt(row);
 
     // check object
     if (!childItem)
@@ -743,33 +821,38 @@ GtCoreDatamodel::mimeDataFromObject(GtObject* obj, bool newUuid) const
     // create memento
     GtObjectMemento memento = obj->toMemento(!newUuid);
 
-    QMimeData* mimeData = new QMimeData;
-
-    // append memento to mime data
-    mimeData->setData(QStringLiteral("GtObject"), memento.toByteArray());
-
     // return mime data
-    return mimeData;
+    return new ObjectMimeData(std::move(memento));
 }
 
-GtObject*
-GtCoreDatamodel::objectFromMimeData(const QMimeData* mime, bool newUuid,
-                                    GtAbstractObjectFactory* factory)
+GtObjectMemento
+GtCoreDatamodel::mementoFromMimeData(const QMimeData* mime)
 {
-    // check mime data
     if (!mime)
     {
-        return nullptr;
+        return GtObjectMemento{};
     }
 
-    // check mime data format
-    if (!mime->hasFormat(QStringLiteral("GtObject")))
+    // the binary format is faster to restore
+    if (mime->hasFormat(S_BINARY_MIME_TYPE))
     {
-        return nullptr;
+        return GtObjectMemento(mime->data(S_BINARY_MIME_TYPE));
+    }
+
+    if (mime->hasFormat(S_XML_MIME_TYPE))
+    {
+        return GtObjectMemento(mime->data(S_XML_MIME_TYPE));
     }
 
+    return GtObjectMemento{};
+}
+
+GtObject*
+GtCoreDatamodel::objectFromMimeData(const QMimeData* mime, bool newUuid,
+                                    GtAbstractObjectFactory* factory)
+{
     // restore memento from mime data
-    GtObjectMemento memento(mime->data(QStringLiteral("GtObject")));
+    GtObjectMemento memento = mementoFromMimeData(mime);
 
     // check memento
     if (memento.isNull())
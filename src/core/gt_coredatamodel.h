@@ -25,6 +25,7 @@ class GtSession;
 class GtProject;
 class GtObject;
 class GtAbstractObjectFactory;
+class GtObjectMemento;
 
 /**
  * @brief The GtCoreDatamodel class
@@ -213,7 +214,9 @@ public:
     QMimeData* mimeData(const QModelIndexList& indexes) const override;
 
     /**
-     * @brief Creates mime data based ob given object.
+     * @brief Creates mime data based ob given object. The object data is
+     * provided in the binary memento format ("GtObjectBinary") and in the
+     * xml memento format ("GtObject").
      * @param Object
      * @param Whether object should have a new uuid or not
      * @return Mime data of given object
@@ -227,6 +230,14 @@ public:
      * @param Factory for object creation
      * @return Recreated object
      */
+    /**
+     * @brief Creates the memento of the object data of the given mime data.
+     * The binary memento format is preferred.
+     * @param mime Mime data
+     * @return Memento. Null if the mime data does not contain object data
+     */
+    static GtObjectMemento mementoFromMimeData(const QMimeData* mime);
+
     GtObject* objectFromMimeData(const QMimeData* mime,
                                  bool newUuid = false,
                                  GtAbstractObjectFactory* factory = nullptr);
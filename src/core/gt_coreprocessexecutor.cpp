@@ -8,9 +8,13 @@
  *  Tel.: +49 2203 601 2907
  */
 
+#include <algorithm>
+
 #include <QDir>
 #include <QElapsedTimer>
 #include <QEventLoop>
+#include <QFile>
+#include <QtConcurrent>
 
 #include "gt_logging.h"
 #include "gt_runnable.h"
@@ -21,11 +25,14 @@
 #include "gt_objectmementodiff.h"
 #include "gt_coreapplication.h"
 #include "gt_taskrunner.h"
+#include "gt_settings.h"
 
 #include "gt_coreprocessexecutor.h"
 
 const std::string GtCoreProcessExecutor::S_ID = "CoreProcessExecutor";
 
+const int GtCoreProcessExecutor::S_MAX_DIAGNOSTICS_SIZE = 10 * 1024 * 1024;
+
 struct GtCoreProcessExecutor::Impl
 {
     /// save results is used as standard
@@ -42,8 +49,105 @@ struct GtCoreProcessExecutor::Impl
 
     /// Pointer to current runnable
     QPointer<GtRunnable> currentRunnable;
+
+    /// whether the data merged after a task run should be written to the
+    /// temp directory
+    bool captureDiagnostics{false};
+
+    /// maximum number of concurrently running tasks (0 = preference)
+    int maxConcurrentTasks{0};
+
+    /// whether a blocking call is waiting for all concurrent tasks
+    bool waiting{false};
+
+    /// task running in concurrent mode
+    struct RunningTask
+    {
+        /// original task
+        QPointer<GtTask> task;
+        /// task runner of the task
+        QPointer<GtTaskRunner> runner;
+        /// runnable of the task
+        QPointer<GtRunnable> runnable;
+        /// source/root object of the data objects of the task
+        QPointer<GtObject> source;
+        /// linked source objects of the task
+        QList<QPointer<GtObject>> sourceObjects;
+        /// objects merged by other tasks since the task was started
+        QList<QPointer<GtObject>> foreignWrites;
+    };
+
+    /// tasks running in concurrent mode
+    QList<RunningTask> running;
+
+    int indexOf(GtTask const* task) const
+    {
+        auto iter = std::find_if(running.begin(), running.end(),
+                                 [task](RunningTask const& entry) {
+            return entry.task == task;
+        });
+        return iter == running.end() ? -1 : static_cast<int>(
+                                       std::distance(running.begin(), iter));
+    }
+
+    int indexOf(GtTaskRunner const* runner) const
+    {
+        auto iter = std::find_if(running.begin(), running.end(),
+                                 [runner](RunningTask const& entry) {
+            return entry.runner == runner;
+        });
+        return iter == running.end() ? -1 : static_cast<int>(
+                                       std::distance(running.begin(), iter));
+    }
+};
+
+namespace
+{
+
+/// timings (in ms) and sizes of the merge phases
+struct MergeReport
+{
+    /// number of merged objects
+    int objects{0};
+    /// time to serialize the target objects
+    qint64 serializeTime{0};
+    /// time to create the diffs
+    qint64 diffTime{0};
+    /// time to apply the sum diff
+    qint64 applyTime{0};
 };
 
+/// returns whether obj is equal to or a (grand) child of parent
+bool
+isWithin(GtObject const* obj, GtObject const* parent)
+{
+    for (; obj; obj = obj->parentObject())
+    {
+        if (obj == parent) return true;
+    }
+    return false;
+}
+
+/// returns whether any object of a is equal to, a parent or a child of any
+/// object of b
+template <typename ListA, typename ListB>
+bool
+overlaps(ListA const& a, ListB const& b)
+{
+    for (GtObject const* objA : a)
+    {
+        for (GtObject const* objB : b)
+        {
+            if (!objA || !objB) continue;
+
+            if (isWithin(objA, objB) || isWithin(objB, objA)) return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
 GtCoreProcessExecutor::GtCoreProcessExecutor(QObject* parent, Flags flags) :
     QObject(parent),
     m_current(nullptr),
@@ -62,6 +166,43 @@ GtCoreProcessExecutor::setCoreExecutorFlags(Flags flags)
 {
     pimpl->save     = !flags.testFlag(gt::DryExecution);
     pimpl->detached =  flags.testFlag(gt::NonBlockingExecution);
+    pimpl->captureDiagnostics = flags.testFlag(gt::CaptureMergeDiagnostics);
+}
+
+void
+GtCoreProcessExecutor::setMaxConcurrentTasks(int count)
+{
+    pimpl->maxConcurrentTasks = std::max(0, count);
+}
+
+int
+GtCoreProcessExecutor::maxConcurrentTasks() const
+{
+    if (pimpl->maxConcurrentTasks > 0)
+    {
+        return pimpl->maxConcurrentTasks;
+    }
+
+    return std::max(1, preferredMaxConcurrentTasks());
+}
+
+int
+GtCoreProcessExecutor::preferredMaxConcurrentTasks() const
+{
+    if (gtApp && gtApp->settings())
+    {
+        return gtApp->settings()->maxConcurrentTasks();
+    }
+
+    return 1;
+}
+
+bool
+GtCoreProcessExecutor::concurrentMode() const
+{
+    // tasks which are already running are finished in concurrent mode
+    return !pimpl->running.isEmpty() ||
+           (maxConcurrentTasks() > 1 && supportsConcurrentExecution());
 }
 
 bool
@@ -74,7 +215,7 @@ GtCoreProcessExecutor::runTask(GtTask* task)
         return false;
     }
 
-    if (taskCurrentlyRunning())
+    if (taskCurrentlyRunning() && !concurrentMode())
     {
         return true;
     }
@@ -85,6 +226,30 @@ GtCoreProcessExecutor::runTask(GtTask* task)
 bool
 GtCoreProcessExecutor::executeNextTask()
 {
+    if (concurrentMode())
+    {
+        if (!startConcurrentTasks())
+        {
+            emit allTasksCompleted();
+            return false;
+        }
+
+        // block until all tasks have been executed
+        if (!pimpl->detached && !pimpl->waiting)
+        {
+            QEventLoop eventLoop;
+
+            connect(this, &GtCoreProcessExecutor::allTasksCompleted,
+                    &eventLoop, &QEventLoop::quit);
+
+            pimpl->waiting = true;
+            eventLoop.exec();
+            pimpl->waiting = false;
+        }
+
+        return true;
+    }
+
     // check whether a task is already running
     if (taskCurrentlyRunning())
     {
@@ -135,6 +300,20 @@ GtCoreProcessExecutor::executeNextTask()
 bool
 GtCoreProcessExecutor::terminateTask(GtTask* task)
 {
+    if (concurrentMode())
+    {
+        int idx = pimpl->indexOf(task);
+
+        if (!task || idx < 0 || !pimpl->running.at(idx).runnable)
+        {
+            gtWarningId(GT_EXEC_ID) << tr("Invalid task to terminate!");
+            return false;
+        }
+
+        pimpl->running.at(idx).runnable->requestInterruption();
+        return true;
+    }
+
     if (!m_current || m_current != task)
     {
         gtWarningId(GT_EXEC_ID) << tr("Invalid task to terminate!");
@@ -147,6 +326,22 @@ GtCoreProcessExecutor::terminateTask(GtTask* task)
 bool
 GtCoreProcessExecutor::terminateAllTasks()
 {
+    if (concurrentMode())
+    {
+        // keep the running tasks in the queue until they have finished
+        m_queue.erase(std::remove_if(m_queue.begin(), m_queue.end(),
+                                     [this](QPointer<GtTask> const& task) {
+            return pimpl->indexOf(task.data()) < 0;
+        }), m_queue.end());
+
+        bool success = true;
+        for (auto const& entry : qAsConst(pimpl->running))
+        {
+            success &= terminateTask(entry.task);
+        }
+        return success;
+    }
+
     m_queue.clear();
 
     return !taskCurrentlyRunning() || terminateTask(m_current);
@@ -155,13 +350,18 @@ GtCoreProcessExecutor::terminateAllTasks()
 GtTask*
 GtCoreProcessExecutor::currentRunningTask()
 {
+    for (auto const& entry : qAsConst(pimpl->running))
+    {
+        if (entry.task) return entry.task;
+    }
+
     return m_current;
 }
 
 bool
 GtCoreProcessExecutor::taskCurrentlyRunning()
 {
-    return currentRunningTask();
+    return m_current || !pimpl->running.isEmpty();
 }
 
 bool
@@ -277,6 +477,12 @@ GtCoreProcessExecutor::setCustomProjectPath(QString projectPath)
     return true;
 }
 
+bool
+GtCoreProcessExecutor::supportsConcurrentExecution() const
+{
+    return true;
+}
+
 bool
 GtCoreProcessExecutor::terminateCurrentTask()
 {
@@ -327,9 +533,8 @@ GtCoreProcessExecutor::handleTaskFinishedHelper(
     // calculators included in the task
     if (m_source)
     {
-        QDir tempDir;
-
-        tempDir = gtApp->applicationTempDir();
+        MergeReport report;
+        QElapsedTimer timer;
 
         GtObjectMementoDiff sumDiff;
 
@@ -339,46 +544,49 @@ GtCoreProcessExecutor::handleTaskFinishedHelper(
         {
             gtDebugId(GT_EXEC_ID).medium() << "analysing changed data...";
 
+            timer.start();
             GtObject* target = m_source->getObjectByUuid(memento.uuid());
 
-            if (target)
+            if (!target)
             {
-                gtDebugId(GT_EXEC_ID).medium()
-                        << "target found =" << target->objectName();
-
-                GtObjectMemento old = target->toMemento(true);
-                GtObjectMementoDiff diff(old, memento);
+                gtWarningId(GT_EXEC_ID) << tr("Target for memento diff not found");
+                ok = false;
+                continue;
+            }
 
-                QString filename = target->objectName() +
-                                   QStringLiteral(".xml");
+            gtDebugId(GT_EXEC_ID).medium()
+                    << "target found =" << target->objectName();
 
-                QFile file(tempDir.absoluteFilePath(filename));
+            GtObjectMemento old = target->toMemento(true);
+            report.serializeTime += timer.restart();
 
-                if (file.open(QFile::WriteOnly))
-                {
-                    QTextStream TextStream(&file);
-                    TextStream << diff.toByteArray();
-                    TextStream << "######### new";
-                    TextStream << memento.toByteArray();
-                    TextStream << "######### old";
-                    TextStream << old.toByteArray();
-                    file.close();
-                }
+            GtObjectMementoDiff diff(old, memento);
+            report.diffTime += timer.elapsed();
+            report.objects++;
 
-                sumDiff << diff;
-            }
-            else
+            if (pimpl->captureDiagnostics)
             {
-                gtWarningId(GT_EXEC_ID) << tr("Target for memento diff not found");
-                ok = false;
+                captureMergeDiagnostics(target->objectName(), diff,
+                                        memento, old);
             }
+
+            sumDiff << diff;
         }
 
+        timer.start();
         if (!m_source->applyDiff(sumDiff))
         {
             gtWarningId(GT_EXEC_ID) << tr("Failed to apply memento diff!");
             ok = false;
         }
+        report.applyTime = timer.elapsed();
+
+        gtDebugId(GT_EXEC_ID).nospace()
+                << "merge report (" << task->objectName() << "): "
+                << report.objects << " objects, "
+                << "serialize " << report.serializeTime << " ms, "
+                << "diff " << report.diffTime << " ms, "
+                << "apply " << report.applyTime << " ms";
     }
 
     if (!ok)
@@ -392,6 +600,55 @@ GtCoreProcessExecutor::handleTaskFinishedHelper(
     gtDebugId(GT_EXEC_ID).medium() << __FUNCTION__ << "end";
 }
 
+void
+GtCoreProcessExecutor::captureMergeDiagnostics(const QString& name,
+                                               const GtObjectMementoDiff& diff,
+                                               const GtObjectMemento& newData,
+                                               const GtObjectMemento& oldData)
+{
+    QByteArray content = diff.toByteArray();
+
+    if (content.size() > S_MAX_DIAGNOSTICS_SIZE)
+    {
+        gtWarningId(GT_EXEC_ID)
+                << tr("Merge diagnostics of '%1' exceed the size limit, "
+                      "skipping...").arg(name);
+        return;
+    }
+
+    // the full mementos are only written for small objects
+    QByteArray newContent = newData.toByteArray();
+    QByteArray oldContent = oldData.toByteArray();
+
+    if (content.size() + newContent.size() + oldContent.size() <=
+        S_MAX_DIAGNOSTICS_SIZE)
+    {
+        content += "######### new";
+        content += newContent;
+        content += "######### old";
+        content += oldContent;
+    }
+
+    const QString filePath =
+            gtApp->applicationTempDir().absoluteFilePath(
+                name + QStringLiteral(".xml"));
+
+    // written asynchronously to not block the merge
+    QtConcurrent::run([filePath, content](){
+        QFile file(filePath);
+
+        if (!file.open(QFile::WriteOnly))
+        {
+            gtWarningId(GT_EXEC_ID)
+                    << QObject::tr("Could not write merge diagnostics (%1)")
+                       .arg(filePath);
+            return;
+        }
+
+        file.write(content);
+    });
+}
+
 void
 GtCoreProcessExecutor::clearCurrentTask()
 {
@@ -487,10 +744,27 @@ GtCoreProcessExecutor::onTaskRunnerFinished()
         return;
     }
 
+    // in concurrent mode the finished task is looked up by its runner
+    int running = pimpl->indexOf(taskRunner);
+
+    // a source set explicitly is restored after merging
+    QPointer<GtObject> source = m_source;
+
+    if (running >= 0)
+    {
+        m_current = pimpl->running.at(running).task;
+        m_source = pimpl->running.at(running).source;
+    }
+
     // check current task
     if (!m_current)
     {
         gtFatalId(GT_EXEC_ID) << tr("Current task corrupted!");
+        if (running >= 0)
+        {
+            pimpl->running.removeAt(running);
+            m_source = source;
+        }
         taskRunner->deleteLater();
         return;
     }
@@ -501,6 +775,8 @@ GtCoreProcessExecutor::onTaskRunnerFinished()
 
     QList<GtObjectMemento> changedData = taskRunner->dataToMerge();
 
+    bool merged = false;
+
     if (pimpl->save)
     {
         gtInfoId(GT_EXEC_ID).medium()
@@ -511,8 +787,42 @@ GtCoreProcessExecutor::onTaskRunnerFinished()
         if (finishedTask->currentState() == GtProcessComponent::FINISHED ||
             finishedTask->currentState() == GtProcessComponent::WARN_FINISHED)
         {
-            handleTaskFinishedHelper(changedData, finishedTask);
+            if (running >= 0 && hasWriteConflict(changedData, finishedTask))
+            {
+                gtErrorId(GT_EXEC_ID)
+                        << tr("Data changes from the task '%1' conflict with "
+                              "the changes of a concurrently executed task "
+                              "and are not merged!")
+                           .arg(finishedTask->objectName());
+                finishedTask->setState(GtProcessComponent::FAILED);
+            }
+            else
+            {
+                handleTaskFinishedHelper(changedData, finishedTask);
+                merged = true;
+            }
+        }
+    }
+
+    if (running >= 0)
+    {
+        pimpl->running.removeAt(running);
+
+        // notify the other running tasks about the merged objects
+        for (GtObjectMemento const& memento : qAsConst(changedData))
+        {
+            GtObject* target = merged && m_source ?
+                        m_source->getObjectByUuid(memento.uuid()) : nullptr;
+
+            if (!target) continue;
+
+            for (auto& entry : pimpl->running)
+            {
+                entry.foreignWrites.append(target);
+            }
         }
+
+        m_source = source;
     }
 
     gtInfoId(GT_EXEC_ID).medium()
@@ -520,10 +830,158 @@ GtCoreProcessExecutor::onTaskRunnerFinished()
                .arg(timer.elapsed());
 
     // reset source
-    m_source.clear();
+    if (pimpl->running.isEmpty())
+    {
+        m_source.clear();
+    }
 
     // delete task runner
     taskRunner->deleteLater();
 
     executeNextTask();
 }
+
+bool
+GtCoreProcessExecutor::startConcurrentTasks()
+{
+    // linked source objects of the running and of the postponed tasks
+    QList<GtObject*> blocked;
+
+    for (auto const& entry : qAsConst(pimpl->running))
+    {
+        for (GtObject* obj : entry.sourceObjects)
+        {
+            if (obj) blocked.append(obj);
+        }
+    }
+
+    // iterate over a copy, as invalid tasks are removed from the queue
+    QList<QPointer<GtTask>> const queue = m_queue;
+
+    for (auto const& task : queue)
+    {
+        if (pimpl->running.size() >= maxConcurrentTasks())
+        {
+            break;
+        }
+
+        // already running
+        if (task && pimpl->indexOf(task.data()) >= 0)
+        {
+            continue;
+        }
+
+        // double check task
+        if (!task || task->hasDummyChildren())
+        {
+            gtErrorId(GT_EXEC_ID) << tr("Cannot execute an invalid Task!");
+            m_current = task;
+            clearCurrentTask();
+            continue;
+        }
+
+        // a source set explicitly is used for all tasks, otherwise each
+        // task uses its own project
+        GtObject* source = m_source ? m_source.data()
+                                    : task->findParent<GtProject*>();
+
+        if (!source)
+        {
+            gtErrorId(GT_EXEC_ID) << tr("Source corrupted!");
+            m_current = task;
+            clearCurrentTask();
+            continue;
+        }
+
+        QList<GtObject*> sourceObjects =
+                GtTaskRunner::collectSourceData(*task, *source);
+
+        // tasks sharing data are executed in order of the queue
+        bool conflict = overlaps(sourceObjects, blocked);
+        blocked.append(sourceObjects);
+
+        if (conflict)
+        {
+            gtDebugId(GT_EXEC_ID).medium()
+                    << tr("Postponing task '%1', as it shares data with "
+                          "another task").arg(task->objectName());
+            continue;
+        }
+
+        startConcurrentTask(task, *source, sourceObjects);
+    }
+
+    emit queueChanged();
+
+    return !pimpl->running.isEmpty();
+}
+
+bool
+GtCoreProcessExecutor::startConcurrentTask(
+        GtTask* task, GtObject& source, QList<GtObject*> const& sourceObjects)
+{
+    assert(task);
+
+    gtInfoId(GT_EXEC_ID)
+        << tr("----> Running Task '%1' (source: %2) <----")
+               .arg(task->objectName(),
+                    source.objectName());
+
+    auto* runner = new GtTaskRunner{task};
+    auto* runnable = new GtRunnable{pimpl->customProjectPath};
+
+    if (!runner->setUp(runnable, &source))
+    {
+        delete runnable;
+        delete runner;
+        m_current = task;
+        clearCurrentTask();
+        return false;
+    }
+
+    connect(runner, &GtTaskRunner::finished,
+            this, &GtCoreProcessExecutor::onTaskRunnerFinished);
+
+    Impl::RunningTask entry;
+    entry.task = task;
+    entry.runner = runner;
+    entry.runnable = runnable;
+    entry.source = &source;
+
+    for (GtObject* obj : sourceObjects)
+    {
+        entry.sourceObjects.append(obj);
+    }
+
+    pimpl->running.append(entry);
+
+    runner->run();
+
+    return true;
+}
+
+bool
+GtCoreProcessExecutor::hasWriteConflict(
+        QList<GtObjectMemento> const& changedData, GtTask* task) const
+{
+    int idx = pimpl->indexOf(task);
+
+    if (idx < 0 || !pimpl->running.at(idx).source)
+    {
+        return false;
+    }
+
+    auto const& entry = pimpl->running.at(idx);
+
+    QList<GtObject*> targets;
+
+    for (GtObjectMemento const& memento : changedData)
+    {
+        if (GtObject* target = entry.source->getObjectByUuid(memento.uuid()))
+        {
+            targets.append(target);
+        }
+    }
+
+    return overlaps(targets, entry.foreignWrites);
+}
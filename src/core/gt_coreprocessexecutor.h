@@ -24,6 +24,7 @@ class GtTask;
 class GtRunnable;
 class GtCalculator;
 class GtTaskRunner;
+class GtObjectMementoDiff;
 
 class GtObjectLinkProperty;
 
@@ -39,7 +40,10 @@ enum CoreProcessExecutorFlag
     /// Do not save process results on successful execution
     DryExecution = 1,
     /// Whether a task run should be blocking or not
-    NonBlockingExecution = 2
+    NonBlockingExecution = 2,
+    /// Writes the data merged after a task run to the temp directory
+    /// (for diagnostic purposes only)
+    CaptureMergeDiagnostics = 4
 };
 
 }
@@ -53,6 +57,9 @@ public:
     /// Id of this executor
     static const std::string S_ID;
 
+    /// Maximum size (in bytes) of a single merge diagnostics file
+    static const int S_MAX_DIAGNOSTICS_SIZE;
+
     Q_DECLARE_FLAGS(Flags, gt::CoreProcessExecutorFlag)
 
     /**
@@ -68,6 +75,25 @@ public:
 
     void setCoreExecutorFlags(Flags flags);
 
+    /**
+     * @brief Sets the maximum number of tasks which may be executed
+     * concurrently. Queued tasks are only started in parallel if their
+     * linked source objects do not overlap with those of the running tasks
+     * or of the tasks queued in front of them. The results are merged in
+     * order of completion. By default (0) the application preference is
+     * used, which defaults to sequential execution. Has no effect if the
+     * executor does not support concurrent execution.
+     * @param count Maximum number of concurrently running tasks (0 uses the
+     * application preference)
+     */
+    void setMaxConcurrentTasks(int count);
+
+    /**
+     * @brief Returns the maximum number of concurrently running tasks
+     * @return Maximum number of concurrently running tasks
+     */
+    int maxConcurrentTasks() const;
+
     /**
      * @brief Runs a process if the queue is free
      * @param process GtdProcess
@@ -94,14 +120,15 @@ public:
     bool terminateAllTasks();
 
     /**
-     * @brief currentRunningTask
-     * @return
+     * @brief Returns the current running task. In concurrent mode, the
+     * running task which was started first is returned.
+     * @return Current running task
      */
     GtTask* currentRunningTask();
 
     /**
      * @brief Returns true if a task is currently running. Otherwise
-     * false is returned.
+     * false is returned. In concurrent mode, any running task counts.
      * @return Whether a task is currently running or not.
      */
     bool taskCurrentlyRunning();
@@ -188,6 +215,21 @@ protected:
      */
     virtual void execute();
 
+    /**
+     * @brief Returns whether this executor is able to run several tasks
+     * concurrently. Executors relying on a single current task (m_current)
+     * must return false.
+     * @return Whether concurrent execution is supported
+     */
+    virtual bool supportsConcurrentExecution() const;
+
+    /**
+     * @brief Returns the maximum number of concurrently running tasks set in
+     * the application preferences. Used if no limit was set explicitly.
+     * @return Maximum number of concurrently running tasks (at least 1)
+     */
+    virtual int preferredMaxConcurrentTasks() const;
+
     /**
      * @brief Virtual method to implement for terminating the current task.
      * Current task is guaranteed to be valid (not null)
@@ -203,6 +245,21 @@ protected:
     virtual void handleTaskFinishedHelper(QList<GtObjectMemento>& changedData,
                                           GtTask* task);
 
+    /**
+     * @brief Writes the diff and the mementos of a merged object
+     * asynchronously to the temp directory. The mementos are omitted if the
+     * file would exceed S_MAX_DIAGNOSTICS_SIZE. Only used if the flag
+     * CaptureMergeDiagnostics is set.
+     * @param name Name of the merged object
+     * @param diff Diff of the object
+     * @param newData Memento created by the task
+     * @param oldData Memento of the target object
+     */
+    void captureMergeDiagnostics(const QString& name,
+                                 const GtObjectMementoDiff& diff,
+                                 const GtObjectMemento& newData,
+                                 const GtObjectMemento& oldData);
+
     /**
      * @brief Clears the current task and removes it from the queue. If a task
      * was set, its is made ready (i.e. its state is updated accordingly).
@@ -221,6 +278,41 @@ private:
     struct Impl;
     std::unique_ptr<Impl> pimpl;
 
+    /**
+     * @brief Returns whether tasks are executed concurrently
+     * @return Whether tasks are executed concurrently
+     */
+    bool concurrentMode() const;
+
+    /**
+     * @brief Starts as many queued tasks as possible without exceeding the
+     * maximum number of concurrent tasks. Tasks sharing linked objects with
+     * a running task or with a task queued in front of them are postponed.
+     * @return Whether at least one task is running
+     */
+    bool startConcurrentTasks();
+
+    /**
+     * @brief Sets up and starts the task runner of the given task in
+     * concurrent mode.
+     * @param task Task to start
+     * @param source Source/root object of the data objects of the task
+     * @param sourceObjects Linked source objects of the task
+     * @return success
+     */
+    bool startConcurrentTask(GtTask* task, GtObject& source,
+                             QList<GtObject*> const& sourceObjects);
+
+    /**
+     * @brief Checks whether the data changed by the task overlaps with the
+     * data merged by other tasks since the task was started.
+     * @param changedData Data changed by the task
+     * @param task Finished task
+     * @return Whether a write conflict was detected
+     */
+    bool hasWriteConflict(QList<GtObjectMemento> const& changedData,
+                          GtTask* task) const;
+
 private slots:
 
     /**
@@ -48,7 +48,10 @@ public:
 GtFootprint::GtFootprint() :
     m_pimpl{std::make_unique<GtFootprintImpl>()}
 {
-    m_pimpl->m_version = gtApp->version();
+    m_pimpl->m_version = GtCoreApplication::version();
+
+    // no modules are loaded without an application instance
+    if (!gtApp) return;
 
     QStringList mids = gtApp->moduleIds();
     mids.sort();
@@ -12,6 +12,8 @@
 #include <QMimeData>
 #include <QUrl>
 
+#include <algorithm>
+#include <atomic>
 #include <ctime>
 
 #include "gt_coreapplication.h"
@@ -21,34 +23,92 @@
 #include "gt_logging.h"
 #include "gt_logdest.h"
 #include "gt_utilities.h"
+#include "internal/gt_mpscqueue.h"
+#include "internal/gt_ringbuffer.h"
 
 const auto DESTINATION_ID = [](){ return GT_CLASSNAME(GtLogModel); };
 
+namespace
+{
+
+/// interval in which queued messages are inserted into the model (ms)
+constexpr int S_INSERT_INTERVAL = 100;
+
+GtLogDetails
+makeDetails(gt::log::Details const& details)
+{
+    struct tm time = details.time;
+    std::time_t t = std::mktime(&time);
+
+    return GtLogDetails{
+        QString::fromStdString(details.id),
+        QDateTime::fromSecsSinceEpoch(t)
+    };
+}
+
+/**
+ * @brief Logging destination of the log model. Messages are appended to the
+ * queue of the model directly instead of emitting a queued signal for each
+ * message.
+ */
+class LogModelDestination : public gt::log::Destination
+{
+public:
+
+    explicit LogModelDestination(GtLogModel* model) : m_model(model) { }
+
+    void write(std::string const& message,
+               gt::log::Level level,
+               gt::log::Details const& details) override
+    {
+        m_model->onMessage(QString::fromStdString(message),
+                           gt::log::levelToInt(level),
+                           makeDetails(details));
+    }
+
+private:
+
+    GtLogModel* m_model;
+};
+
+} // namespace
+
 void
 GtLogSignalSlotDestination::write(std::string const& message,
                                   gt::log::Level level,
                                   gt::log::Details const& details)
 {
-    struct tm time = details.time;
-    std::time_t t = std::mktime(&time);
-
     emit messageRecieved(
         QString::fromStdString(message),
         gt::log::levelToInt(level),
-        GtLogDetails{
-            QString::fromStdString(details.id),
-            QDateTime::fromSecsSinceEpoch(t)
-        }
+        makeDetails(details)
     );
 }
 
+struct GtLogModel::Impl
+{
+    /// entries of the model (capacity is the maximum log length)
+    gt::detail::RingBuffer<Entry> entries{2000};
+
+    /// messages that have not been inserted into the model yet
+    gt::detail::MpscQueue<Entry> queue;
+
+    /// whether an insertion of the queued messages is pending
+    std::atomic<bool> insertScheduled{false};
+
+    /// limits the rate of insertions
+    QTimer timer;
+};
+
 GtLogModel::GtLogModel() :
-    m_tmpClearLog(false),
-    m_maxEntries(2000)
+    pimpl(std::make_unique<Impl>())
 {
-    setupLoggingDestination();
+    pimpl->timer.setSingleShot(true);
+    pimpl->timer.setInterval(S_INSERT_INTERVAL);
+
+    connect(&pimpl->timer, &QTimer::timeout, this, &GtLogModel::insertQueue);
 
-    connect(&m_timer, SIGNAL(timeout()), SLOT(insertQueue()));
+    setupLoggingDestination();
 
     // set logging length
     if (gtApp)
@@ -60,6 +120,12 @@ GtLogModel::GtLogModel() :
     }
 }
 
+GtLogModel::~GtLogModel()
+{
+    // the destination refers to this model
+    gt::log::Logger::instance().removeDestination(DESTINATION_ID());
+}
+
 GtLogModel&
 GtLogModel::instance()
 {
@@ -72,7 +138,7 @@ GtLogModel::setupLoggingDestination()
 {
     gt::log::Logger& logger = gt::log::Logger::instance();
 
-    auto dest = gt::log::makeSignalSlotDestination(this, &GtLogModel::onMessage);
+    auto dest = std::make_unique<LogModelDestination>(this);
     logger.addDestination(DESTINATION_ID(), std::move(dest));
 }
 
@@ -121,10 +187,14 @@ GtLogModel::setEnabled(bool enable)
 bool
 GtLogModel::containsLogLevel(gt::log::Level level) const
 {
-    return std::any_of(m_entries.begin(), m_entries.end(),
-                       [level](Entry const& e){
-        return e.level == level;
-    });
+    int const lvl = gt::log::levelToInt(level);
+
+    auto const& entries = pimpl->entries;
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        if (entries[i].level == lvl) return true;
+    }
+    return false;
 }
 
 QString
@@ -133,12 +203,18 @@ GtLogModel::format(const Entry& entry)
     return format(entry.msg, entry.details);
 }
 
+GtLogModel::Entry const&
+GtLogModel::entry(int row) const
+{
+    return pimpl->entries[static_cast<size_t>(row)];
+}
+
 int
 GtLogModel::rowCount(const QModelIndex& parent) const
 {
     if(parent.isValid()) return 0; //no children
 
-    return m_entries.count();
+    return static_cast<int>(pimpl->entries.size());
 }
 
 int
@@ -156,7 +232,7 @@ GtLogModel::data(const QModelIndex& index, int role) const
     int row = index.row();
     int col = index.column();
 
-    if (!index.isValid() || row >= m_entries.count())
+    if (!index.isValid() || row >= rowCount())
     {
         return {};
     }
@@ -167,7 +243,7 @@ GtLogModel::data(const QModelIndex& index, int role) const
         role = columnToRole(col);
     }
 
-    Entry const& entry = m_entries.at(index.row());
+    Entry const& entry = this->entry(row);
 
     // get data
     switch (role)
@@ -230,8 +306,9 @@ GtLogModel::exportLogToFile(const QString& fileName)
 
     QTextStream out(&file);
 
-    for (Entry const& entry : qAsConst(m_entries))
+    for (int row = 0; row < rowCount(); ++row)
     {
+        Entry const& entry = this->entry(row);
         auto level = gt::log::levelFromInt(entry.level);
 
         out << gt::log::levelToString(level).c_str() << ' '
@@ -251,7 +328,7 @@ GtLogModel::mimeData(QModelIndexList const& indexes) const
     for (const QModelIndex& index : indexes)
     {
         int row = index.row();
-        if (row < 0 || row >= m_entries.count())
+        if (row < 0 || row >= rowCount())
         {
             return {};
         }
@@ -267,7 +344,7 @@ GtLogModel::mimeData(QModelIndexList const& indexes) const
         assert(!list.empty());
         QString& str = list.last();
 
-        auto const& entry = m_entries.at(row);
+        auto const& entry = this->entry(row);
         auto const  level = gt::log::levelFromInt(entry.level);
 
         // append data
@@ -305,74 +382,52 @@ GtLogModel::setMaxLogLength(int val)
 {
     if (val < 1) return;
 
-    m_maxEntries = val;
+    auto& entries = pimpl->entries;
 
-    // remove some entries
-    if (m_entries.size() > m_maxEntries)
+    // remove the oldest entries
+    int delta = rowCount() - val;
+    if (delta > 0)
     {
-        beginResetModel();
-
-        m_entries = m_entries.mid(m_entries.size() - m_maxEntries);
+        removeRowRange(0, delta - 1);
+    }
 
-        assert(m_entries.size() == m_maxEntries);
+    entries.setCapacity(static_cast<size_t>(val));
 
-        endResetModel();
-    }
+    assert(entries.size() <= static_cast<size_t>(val));
 }
 
 void
 GtLogModel::onMessage(const QString& msg, int level, Details const& details)
 {
-    QMutexLocker locker{&m_mutex};
-    if (m_timer.isActive())
-    {
-        m_tmpEntries << Entry({ msg, level, details});
-    }
-    else
-    {
-        insertMessageNonlocked(msg, level, details);
-        m_timer.start(500);
-    }
-}
+    pimpl->queue.push(Entry{msg, level, details});
 
-void
-GtLogModel::execClear()
-{
-    if (m_tmpClearLog)
+    // only the first message of a batch schedules the insertion
+    if (!pimpl->insertScheduled.exchange(true))
     {
-        beginResetModel();
-        m_entries.clear();
-        endResetModel();
-        m_tmpClearLog = false;
-        emit logCleared();
+        QMetaObject::invokeMethod(this, &GtLogModel::scheduleInsert,
+                                  Qt::QueuedConnection);
     }
 }
 
 void
-GtLogModel::clearLog()
+GtLogModel::scheduleInsert()
 {
-    m_tmpClearLog = true;
+    // messages are inserted once the timer elapsed
+    if (pimpl->timer.isActive()) return;
 
-    if (m_timer.isActive())
-    {
-        return;
-    }
+    insertQueue();
 
-    execClear();
+    pimpl->timer.start();
 }
 
 void
-GtLogModel::insertMessageNonlocked(QString const& msg, int level, Details const& details)
+GtLogModel::clearLog()
 {
-    if (m_entries.size() >= m_maxEntries)
-    {
-        // we must use the non-locked
-        removeElementListNonlocked({index(0, 0)});
-    }
+    beginResetModel();
+    pimpl->entries.clear();
+    endResetModel();
 
-    beginInsertRows(QModelIndex(), m_entries.size(), m_entries.size());
-    m_entries << Entry({ msg, level, details });
-    endInsertRows();
+    emit logCleared();
 }
 
 void
@@ -381,90 +436,83 @@ GtLogModel::removeElement(QModelIndex index)
     removeElementList({index});
 }
 
-
 void
-GtLogModel::removeElementListNonlocked(const QModelIndexList& indexList)
+GtLogModel::removeRowRange(int first, int last)
 {
-
-    for (auto iter = indexList.rbegin(); iter != indexList.rend(); ++iter)
-    {
-        const auto& idx = *iter;
-
-        if (idx.row() < 0 || idx.row() >= m_entries.size())
-        {
-            continue;
-        }
-
-        beginRemoveRows(QModelIndex(), idx.row(), idx.row());
-
-        m_entries.removeAt(idx.row());
-
-        endRemoveRows();
-    }
+    beginRemoveRows(QModelIndex{}, first, last);
+    pimpl->entries.erase(static_cast<size_t>(first),
+                         static_cast<size_t>(last - first + 1));
+    endRemoveRows();
 }
 
-
 void
 GtLogModel::removeElementList(QModelIndexList indexList)
 {
     if (indexList.isEmpty()) return;
 
-    QMutexLocker locker{&m_mutex};
-    removeElementListNonlocked(indexList);
-}
-
-void
-GtLogModel::insertQueue()
-{
-    m_timer.stop();
-
-    execClear();
-
-    if (m_tmpEntries.isEmpty())
-    {
-        return;
-    }
-
-    int newRows = m_tmpEntries.size();
+    std::vector<int> rows;
+    rows.reserve(indexList.size());
 
-    // check whether size of new entries exceeds the maximum allowed entries
-    if (newRows > m_maxEntries)
+    for (auto const& idx : qAsConst(indexList))
     {
-        for (int i = 0; i < (newRows - m_maxEntries); i++)
+        if (idx.row() >= 0 && idx.row() < rowCount())
         {
-            m_tmpEntries.removeFirst();
+            rows.push_back(idx.row());
         }
     }
 
-    int delta = (m_entries.size() + m_tmpEntries.size()) - m_maxEntries;
+    // an index is listed for each column
+    std::sort(rows.begin(), rows.end());
+    rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
 
-    if (delta > m_maxEntries)
+    // remove contiguous rows at once, starting with the last range
+    auto last = rows.rbegin();
+    while (last != rows.rend())
     {
-        for (int i = 0; i < (delta - m_maxEntries); i++)
+        auto first = last;
+        auto prev = std::next(first);
+        while (prev != rows.rend() && *prev == *first - 1)
         {
-            m_tmpEntries.removeFirst();
+            first = prev++;
         }
+
+        removeRowRange(*first, *last);
+
+        last = std::next(first);
     }
+}
 
-    newRows = m_tmpEntries.size() - 1;
-    delta = (m_entries.size() + m_tmpEntries.size()) - m_maxEntries;
+void
+GtLogModel::insertQueue()
+{
+    // messages queued from now on schedule a new insertion
+    pimpl->insertScheduled = false;
 
-    if (delta > 0)
+    std::vector<Entry> queued = pimpl->queue.takeAll();
+    if (queued.empty()) return;
+
+    auto& entries = pimpl->entries;
+    size_t const capacity = entries.capacity();
+
+    // messages exceeding the capacity would be removed immediately
+    size_t const skip = queued.size() > capacity ? queued.size() - capacity : 0;
+    size_t const n = queued.size() - skip;
+
+    if (n == 0) return;
+
+    size_t const overflow = entries.size() + n > capacity ?
+                                entries.size() + n - capacity : 0;
+    if (overflow > 0)
     {
-        beginRemoveRows(QModelIndex{}, 0, delta - 1);
-        for (int i = 0; i < delta; i++)
-        {
-            m_entries.removeFirst();
-        }
-        endRemoveRows();
+        removeRowRange(0, static_cast<int>(overflow) - 1);
     }
 
-    beginInsertRows(QModelIndex{}, m_entries.size(), m_entries.size() + newRows);
-    for (Entry const& entry : qAsConst(m_tmpEntries))
+    int const first = rowCount();
+
+    beginInsertRows(QModelIndex{}, first, first + static_cast<int>(n) - 1);
+    for (size_t i = skip; i < queued.size(); ++i)
     {
-        m_entries << entry;
+        entries.push_back(std::move(queued[i]));
     }
     endInsertRows();
-
-    m_tmpEntries.clear();
 }
@@ -22,6 +22,8 @@
 #include <QMutex>
 #include <QTimer>
 
+#include <memory>
+
 #define gtLogModel (&GtLogModel::instance())
 
 struct GtLogDetails
@@ -274,6 +276,13 @@ public:
 
 public slots:
 
+    /**
+     * @brief Queues a message. May be called from any thread, the message is
+     * inserted into the model in a batch with other queued messages.
+     * @param msg Message
+     * @param level Level
+     * @param details Logging details
+     */
     void onMessage(QString const& msg ,int level, GtLogDetails const& details);
 
     /**
@@ -292,6 +301,8 @@ protected:
      */
     explicit GtLogModel();
 
+    ~GtLogModel() override;
+
 private:
 
     /// Entry struct
@@ -302,17 +313,8 @@ private:
         Details details;
     };
 
-    QVector<Entry> m_entries;
-
-    QVector<Entry> m_tmpEntries;
-
-    QMutex m_mutex;
-
-    QTimer m_timer;
-
-    bool m_tmpClearLog;
-
-    int m_maxEntries;
+    struct Impl;
+    std::unique_ptr<Impl> pimpl;
 
     /**
      * @brief Formats the message described by entry
@@ -322,30 +324,35 @@ private:
     static QString format(Entry const& entry);
 
     /**
-     * @brief Inserts the message into the model
-     * @param msg Message
-     * @param level Level
-     * @param details Logging details
+     * @brief Returns the entry of the given row
+     * @param row Row
+     * @return Entry
      */
-    void insertMessageNonlocked(const QString& msg ,int level, Details const& details);
+    Entry const& entry(int row) const;
 
     /**
-     * @brief Non mutex-locked implementation of element removal
+     * @brief Removes the rows [first, last] from the model
+     * @param first First row
+     * @param last Last row
      */
-    void removeElementListNonlocked(const QModelIndexList& indexList);
+    void removeRowRange(int first, int last);
 
     /**
-     * @brief Helper method for clearing the output log
+     * @brief Adds a logging destion for this class
      */
-    void execClear();
+    void setupLoggingDestination();
 
     /**
-     * @brief Adds a logging destion for this class
+     * @brief Inserts the queued messages immediately if no insertion is
+     * pending, otherwise they are inserted once the timer elapsed
      */
-    void setupLoggingDestination();
+    void scheduleInsert();
 
 private slots:
 
+    /**
+     * @brief Inserts all queued messages into the model at once
+     */
     void insertQueue();
 };
 
@@ -16,6 +16,8 @@
 #include "gt_algorithms.h"
 #include "gt_versionnumber.h"
 #include "gt_coreapplication.h"
+#include "internal/gt_modulemetacache.h"
+#include "internal/gt_startupprofiler.h"
 #include "internal/gt_moduleupgrader.h"
 #include "internal/gt_sharedfunctionhandler.h"
 #include "internal/gt_commandlinefunctionhandler.h"
@@ -30,6 +32,7 @@
 #include <QJsonObject>
 #include <QSettings>
 #include <QDomElement>
+#include <QElapsedTimer>
 
 #include "gt_algorithms.h"
 #include "gt_utilities.h"
@@ -221,12 +224,18 @@ namespace
 
 QDir getModuleDirectory()
 {
+    // allows to load the modules from a different directory (e.g. benchmarks)
+    QString path = qEnvironmentVariable("GTLAB_MODULE_DIR");
+
+    if (path.isEmpty())
+    {
 #ifndef Q_OS_ANDROID
-    QString path = QCoreApplication::applicationDirPath() +
-                   QDir::separator() + QStringLiteral("modules");
+        path = QCoreApplication::applicationDirPath() +
+               QDir::separator() + QStringLiteral("modules");
 #else
-    QString path = QCoreApplication::applicationDirPath();
+        path = QCoreApplication::applicationDirPath();
 #endif
+    }
 
     QDir modulesDir(path);
 #ifdef Q_OS_WIN
@@ -410,15 +419,37 @@ ModuleMetaData loadModuleMeta(const QString& moduleFileName)
 
 ModuleMetaMap loadModuleMeta()
 {
+    auto phase = gt::detail::startupPhase(QStringLiteral("module meta data"));
+
+    QElapsedTimer timer;
+    timer.start();
+
     std::map<QString, ModuleMetaData> metaData;
 
     const auto moduleFiles = getModuleFilenames();
+
+    // the meta data is only read from libraries that changed
+    gt::detail::ModuleMetaCache cache;
+    const auto cachedMeta = cache.metaData(moduleFiles);
+
     for (const QString& moduleFile : moduleFiles)
     {
-        const auto meta = loadModuleMeta(moduleFile);
+        auto iter = cachedMeta.find(moduleFile);
+        if (iter == cachedMeta.end()) continue;
+
+        ModuleMetaData meta(moduleFile);
+        meta.readFromJson(iter->second);
         metaData.insert(std::make_pair(meta.moduleId(), meta));
     }
 
+    cache.save();
+
+    gtDebug() << QObject::tr("Read module meta data in %1 ms "
+                             "(%2 cached, %3 read)")
+                     .arg(timer.elapsed())
+                     .arg(cache.hits())
+                     .arg(cache.misses());
+
     const auto crashed_mods = CrashedModulesLog().crashedModules();
 
     // Remove all modules, that have been crashed earlies
@@ -505,6 +536,9 @@ GtModuleLoader::loadSingleModule(const QString& moduleLocation)
 void
 GtModuleLoader::load()
 {
+    QElapsedTimer timer;
+    timer.start();
+
     auto allModulesIds = m_pimpl->getAllLoadableModuleIds();
     auto moduleMetaMap = m_pimpl->m_metaData;
 
@@ -515,6 +549,10 @@ GtModuleLoader::load()
         gtError().verbose() << QObject::tr("Some modules failed to load!");
         Impl::printDependencies(failedModules, moduleMetaMap);
     }
+
+    gtDebug() << QObject::tr("Loaded %1 modules in %2 ms")
+                     .arg(m_pimpl->m_plugins.size())
+                     .arg(timer.elapsed());
 }
 
 QMap<QString, QString>
@@ -647,9 +685,14 @@ GtModuleLoader::initModules()
         return;
     }
 
-    for (auto const& value : qAsConst(m_pimpl->m_plugins))
+    for (auto iter = m_pimpl->m_plugins.cbegin();
+         iter != m_pimpl->m_plugins.cend(); ++iter)
     {
-        value->init();
+        auto phase = gt::detail::startupPhase(
+                    QStringLiteral("init %1").arg(iter.key()),
+                    gt::detail::StartupProfiler::S_MODULE);
+
+        iter.value()->init();
     }
 
     m_pimpl->m_modulesInitialized = true;
@@ -852,6 +895,10 @@ GtModuleLoader::Impl::performLoading(GtModuleLoader& moduleLoader,
             continue;
         }
 
+        auto phase = gt::detail::startupPhase(
+                    QStringLiteral("load %1").arg(currentModuleId),
+                    gt::detail::StartupProfiler::S_MODULE);
+
         // store temporary module information in loading fail log
         auto _ = crashLog.makeSnapshot(moduleMeta.location());
 
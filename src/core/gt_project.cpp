@@ -9,9 +9,13 @@
  */
 
 #include <QDomDocument>
+#include <QXmlStreamReader>
 #include <QXmlStreamWriter>
 #include <QDir>
 #include <QDateTime>
+#include <QBuffer>
+#include <QCryptographicHash>
+#include <QtConcurrent>
 
 #include "gt_project.h"
 #include "gt_processdata.h"
@@ -36,7 +40,9 @@
 #include "internal/gt_moduleupgrader.h"
 #include "internal/gt_moduleupgrader.h"
 
+#include <algorithm>
 #include <cassert>
+#include <vector>
 
 GtProject::GtProject(const QString& path) :
     m_path(path),
@@ -400,6 +406,7 @@ void
 GtProject::readModuleMetaData(const QDomElement& root)
 {
     m_moduleIds.clear();
+    m_moduleHashes.clear();
 
     /* module informations */
     QDomElement mdata = root.firstChildElement(QStringLiteral("MODULES"));
@@ -432,6 +439,12 @@ GtProject::readModuleMetaData(const QDomElement& root)
                                       << tr("Unknown module: ") << mid;
             }
             m_moduleIds << mid;
+
+            QString hash = module.attribute(QStringLiteral("hash"));
+            if (!hash.isEmpty())
+            {
+                m_moduleHashes.insert(mid, hash.toLatin1());
+            }
         }
 
         module = module.nextSiblingElement(QStringLiteral("MODULE"));
@@ -525,10 +538,65 @@ GtProject::readLabelData(const GtObjectList& moduleData)
     return data;
 }
 
+namespace
+{
+
+/// state of a single module file. Only the file access is done by a worker
+/// thread, the package is solely accessed by the thread owning it.
+struct ModuleFileJob
+{
+    /// module id
+    QString moduleId;
+    /// class name of the module package
+    QString packageId;
+    /// path of the module file
+    QString filePath;
+    /// package of the module
+    GtPackage* package{nullptr};
+    /// owns the package while it is read
+    std::unique_ptr<GtObject> packageObj;
+    /// whether the package supports stream io
+    bool streamIO{false};
+    /// dom document, if the package does not support stream io
+    QDomDocument document;
+    /// content of the module file, if the package supports stream io
+    QByteArray content;
+    /// whether the module file must be written
+    bool modified{true};
+    /// whether the worker step succeeded
+    bool success{false};
+    /// content hash of the written module file
+    QByteArray hash;
+};
+
+/// returns the hex encoded content hash of the given file or an empty
+/// array if the file cannot be read
+QByteArray
+fileHash(const QString& filePath)
+{
+    QFile file(filePath);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return {};
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+
+    if (!hash.addData(&file))
+    {
+        return {};
+    }
+
+    return hash.result().toHex();
+}
+
+} // namespace
+
 GtObjectList
 GtProject::readModuleData()
 {
-    GtObjectList retval;
+    std::vector<ModuleFileJob> jobs;
 
     foreach (const QString& mid, m_moduleIds)
     {
@@ -552,9 +620,7 @@ GtProject::readModuleData()
         QString filename = m_path + QDir::separator() + mid.toLower() + "." +
                            moduleExtension();
 
-        QFile file(filename);
-
-        if (!file.exists())
+        if (!QFile::exists(filename))
         {
             gtWarning() << objectName() << ": "
                       << tr("GTlab module file not found!") << "(" << mid
@@ -562,71 +628,71 @@ GtProject::readModuleData()
             continue;
         }
 
-        QDomDocument document;
-
-        QString errorStr;
-        int errorLine;
-        int errorColumn;
+        ModuleFileJob job;
+        job.moduleId = mid;
+        job.packageId = packageId;
+        job.filePath = filename;
+        job.packageObj.reset(gtObjectFactory->newObject(packageId));
+        job.package = qobject_cast<GtPackage*>(job.packageObj.get());
 
-        if (!gt::xml::readDomDocumentFromFile(file, document, true, &errorStr,
-                                              &errorLine, &errorColumn))
+        if (!job.package)
         {
-            gtWarning() << tr("XML ERROR!") << " " << tr("line") << ": "
-                      << errorLine << " " << tr("column") << ": "
-                      << errorColumn << " -> " << errorStr;
+            gtWarning() << objectName() << ": "
+                        << tr("Failed to create module package!")
+                        << " (" << mid << ")";
             continue;
         }
 
-        QDomElement root = document.documentElement();
-
-        if (root.isNull() || (root.tagName() != QLatin1String("GTLABMODULE")))
-        {
-            gtWarning() << tr("Invalid GTlab module file!");
-            continue;
-        }
+        job.streamIO = job.package->supportsStreamIO();
+        jobs.push_back(std::move(job));
+    }
 
-        const QString uuid = root.attribute(QStringLiteral("uuid"));
+    // module files are independent of each other and therefore read and
+    // parsed concurrently. The packages are not accessed by the workers, as
+    // their (module specific) read methods are not required to be thread
+    // safe.
+    QtConcurrent::blockingMap(jobs, [this](ModuleFileJob& job){
+        QFile file(job.filePath);
 
-        if (uuid.isEmpty())
-        {
-            gtWarning() << tr("Invalid GTlab module file!");
-            continue;
-        }
+        job.success = job.streamIO ?
+                          readModuleFileContent(file, job.content) :
+                          readModuleDocument(file, job.document);
+    });
 
-        GtObject* obj = gtObjectFactory->newObject(packageId);
+    GtObjectList retval;
 
-        if (!obj)
+    for (ModuleFileJob& job : jobs)
+    {
+        if (!job.success)
         {
-            gtWarning() << objectName() << ": "
-                        << tr("Failed to create module package!")
-                        << " (" << mid << ")";
             continue;
         }
 
-        GtPackage* package = qobject_cast<GtPackage*>(obj);
+        bool success = job.streamIO ?
+                           readModuleFileStream(job.content, *job.package) :
+                           readModuleFileDom(job.document, *job.package);
 
-        if (!package)
+        // release memory early
+        job.content.clear();
+        job.document.clear();
+
+        if (!success)
         {
-            gtWarning() << objectName() << ": "
-                        << tr("Failed to create module package!")
-                        << " (" << mid << ")";
             continue;
         }
 
-        package->setUuid(uuid);
-
-        if (!package->readData(root) || !package->readMiscData(QDir(m_path)))
+        if (!job.package->readMiscData(QDir(m_path)))
         {
             gtWarning() << objectName() << ": "
                         << tr("Failed to read module data!")
-                        << " (" << mid << ")";
+                        << " (" << job.moduleId << ")";
             continue;
         }
 
         // externalized object must be initialized
-        gtExternalizationManager->initExternalizedObjects(*package);
+        gtExternalizationManager->initExternalizedObjects(*job.package);
 
-        retval.append(obj);
+        retval.append(job.packageObj.release());
     }
 
     return retval;
@@ -640,6 +706,31 @@ GtProject::saveModuleData()
         return false;
     }
 
+    std::vector<ModuleFileJob> jobs;
+
+    foreach (const QString& mid, m_moduleIds)
+    {
+        GtPackage* package = findPackage(mid);
+
+        if (!package)
+        {
+            gtWarning().noquote()
+                    << tr("Failed to save module data!")
+                    << QStringLiteral("(\"") + mid + QStringLiteral("\")");
+            continue;
+        }
+
+        ModuleFileJob job;
+        job.moduleId = mid;
+        job.filePath = m_path + QDir::separator() + mid.toLower() + "." +
+                       moduleExtension();
+        job.package = package;
+        job.streamIO = package->supportsStreamIO();
+        // must be checked before the externalized objects are saved
+        job.modified = moduleNeedsSave(*package, job.filePath);
+        jobs.push_back(std::move(job));
+    }
+
     // externalize or internalize objects accordingly
     if (!saveExternalizedObjectData())
     {
@@ -647,51 +738,330 @@ GtProject::saveModuleData()
         // saving may continue
     }
 
-    foreach (const QString& mid, m_moduleIds)
+    for (ModuleFileJob& job : jobs)
     {
+        if (!job.modified)
+        {
+            gtDebug().medium().noquote()
+                    << tr("module data unchanged")
+                    << QStringLiteral("\"") + job.moduleId +
+                       QStringLiteral("\"");
+            continue;
+        }
+
         gtDebug().noquote() << tr("saving module data")
-                           << QStringLiteral("\"") + mid +
+                           << QStringLiteral("\"") + job.moduleId +
                               QStringLiteral("\" ...");
 
-        GtPackage* package = findPackage(mid);
+        // the packages are serialized in this thread, as their (module
+        // specific) save methods are not required to be thread safe. Only
+        // writing the module files is done concurrently.
+        bool success = job.streamIO ?
+                           createModuleStream(*job.package, job.content) :
+                           createModuleDocument(*job.package, job.document);
 
-        if (!package)
+        if (!success)
         {
-            gtWarning().noquote()
-                    << tr("Failed to save module data!")
-                    << QStringLiteral("(\"") + mid + QStringLiteral("\")");
-            continue;
+            gtWarning() << "\t |->" << job.moduleId;
+            job.modified = false;
+            job.content.clear();
+            job.document.clear();
+        }
+    }
+
+    // the workers do not access the data model
+    QtConcurrent::blockingMap(jobs, [this](ModuleFileJob& job){
+        if (!job.modified)
+        {
+            return;
         }
 
-        QDomDocument document;
-        QDomProcessingInstruction header = document.createProcessingInstruction(
-                QStringLiteral("xml"),
-                QStringLiteral("version=\"1.0\" encoding=\"utf-8\""));
-        document.appendChild(header);
+        const QString tempFilePath = job.filePath + QStringLiteral("_new");
+
+        if (job.streamIO)
+        {
+            job.success = writeModuleFileContent(tempFilePath, job.content);
+        }
+        else
+        {
+            // new ordered attribute stream writer algorithm
+            job.success = gt::xml::writeDomDocumentToFile(tempFilePath,
+                                                          job.document, true);
+        }
 
-        QDomElement rootElement =
-                document.createElement(QStringLiteral("GTLABMODULE"));
+        if (!job.success)
+        {
+            gtError() << objectName() << QStringLiteral(": ")
+                      << tr("Failed to save project data!");
+        }
+        else
+        {
+            job.hash = fileHash(tempFilePath);
+        }
 
-        rootElement.setAttribute(QStringLiteral("uuid"), package->uuid());
+        job.content.clear();
+        job.document.clear();
+    });
 
-        document.appendChild(rootElement);
+    for (ModuleFileJob& job : jobs)
+    {
+        const QString tempFilePath = job.filePath + QStringLiteral("_new");
 
-        if (!package->saveData(rootElement, document) || !package->saveMiscData(QDir(m_path)))
+        if ((job.modified && !job.success) ||
+            !job.package->saveMiscData(QDir(m_path)))
         {
             gtWarning().noquote()
                     << tr("Failed to save module data!")
-                    << QStringLiteral("(\"") + mid + QStringLiteral("\")");
+                    << QStringLiteral("(\"") + job.package->objectName() +
+                       QStringLiteral("\")");
+            gtWarning() << "\t |->" << job.moduleId;
+            QFile::remove(tempFilePath);
             continue;
         }
 
-        QString filename = m_path + QDir::separator() + mid.toLower() + "." +
-                           moduleExtension();
+        if (!job.modified)
+        {
+            continue;
+        }
+
+        // content did not change (e.g. a change was undone). The stored hash
+        // is checked first, to avoid reading every existing module file.
+        if (!job.hash.isEmpty() && job.hash == m_moduleHashes.value(job.moduleId)
+            && job.hash == fileHash(job.filePath))
+        {
+            QFile::remove(tempFilePath);
+            continue;
+        }
 
-        if (!saveProjectFiles(filename, document))
+        if (!replaceProjectFile(tempFilePath, job.filePath))
         {
-            gtWarning() << "\t |->" << mid;
+            gtWarning() << "\t |->" << job.moduleId;
+            m_moduleHashes.remove(job.moduleId);
             continue;
         }
+
+        m_moduleHashes.insert(job.moduleId, job.hash);
+    }
+
+    return true;
+}
+
+bool
+GtProject::moduleNeedsSave(const GtPackage& package,
+                           const QString& filePath) const
+{
+    if (m_internalizeOnSave || !QFile::exists(filePath))
+    {
+        return true;
+    }
+
+    auto isModified = [](const GtObject* obj) {
+        return obj->hasChanges() || obj->hasChildChanged() ||
+               obj->newlyCreated();
+    };
+
+    if (isModified(&package))
+    {
+        return true;
+    }
+
+    // fetched objects may be externalized on save, which alters their
+    // memento without flagging them as changed
+    auto externalized = package.findChildren<GtExternalizedObject*>();
+
+    return std::any_of(externalized.begin(), externalized.end(),
+                       [](GtExternalizedObject const* obj) {
+        return obj->isFetched();
+    });
+}
+
+bool
+GtProject::readModuleDocument(QFile& file, QDomDocument& document) const
+{
+    QString errorStr;
+    int errorLine;
+    int errorColumn;
+
+    if (!gt::xml::readDomDocumentFromFile(file, document, true, &errorStr,
+                                          &errorLine, &errorColumn))
+    {
+        gtWarning() << tr("XML ERROR!") << " " << tr("line") << ": "
+                  << errorLine << " " << tr("column") << ": "
+                  << errorColumn << " -> " << errorStr;
+        return false;
+    }
+
+    return true;
+}
+
+bool
+GtProject::readModuleFileDom(const QDomDocument& document, GtPackage& package)
+{
+    QDomElement root = document.documentElement();
+
+    if (root.isNull() || (root.tagName() != QLatin1String("GTLABMODULE")))
+    {
+        gtWarning() << tr("Invalid GTlab module file!");
+        return false;
+    }
+
+    const QString uuid = root.attribute(QStringLiteral("uuid"));
+
+    if (uuid.isEmpty())
+    {
+        gtWarning() << tr("Invalid GTlab module file!");
+        return false;
+    }
+
+    package.setUuid(uuid);
+
+    if (!package.readData(root))
+    {
+        gtWarning() << objectName() << ": "
+                    << tr("Failed to read module data!")
+                    << " (" << package.objectName() << ")";
+        return false;
+    }
+
+    return true;
+}
+
+bool
+GtProject::readModuleFileContent(QFile& file, QByteArray& content) const
+{
+    // opened in text mode (fix for broken line endings)
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        gtWarning() << tr("XML ERROR!") << " "
+                    << tr("could not open file! (%1)").arg(file.fileName());
+        return false;
+    }
+
+    content = file.readAll();
+
+    return true;
+}
+
+bool
+GtProject::readModuleFileStream(const QByteArray& content, GtPackage& package)
+{
+    QXmlStreamReader reader(content);
+
+    if (!reader.readNextStartElement() ||
+        reader.name() != QLatin1String("GTLABMODULE"))
+    {
+        gtWarning() << tr("Invalid GTlab module file!");
+        return false;
+    }
+
+    const QString uuid =
+            reader.attributes().value(QStringLiteral("uuid")).toString();
+
+    if (uuid.isEmpty())
+    {
+        gtWarning() << tr("Invalid GTlab module file!");
+        return false;
+    }
+
+    package.setUuid(uuid);
+
+    bool success = package.readStreamData(reader);
+
+    if (reader.hasError())
+    {
+        gtWarning() << tr("XML ERROR!") << " " << tr("line") << ": "
+                  << reader.lineNumber() << " " << tr("column") << ": "
+                  << reader.columnNumber() << " -> " << reader.errorString();
+        return false;
+    }
+
+    if (!success)
+    {
+        gtWarning() << objectName() << ": "
+                    << tr("Failed to read module data!")
+                    << " (" << package.objectName() << ")";
+        return false;
+    }
+
+    return true;
+}
+
+bool
+GtProject::createModuleDocument(GtPackage& package, QDomDocument& document)
+{
+    QDomProcessingInstruction header = document.createProcessingInstruction(
+            QStringLiteral("xml"),
+            QStringLiteral("version=\"1.0\" encoding=\"utf-8\""));
+    document.appendChild(header);
+
+    QDomElement rootElement =
+            document.createElement(QStringLiteral("GTLABMODULE"));
+
+    rootElement.setAttribute(QStringLiteral("uuid"), package.uuid());
+
+    document.appendChild(rootElement);
+
+    if (!package.saveData(rootElement, document))
+    {
+        gtWarning().noquote()
+                << tr("Failed to save module data!")
+                << QStringLiteral("(\"") + package.objectName() +
+                   QStringLiteral("\")");
+        return false;
+    }
+
+    return true;
+}
+
+bool
+GtProject::createModuleStream(GtPackage& package, QByteArray& content)
+{
+    QBuffer buffer(&content);
+    buffer.open(QIODevice::WriteOnly);
+
+    // same format as gt::xml::writeDomDocumentToFile
+    QXmlStreamWriter writer(&buffer);
+    writer.setCodec("UTF-8");
+    writer.setAutoFormatting(true);
+
+    writer.writeStartDocument(QStringLiteral("1.0"));
+    writer.writeStartElement(QStringLiteral("GTLABMODULE"));
+    writer.writeAttribute(QStringLiteral("uuid"), package.uuid());
+
+    bool success = package.saveStreamData(writer);
+
+    writer.writeEndElement();
+    writer.writeEndDocument();
+
+    if (!success || writer.hasError())
+    {
+        gtWarning().noquote()
+                << tr("Failed to save module data!")
+                << QStringLiteral("(\"") + package.objectName() +
+                   QStringLiteral("\")");
+        return false;
+    }
+
+    return true;
+}
+
+bool
+GtProject::writeModuleFileContent(const QString& filePath,
+                                  const QByteArray& content) const
+{
+    QFile file(filePath);
+
+    // opened in text mode to write native line endings
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        return false;
+    }
+
+    if (file.write(content) != content.size() || !file.flush())
+    {
+        file.close();
+        file.remove();
+        return false;
     }
 
     return true;
@@ -761,6 +1131,10 @@ GtProject::saveExternalizedObjectData()
     bool success{true};
     auto objects = findChildren<GtExternalizedObject*>();
 
+    // keep the externalization resources (e.g. hdf5 file) open while saving
+    GtExternalizationManager::Session session;
+    Q_UNUSED(session)
+
     // force internalization of all objects
     if (m_internalizeOnSave)
     {
@@ -786,17 +1160,14 @@ GtProject::saveExternalizedObjectData()
 
     gtDebug() << "Saving externalized object data...";
 
-    for (auto* obj : qAsConst(objects))
-    {
-        // only externalize the object if its not referenced as the data wont be
-        // cleared otherwise and will be saved as memento
-        if (obj->refCount() == 0)
-        {
-            success &= obj->externalize();
-        }
-    }
+    // only externalize the object if its not referenced as the data wont be
+    // cleared otherwise and will be saved as memento
+    objects.erase(std::remove_if(objects.begin(), objects.end(),
+                                 [](GtExternalizedObject const* obj){
+        return obj->refCount() != 0;
+    }), objects.end());
 
-    return success;
+    return gtExternalizationManager->externalize(objects) && success;
 }
 
 bool
@@ -810,6 +1181,15 @@ GtProject::saveModuleMetaData(QDomElement& root, QDomDocument& doc)
         moduleElement.setAttribute(QStringLiteral("name"), mid);
         moduleElement.setAttribute(QStringLiteral("version"),
                                    gtApp->moduleVersion(mid).toString());
+
+        // content hash of the module file written last
+        QByteArray hash = m_moduleHashes.value(mid);
+        if (!hash.isEmpty())
+        {
+            moduleElement.setAttribute(QStringLiteral("hash"),
+                                       QString::fromLatin1(hash));
+        }
+
         modulesElement.appendChild(moduleElement);
     }
 
@@ -960,6 +1340,21 @@ GtProject::saveProjectFiles(const QString& filePath, const QDomDocument& doc)
         return false;
     }
 
+    // keep the existing file (and its backup) if nothing has changed
+    QByteArray hash = fileHash(tempFilePath);
+    if (!hash.isEmpty() && hash == fileHash(filePath))
+    {
+        QFile::remove(tempFilePath);
+        return true;
+    }
+
+    return replaceProjectFile(tempFilePath, filePath);
+}
+
+bool
+GtProject::replaceProjectFile(const QString& tempFilePath,
+                              const QString& filePath)
+{
     //rename files
     /// => existing from 'path' to 'path + _backup'
     /// => the new file from 'path + _new' to 'path'
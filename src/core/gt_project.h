@@ -14,6 +14,7 @@
 #include "gt_core_exports.h"
 
 #include <QStringList>
+#include <QHash>
 
 #include "gt_object.h"
 #include "gt_session.h"
@@ -23,6 +24,7 @@
 class QDomDocument;
 class QXmlStreamWriter;
 class QDomElement;
+class QFile;
 class GtProcessData;
 class GtTask;
 class GtProjectProvider;
@@ -310,6 +312,10 @@ private:
     /// List of all project module ids
     QStringList m_moduleIds;
 
+    /// Content hashes of the module files (module id -> hex encoded sha256).
+    /// Stored in the project file.
+    QHash<QString, QByteArray> m_moduleHashes;
+
     /// Project path property. Only used for visualization in the GUI.
     GtStringProperty m_pathProp;
 
@@ -353,12 +359,85 @@ private:
      */
     GtObjectList readModuleData();
 
+    /**
+     * @brief Parses the module file into a dom document. May be called from
+     * a worker thread, as the package is not accessed.
+     * @param file Module file
+     * @param document Document to parse into
+     * @return success
+     */
+    bool readModuleDocument(QFile& file, QDomDocument& document) const;
+
+    /**
+     * @brief Reads the parsed module document into the package
+     * @param document Parsed module file
+     * @param package Package to read
+     * @return success
+     */
+    bool readModuleFileDom(const QDomDocument& document, GtPackage& package);
+
+    /**
+     * @brief Reads the content of the module file. May be called from a
+     * worker thread, as the package is not accessed.
+     * @param file Module file
+     * @param content Content of the module file
+     * @return success
+     */
+    bool readModuleFileContent(QFile& file, QByteArray& content) const;
+
+    /**
+     * @brief Reads the module file content into the package using a stream
+     * reader. Must be called from the thread owning the package.
+     * @param content Content of the module file
+     * @param package Package to read
+     * @return success
+     */
+    bool readModuleFileStream(const QByteArray& content, GtPackage& package);
+
     /**
      * @brief saveModuleData
      * @return success
      */
     bool saveModuleData();
 
+    /**
+     * @brief Returns whether the module file of the package must be written.
+     * This is the case if the package or one of its children has changed or
+     * if the module file does not exist yet.
+     * @param package Package to save
+     * @param filePath Module file path
+     * @return whether the module must be saved
+     */
+    bool moduleNeedsSave(const GtPackage& package,
+                         const QString& filePath) const;
+
+    /**
+     * @brief Serializes the package into a module document
+     * @param package Package to save
+     * @param document Document to serialize into
+     * @return success
+     */
+    bool createModuleDocument(GtPackage& package, QDomDocument& document);
+
+    /**
+     * @brief Serializes the package into the content of a module file using a
+     * stream writer. Must be called from the thread owning the package.
+     * @param package Package to save
+     * @param content Content of the module file
+     * @return success
+     */
+    bool createModuleStream(GtPackage& package, QByteArray& content);
+
+    /**
+     * @brief Writes the serialized content to the given module file. May be
+     * called from a worker thread, as the package is not accessed.
+     * @param filePath File path
+     * @param content Content of the module file
+     * @return success
+     */
+    bool writeModuleFileContent(const QString& filePath,
+                                const QByteArray& content) const;
+
     /**
      * @brief saveProjectOverallData
      * @return success
@@ -425,6 +504,16 @@ private:
      */
     bool saveProjectFiles(const QString& filePath, const QDomDocument& doc);
 
+    /**
+     * @brief Replaces the project file by the temporary file. The existing
+     * project file is kept as backup.
+     * @param tempFilePath : path of the newly written temporary file
+     * @param filePath : file path
+     * @return success
+     */
+    bool replaceProjectFile(const QString& tempFilePath,
+                            const QString& filePath);
+
     /**
      * @brief Updates module footprint version stored in project file.
      * New version matches the current module version of the framework.
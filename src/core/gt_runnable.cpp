@@ -19,6 +19,59 @@
 #include "gt_task.h"
 #include "gt_project.h"
 #include "gt_logging.h"
+#include "gt_externalizedobject.h"
+
+#include "gt_objectio.h"
+
+#include <QChildEvent>
+#include <QSet>
+
+namespace
+{
+
+/// externalized data may be modified without flagging the object as changed
+bool
+hasExternalizedChanges(GtObject const& obj)
+{
+    auto* ext = qobject_cast<GtExternalizedObject const*>(&obj);
+    return ext && ext->isFetched();
+}
+
+/// hash of the object's properties, not including the child objects
+QByteArray
+propertyHash(GtObject const& obj)
+{
+    return GtObjectIO().toMemento(&obj, true, true)
+            .calculatePropertyHash(GtObject::defaultHashAlgorithm());
+}
+
+} // namespace
+
+/**
+ * @brief Records the objects which lost a child object. Deleting a child
+ * flags its parent as changed, but moving it to another parent does not.
+ */
+class GtRunnable::ChildRemovalFilter : public QObject
+{
+public:
+
+    /// objects which lost a child object
+    QList<QPointer<GtObject>> parents;
+
+    bool eventFilter(QObject* watched, QEvent* event) override
+    {
+        if (event->type() == QEvent::ChildRemoved &&
+            qobject_cast<GtObject*>(static_cast<QChildEvent*>(event)->child()))
+        {
+            if (auto* obj = qobject_cast<GtObject*>(watched))
+            {
+                parents.append(obj);
+            }
+        }
+
+        return QObject::eventFilter(watched, event);
+    }
+};
 
 GtRunnable::GtRunnable(QString projectPath) :
     m_projectPath{std::move(projectPath)}
@@ -26,6 +79,8 @@ GtRunnable::GtRunnable(QString projectPath) :
     setObjectName("GtRunnable");
 }
 
+GtRunnable::~GtRunnable() = default;
+
 void
 GtRunnable::run()
 {
@@ -85,6 +140,9 @@ GtRunnable::run()
 
     m_successfulRun = success;
 
+    m_removalFilter.reset();
+    m_silentStates.clear();
+
     emit runnableFinished();
 }
 
@@ -142,13 +200,21 @@ GtRunnable::clearTempDir(const QString& path)
 void
 GtRunnable::readObjects()
 {
+    // must live in the thread of the restored objects
+    m_removalFilter = std::make_unique<ChildRemovalFilter>();
+    m_silentStates.clear();
+
     for (GtObjectMemento& memento : m_inputData)
     {
         GtObject* obj = memento.restore(gtObjectFactory);
 
         if (obj)
         {
+            // track changes made by the calculators
+            obj->acceptChangesRecursively();
             m_linkedObjects.append(obj);
+
+            trackObject(*obj);
         }
     }
 }
@@ -156,8 +222,85 @@ GtRunnable::readObjects()
 void
 GtRunnable::writeObjects()
 {
+    // objects changed without setting a change flag
+    QSet<GtObject const*> changed;
+
+    for (SilentState const& state : qAsConst(m_silentStates))
+    {
+        if (state.object &&
+            propertyHash(*state.object) != state.propertyHash)
+        {
+            changed.insert(state.object);
+        }
+    }
+
+    for (QPointer<GtObject> const& p : qAsConst(m_removalFilter->parents))
+    {
+        if (p) changed.insert(p);
+    }
+
+    for (GtObject* obj : qAsConst(m_linkedObjects))
+    {
+        auto const extChildren = obj->findChildren<GtExternalizedObject*>();
+        for (auto* ext : extChildren)
+        {
+            if (hasExternalizedChanges(*ext)) changed.insert(ext);
+        }
+    }
+
+    QSet<GtObject const*> parents;
+
+    for (GtObject const* obj : qAsConst(changed))
+    {
+        for (GtObject const* p = obj->parentObject(); p &&
+             !parents.contains(p); p = p->parentObject())
+        {
+            parents.insert(p);
+        }
+    }
+
+    // only the changed subtrees are merged back into the data model
     for (GtObject* obj : qAsConst(m_linkedObjects))
     {
-        m_outputData << GtObjectMemento(obj);
+        appendChangedData(*obj, changed, parents);
+    }
+}
+
+void
+GtRunnable::trackObject(GtObject& obj)
+{
+    QList<GtObject*> objects = obj.findChildren<GtObject*>();
+    objects.prepend(&obj);
+
+    for (GtObject* o : qAsConst(objects))
+    {
+        o->installEventFilter(m_removalFilter.get());
+
+        if (o->hasSilentData())
+        {
+            m_silentStates.append(SilentState{o, propertyHash(*o)});
+        }
+    }
+}
+
+void
+GtRunnable::appendChangedData(GtObject& obj,
+                              QSet<GtObject const*> const& changed,
+                              QSet<GtObject const*> const& parents)
+{
+    if (obj.hasChanges() || changed.contains(&obj))
+    {
+        m_outputData << GtObjectMemento(&obj);
+        return;
+    }
+
+    if (!obj.hasChildChanged() && !parents.contains(&obj))
+    {
+        return;
+    }
+
+    for (GtObject* child : obj.findDirectChildren<GtObject*>())
+    {
+        appendChangedData(*child, changed, parents);
     }
 }
@@ -15,6 +15,11 @@
 
 #include "gt_processcomponent.h"
 
+#include <QPointer>
+#include <QSet>
+
+#include <memory>
+
 /**
  * @brief The GtRunnable class
  */
@@ -29,6 +34,8 @@ public:
      */
     explicit GtRunnable(QString projectPath = {});
 
+    ~GtRunnable() override;
+
     /**
      * @brief run
      */
@@ -60,16 +67,57 @@ public:
 
 private:
 
+    class ChildRemovalFilter;
+
+    /// own data of an object, which may change silently
+    struct SilentState
+    {
+        /// object
+        QPointer<GtObject> object;
+        /// hash of the object's properties before the execution
+        QByteArray propertyHash;
+    };
+
     /// custom project path (by default empty)
     QString m_projectPath;
 
+    /// tracks the linked objects losing a child without being flagged as
+    /// changed (e.g. if the child is moved to another parent)
+    std::unique_ptr<ChildRemovalFilter> m_removalFilter;
+
+    /// states of the linked objects with silent data
+    QList<SilentState> m_silentStates;
+
+    /**
+     * @brief Starts tracking the changes of the restored object and its
+     * children, which are not signaled by the change flags.
+     * @param obj Restored object
+     */
+    void trackObject(GtObject& obj);
+
+    /**
+     * @brief Appends the mementos of the topmost changed objects of the
+     * subtree.
+     * @param obj Linked object
+     * @param changed Objects changed without setting the change flags
+     * @param parents Parents of these objects
+     */
+    void appendChangedData(GtObject& obj,
+                           QSet<GtObject const*> const& changed,
+                           QSet<GtObject const*> const& parents);
+
     /**
      * @brief transferObjects
      */
     void readObjects();
 
     /**
-     * @brief writeObjects
+     * @brief Writes the objects changed by the calculators to the output
+     * data. Only the topmost changed objects of each linked object are
+     * written, unchanged subtrees are skipped. Changes are detected by the
+     * change flags of the objects. Only the own data of objects with silent
+     * data (e.g. meta properties) is compared with its state before the
+     * execution.
      */
     void writeObjects();
 
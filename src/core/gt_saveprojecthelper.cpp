@@ -31,12 +31,13 @@ GtSaveProjectHelper::run()
         return;
     }
 
-    if (!m_project->saveProjectOverallData())
+    // module data first, the project file stores the module file hashes
+    if (!m_project->saveModuleData())
     {
         return;
     }
 
-    if (!m_project->saveModuleData())
+    if (!m_project->saveProjectOverallData())
     {
         return;
     }
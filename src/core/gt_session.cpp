@@ -17,6 +17,7 @@
 #include "gt_coreapplication.h"
 #include "gt_logging.h"
 #include "gt_algorithms.h"
+#include "internal/gt_startupprofiler.h"
 
 GtSession::GtSession(const QString& id, QString sessionPath) :
     m_currentProject(nullptr)
@@ -51,6 +52,9 @@ GtSession::loadProjectData(GtProject* project)
         return retval;
     }
 
+    auto phase = gt::detail::startupPhase(
+                QStringLiteral("open project %1").arg(project->objectName()));
+
     // module data
     GtObjectList moduleData = project->readModuleData();
     retval.append(moduleData);
@@ -77,12 +81,13 @@ GtSession::saveProjectData(GtProject* project)
         return false;
     }
 
-    if (!project->saveProjectOverallData())
+    // module data first, the project file stores the module file hashes
+    if (!project->saveModuleData())
     {
         return false;
     }
 
-    if (!project->saveModuleData())
+    if (!project->saveProjectOverallData())
     {
         return false;
     }
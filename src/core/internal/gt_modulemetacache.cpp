@@ -0,0 +1,234 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gt_modulemetacache.h"
+
+#include "gt_logging.h"
+
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QPluginLoader>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QtConcurrent>
+
+#include <vector>
+
+const int gt::detail::ModuleMetaCache::S_VERSION = 1;
+const char* gt::detail::ModuleMetaCache::S_CACHE_DIR_ENV_VAR = "GTLAB_CACHE_DIR";
+
+namespace
+{
+
+/// json keys of the cache file
+const QString S_VERSION_KEY  = QStringLiteral("version");
+const QString S_QT_KEY       = QStringLiteral("qt");
+const QString S_ENTRIES_KEY  = QStringLiteral("modules");
+const QString S_PATH_KEY     = QStringLiteral("path");
+const QString S_SIZE_KEY     = QStringLiteral("size");
+const QString S_MODIFIED_KEY = QStringLiteral("modified");
+const QString S_META_KEY     = QStringLiteral("meta");
+
+/// job for reading the meta data of a library
+struct ReadJob
+{
+    QString file;
+    QFileInfo info;
+    QJsonObject meta{};
+};
+
+} // namespace
+
+using namespace gt::detail;
+
+ModuleMetaCache::ModuleMetaCache(QString cacheFilePath) :
+    m_filePath(std::move(cacheFilePath))
+{
+    read();
+}
+
+QString
+ModuleMetaCache::defaultCacheFilePath()
+{
+    QString path = qEnvironmentVariable(S_CACHE_DIR_ENV_VAR);
+    if (path.isEmpty())
+    {
+        path = QStandardPaths::writableLocation(
+                   QStandardPaths::CacheLocation);
+    }
+
+    QDir dir(path);
+
+    return dir.absoluteFilePath(QStringLiteral("module_meta_cache.json"));
+}
+
+std::map<QString, QJsonObject>
+ModuleMetaCache::metaData(QStringList const& files)
+{
+    m_hits = 0;
+    m_misses = 0;
+
+    std::map<QString, QJsonObject> result;
+    std::vector<ReadJob> jobs;
+
+    for (QString const& file : files)
+    {
+        QFileInfo info(file);
+
+        auto iter = m_entries.find(file);
+        if (iter != m_entries.end() &&
+            iter->second.size == info.size() &&
+            iter->second.modified ==
+                info.lastModified().toMSecsSinceEpoch())
+        {
+            result.insert({file, iter->second.meta});
+            m_hits += 1;
+            continue;
+        }
+
+        jobs.push_back({file, info});
+    }
+
+    // loading the libraries is expensive, thus the meta data is read
+    // in parallel
+    QtConcurrent::blockingMap(jobs, [](ReadJob& job){
+        job.meta = QPluginLoader(job.file).metaData();
+    });
+
+    for (ReadJob& job : jobs)
+    {
+        Entry entry;
+        entry.size = job.info.size();
+        entry.modified = job.info.lastModified().toMSecsSinceEpoch();
+        entry.meta = job.meta;
+
+        result.insert({job.file, job.meta});
+        m_entries[job.file] = std::move(entry);
+        m_misses += 1;
+        m_dirty = true;
+    }
+
+    // remove entries of libraries, which no longer exist. Libraries of other
+    // module directories (e.g. of another installation sharing the cache)
+    // are kept
+    for (auto iter = m_entries.begin(); iter != m_entries.end();)
+    {
+        if (result.find(iter->first) == result.end() &&
+            !QFileInfo::exists(iter->first))
+        {
+            iter = m_entries.erase(iter);
+            m_dirty = true;
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+
+    return result;
+}
+
+bool
+ModuleMetaCache::save()
+{
+    if (!m_dirty) return true;
+
+    QJsonArray entries;
+    for (auto const& e : m_entries)
+    {
+        QJsonObject json;
+        json.insert(S_PATH_KEY, e.first);
+        json.insert(S_SIZE_KEY, e.second.size);
+        json.insert(S_MODIFIED_KEY, e.second.modified);
+        json.insert(S_META_KEY, e.second.meta);
+        entries.append(json);
+    }
+
+    QJsonObject root;
+    root.insert(S_VERSION_KEY, S_VERSION);
+    root.insert(S_QT_KEY, QStringLiteral(QT_VERSION_STR));
+    root.insert(S_ENTRIES_KEY, entries);
+
+    QFileInfo info(m_filePath);
+    if (!QDir().mkpath(info.absolutePath()))
+    {
+        gtWarning() << QObject::tr("Failed to create the module cache "
+                                   "directory '%1'!").arg(info.absolutePath());
+        return false;
+    }
+
+    // other processes may read the cache concurrently
+    QSaveFile file(m_filePath);
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        gtWarning() << QObject::tr("Failed to write the module cache '%1'!")
+                       .arg(m_filePath);
+        return false;
+    }
+
+    file.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+
+    if (!file.commit())
+    {
+        gtWarning() << QObject::tr("Failed to write the module cache '%1'!")
+                       .arg(m_filePath);
+        return false;
+    }
+
+    m_dirty = false;
+    return true;
+}
+
+int
+ModuleMetaCache::hits() const
+{
+    return m_hits;
+}
+
+int
+ModuleMetaCache::misses() const
+{
+    return m_misses;
+}
+
+void
+ModuleMetaCache::read()
+{
+    QFile file(m_filePath);
+    if (!file.exists() || !file.open(QIODevice::ReadOnly))
+    {
+        return;
+    }
+
+    QJsonObject root = QJsonDocument::fromJson(file.readAll()).object();
+
+    // the meta data format may depend on the qt version
+    if (root.value(S_VERSION_KEY).toInt() != S_VERSION ||
+        root.value(S_QT_KEY).toString() != QStringLiteral(QT_VERSION_STR))
+    {
+        gtDebug().medium() << QObject::tr("Ignoring outdated module cache");
+        m_dirty = true;
+        return;
+    }
+
+    QJsonArray const entries = root.value(S_ENTRIES_KEY).toArray();
+    for (auto const& value : entries)
+    {
+        QJsonObject json = value.toObject();
+
+        Entry entry;
+        entry.size = static_cast<qint64>(json.value(S_SIZE_KEY).toDouble(-1));
+        entry.modified =
+                static_cast<qint64>(json.value(S_MODIFIED_KEY).toDouble(-1));
+        entry.meta = json.value(S_META_KEY).toObject();
+
+        m_entries[json.value(S_PATH_KEY).toString()] = std::move(entry);
+    }
+}
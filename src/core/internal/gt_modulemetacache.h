@@ -0,0 +1,123 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef GTMODULEMETACACHE_H
+#define GTMODULEMETACACHE_H
+
+#include "gt_core_exports.h"
+
+#include <QJsonObject>
+#include <QString>
+#include <QStringList>
+
+#include <map>
+
+namespace gt
+{
+namespace detail
+{
+
+/**
+ * @brief The ModuleMetaCache class.
+ * Persistent cache of the plugin meta data of the module libraries. Reading
+ * the meta data requires opening each library, which is expensive for large
+ * libraries or on network file systems. The cache stores the meta data
+ * together with the size and the modification time of each library, thus an
+ * entry is validated by a single stat call. Libraries that are not cached
+ * are read in parallel.
+ */
+class GT_CORE_EXPORT ModuleMetaCache
+{
+public:
+
+    /// version of the cache file format
+    static const int S_VERSION;
+
+    /// name of the environment variable overriding the cache directory
+    static const char* S_CACHE_DIR_ENV_VAR;
+
+    /**
+     * @brief Constructor. Reads the cache file if it exists.
+     * @param cacheFilePath Path of the cache file
+     */
+    explicit ModuleMetaCache(QString cacheFilePath = defaultCacheFilePath());
+
+    /**
+     * @brief Returns the default location of the cache file (user specific
+     * cache directory). The directory can be overridden by the environment
+     * variable S_CACHE_DIR_ENV_VAR.
+     * @return Cache file path
+     */
+    static QString defaultCacheFilePath();
+
+    /**
+     * @brief Returns the plugin meta data of the libraries. Cached entries
+     * are used if size and modification time of the library did not change.
+     * All other libraries are read in parallel and added to the cache.
+     * Entries of libraries, which no longer exist, are removed.
+     * @param files Absolute paths of the libraries
+     * @return Plugin meta data by library path. Empty if the file is not a
+     * plugin.
+     */
+    std::map<QString, QJsonObject> metaData(QStringList const& files);
+
+    /**
+     * @brief Writes the cache file if an entry was changed
+     * @return Success
+     */
+    bool save();
+
+    /**
+     * @brief Returns the number of libraries read from the cache by the last
+     * call to metaData
+     * @return Number of cache hits
+     */
+    int hits() const;
+
+    /**
+     * @brief Returns the number of libraries that had to be read by the last
+     * call to metaData
+     * @return Number of cache misses
+     */
+    int misses() const;
+
+private:
+
+    /// cache entry
+    struct Entry
+    {
+        /// size of the library in bytes
+        qint64 size{-1};
+        /// modification time of the library (ms since epoch)
+        qint64 modified{-1};
+        /// plugin meta data
+        QJsonObject meta;
+    };
+
+    /// path of the cache file
+    QString m_filePath;
+
+    /// cache entries by library path
+    std::map<QString, Entry> m_entries;
+
+    /// whether the cache must be written
+    bool m_dirty{false};
+
+    /// statistics of the last call to metaData
+    int m_hits{0};
+    int m_misses{0};
+
+    /**
+     * @brief Reads the cache file. Invalid or outdated files are ignored.
+     */
+    void read();
+};
+
+} // namespace detail
+
+} // namespace gt
+
+#endif // GTMODULEMETACACHE_H
@@ -0,0 +1,184 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gt_logging.h"
+#include "gt_processcomponent.h"
+#include "gt_task.h"
+
+#include <QMutexLocker>
+
+#include "gt_monitoringtransfer.h"
+
+using namespace gt::detail;
+
+MonitoringTransfer::MonitoringTransfer(QObject* parent) :
+    QObject(parent)
+{
+    connect(&m_timer, &QTimer::timeout, this, &MonitoringTransfer::flush);
+}
+
+MonitoringTransfer::~MonitoringTransfer() = default;
+
+void
+MonitoringTransfer::registerComponent(GtProcessComponent& cloned,
+                                      GtProcessComponent& orig)
+{
+    QVector<PropertyMapping> mappings;
+
+    // map all monitoring properties to original
+    for (GtAbstractProperty* prop : cloned.monitoringProperties())
+    {
+        GtAbstractProperty* origProp = orig.findProperty(prop->ident());
+
+        if (!origProp)
+        {
+            gtWarning() << tr("Transfer of monitoring property failed. "
+                              "'%1' not found!").arg(prop->ident());
+            continue;
+        }
+
+        mappings.append({prop, origProp});
+    }
+
+    // map property struct container monitoring properties to original
+    for (const auto& ref : cloned.containerMonitoringPropertyRefs())
+    {
+        auto* prop = ref.resolve(cloned);
+        auto* origProp = ref.resolve(orig);
+
+        if (!prop || !origProp)
+        {
+            gtWarning() << tr("Transfer of monitoring property failed. "
+                              "'%1' not found!").arg(ref.toString());
+            continue;
+        }
+
+        mappings.append({prop, origProp});
+    }
+
+    m_mappings.insert(&cloned, mappings);
+
+    // the signals are emitted in the thread of the running component,
+    // thus the updates are only stored
+    connect(&cloned, &GtProcessComponent::transferMonitoringProperties,
+            this, [this, &cloned]() {
+        collectProperties(&cloned);
+    }, Qt::DirectConnection);
+
+    auto* clonedTask = qobject_cast<GtTask*>(&cloned);
+    auto* origTask = qobject_cast<GtTask*>(&orig);
+
+    if (!clonedTask || !origTask) return;
+
+    m_tasks.insert(clonedTask, origTask);
+
+    connect(clonedTask, &GtTask::monitoringDataTransfer,
+            this, [this, clonedTask](int iteration, GtMonitoringDataSet set) {
+        collectMonitoringData(clonedTask, iteration, set);
+    }, Qt::DirectConnection);
+    connect(clonedTask, &GtTask::triggerClearMonitoringData,
+            this, [this, clonedTask]() {
+        collectClear(clonedTask);
+    }, Qt::DirectConnection);
+}
+
+void
+MonitoringTransfer::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_pendingValues.clear();
+    m_pendingData.clear();
+    m_tasks.clear();
+    m_mappings.clear();
+}
+
+void
+MonitoringTransfer::start(int interval)
+{
+    m_timer.start(interval);
+}
+
+void
+MonitoringTransfer::stop()
+{
+    m_timer.stop();
+    flush();
+}
+
+void
+MonitoringTransfer::collectProperties(GtProcessComponent const* cloned)
+{
+    auto iter = m_mappings.constFind(cloned);
+
+    if (iter == m_mappings.constEnd())
+    {
+        gtWarning() << tr("Component not found in mapping structure!");
+        return;
+    }
+
+    // only the latest value of each property is transferred
+    QMutexLocker locker(&m_mutex);
+    for (const PropertyMapping& mapping : iter.value())
+    {
+        m_pendingValues.insert(&mapping, mapping.source->valueToVariant());
+    }
+}
+
+void
+MonitoringTransfer::collectMonitoringData(GtTask const* cloned,
+                                          int iteration,
+                                          GtMonitoringDataSet const& set)
+{
+    QMutexLocker locker(&m_mutex);
+    m_pendingData[cloned].sets.append({iteration, set});
+}
+
+void
+MonitoringTransfer::collectClear(GtTask const* cloned)
+{
+    QMutexLocker locker(&m_mutex);
+    PendingData& data = m_pendingData[cloned];
+    data.clear = true;
+    data.sets.clear();
+}
+
+void
+MonitoringTransfer::flush()
+{
+    QHash<PropertyMapping const*, QVariant> values;
+    QHash<GtTask const*, PendingData> data;
+
+    {
+        QMutexLocker locker(&m_mutex);
+        values.swap(m_pendingValues);
+        data.swap(m_pendingData);
+    }
+
+    for (auto iter = values.constBegin(); iter != values.constEnd(); ++iter)
+    {
+        if (GtAbstractProperty* target = iter.key()->target)
+        {
+            target->setValueFromVariant(iter.value());
+        }
+    }
+
+    for (auto iter = data.begin(); iter != data.end(); ++iter)
+    {
+        GtTask* orig = m_tasks.value(iter.key());
+
+        if (!orig) continue;
+
+        if (iter->clear)
+        {
+            orig->clearMonitoringData();
+        }
+
+        if (!iter->sets.isEmpty())
+        {
+            orig->appendMonitoringData(iter->sets);
+        }
+    }
+}
@@ -0,0 +1,154 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef GTMONITORINGTRANSFER_H
+#define GTMONITORINGTRANSFER_H
+
+#include "gt_core_exports.h"
+
+#include "gt_monitoringdataset.h"
+
+#include <QHash>
+#include <QMutex>
+#include <QObject>
+#include <QPair>
+#include <QPointer>
+#include <QTimer>
+#include <QVariant>
+#include <QVector>
+
+class GtAbstractProperty;
+class GtProcessComponent;
+class GtTask;
+
+namespace gt
+{
+namespace detail
+{
+
+/**
+ * @brief Transfers the monitoring data of a running (cloned) task to the
+ * original task at a bounded rate.
+ *
+ * The running task only stores its updates: the latest value of each
+ * monitoring property and the monitoring data sets of all iterations.
+ * The updates are applied to the original task periodically. Thus, the
+ * number of events posted to the thread of the original task does not depend
+ * on the number of iterations. The properties of the clone are mapped to the
+ * properties of the original once when the components are registered.
+ */
+class GT_CORE_EXPORT MonitoringTransfer : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    /// default interval between two transfers in ms
+    static constexpr int S_DEFAULT_INTERVAL = 100;
+
+    explicit MonitoringTransfer(QObject* parent = nullptr);
+    ~MonitoringTransfer() override;
+
+    /**
+     * @brief Registers a cloned process component. The monitoring properties
+     * of the clone are mapped to the properties of the original and the
+     * monitoring signals of the clone are connected.
+     * @param cloned Running process component
+     * @param orig Original process component
+     */
+    void registerComponent(GtProcessComponent& cloned,
+                           GtProcessComponent& orig);
+
+    /**
+     * @brief Removes all registered components. Pending updates are
+     * discarded.
+     */
+    void clear();
+
+    /**
+     * @brief Starts the periodic transfer
+     * @param interval Interval between two transfers in ms
+     */
+    void start(int interval = S_DEFAULT_INTERVAL);
+
+    /**
+     * @brief Stops the periodic transfer and transfers all pending updates
+     */
+    void stop();
+
+    /**
+     * @brief Stores the current values of the monitoring properties of the
+     * component. Thread safe, called in the thread of the component.
+     * @param cloned Running process component
+     */
+    void collectProperties(GtProcessComponent const* cloned);
+
+    /**
+     * @brief Stores the monitoring data set of an iteration. Thread safe.
+     * @param cloned Running task
+     * @param iteration Iteration number
+     * @param set Monitoring data set
+     */
+    void collectMonitoringData(GtTask const* cloned, int iteration,
+                               GtMonitoringDataSet const& set);
+
+    /**
+     * @brief Discards the stored monitoring data sets and clears the
+     * monitoring data of the original task on the next transfer. Thread safe.
+     * @param cloned Running task
+     */
+    void collectClear(GtTask const* cloned);
+
+public slots:
+
+    /**
+     * @brief Applies all pending updates to the original components. Must be
+     * called in the thread of the original components.
+     */
+    void flush();
+
+private:
+
+    /// maps a monitoring property of the clone to the original property
+    struct PropertyMapping
+    {
+        GtAbstractProperty const* source;
+        QPointer<GtAbstractProperty> target;
+    };
+
+    /// pending monitoring data of a task
+    struct PendingData
+    {
+        /// whether the monitoring data of the original must be cleared
+        bool clear{false};
+        /// monitoring data sets by iteration
+        QVector<QPair<int, GtMonitoringDataSet>> sets;
+    };
+
+    /// property mappings of the cloned components. Not modified while the
+    /// task is running
+    QHash<GtProcessComponent const*, QVector<PropertyMapping>> m_mappings;
+
+    /// original tasks of the cloned tasks
+    QHash<GtTask const*, QPointer<GtTask>> m_tasks;
+
+    /// guards the pending updates
+    QMutex m_mutex;
+
+    /// latest values of the monitoring properties
+    QHash<PropertyMapping const*, QVariant> m_pendingValues;
+
+    /// pending monitoring data of the cloned tasks
+    QHash<GtTask const*, PendingData> m_pendingData;
+
+    /// triggers the periodic transfer
+    QTimer m_timer;
+};
+
+} // namespace detail
+} // namespace gt
+
+#endif // GTMONITORINGTRANSFER_H
@@ -0,0 +1,121 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef GTMPSCQUEUE_H
+#define GTMPSCQUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include <vector>
+
+namespace gt
+{
+namespace detail
+{
+
+/**
+ * @brief The MpscQueue class.
+ * Lock-free queue with multiple producers and a single consumer. Producers
+ * push single elements, the consumer takes all queued elements at once.
+ * Since elements are never removed individually, the queue is not affected
+ * by the ABA problem.
+ */
+template <typename T>
+class MpscQueue
+{
+public:
+
+    MpscQueue() = default;
+
+    ~MpscQueue()
+    {
+        clear(m_head.exchange(nullptr));
+    }
+
+    MpscQueue(MpscQueue const&) = delete;
+    MpscQueue& operator=(MpscQueue const&) = delete;
+
+    /**
+     * @brief Appends an element. May be called from any thread.
+     * @param value Value to append
+     * @return Whether the queue was empty before
+     */
+    bool push(T value)
+    {
+        Node* node = new Node{std::move(value), nullptr};
+        Node* head = m_head.load(std::memory_order_relaxed);
+
+        // the node must not be accessed once it is published, as the
+        // consumer may take it immediately
+        do
+        {
+            node->next = head;
+        }
+        while (!m_head.compare_exchange_weak(head, node,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed));
+
+        return head == nullptr;
+    }
+
+    /**
+     * @brief Removes all elements. Must only be called by the consumer.
+     * @return Elements in order of their insertion
+     */
+    std::vector<T> takeAll()
+    {
+        Node* node = m_head.exchange(nullptr, std::memory_order_acquire);
+
+        std::vector<T> values;
+        for (Node* n = node; n; n = n->next)
+        {
+            values.push_back(std::move(n->value));
+        }
+        clear(node);
+
+        // the nodes are linked from newest to oldest
+        std::reverse(values.begin(), values.end());
+        return values;
+    }
+
+    /**
+     * @brief Returns whether the queue is empty. The result may be outdated
+     * immediately if producers are active.
+     * @return Is empty
+     */
+    bool empty() const
+    {
+        return m_head.load(std::memory_order_relaxed) == nullptr;
+    }
+
+private:
+
+    struct Node
+    {
+        T value;
+        Node* next;
+    };
+
+    /// newest element
+    std::atomic<Node*> m_head{nullptr};
+
+    static void clear(Node* node)
+    {
+        while (node)
+        {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+};
+
+} // namespace detail
+
+} // namespace gt
+
+#endif // GTMPSCQUEUE_H
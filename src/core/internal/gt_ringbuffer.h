@@ -0,0 +1,171 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef GTRINGBUFFER_H
+#define GTRINGBUFFER_H
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+#include <vector>
+
+namespace gt
+{
+namespace detail
+{
+
+/**
+ * @brief The RingBuffer class.
+ * Sequence with a fixed capacity. Elements are appended at the back,
+ * removing elements at the front does not move any other element.
+ */
+template <typename T>
+class RingBuffer
+{
+public:
+
+    /**
+     * @brief Constructor
+     * @param capacity Maximum number of elements
+     */
+    explicit RingBuffer(size_t capacity = 0) :
+        m_data(capacity)
+    { }
+
+    /// number of elements
+    size_t size() const { return m_size; }
+
+    /// maximum number of elements
+    size_t capacity() const { return m_data.size(); }
+
+    bool empty() const { return m_size == 0; }
+
+    bool full() const { return m_size == m_data.size(); }
+
+    /// element at position i (0 is the oldest element)
+    T& operator[](size_t i)
+    {
+        assert(i < m_size);
+        return m_data[physical(i)];
+    }
+
+    T const& operator[](size_t i) const
+    {
+        assert(i < m_size);
+        return m_data[physical(i)];
+    }
+
+    /**
+     * @brief Appends an element. Overwrites the oldest element if the
+     * buffer is full.
+     * @param value Value to append
+     */
+    void push_back(T value)
+    {
+        if (m_data.empty()) return;
+
+        if (full())
+        {
+            m_data[m_head] = std::move(value);
+            m_head = (m_head + 1) % m_data.size();
+            return;
+        }
+
+        m_data[physical(m_size)] = std::move(value);
+        m_size += 1;
+    }
+
+    /**
+     * @brief Removes the n oldest elements in constant time
+     * @param n Number of elements to remove
+     */
+    void pop_front(size_t n = 1)
+    {
+        n = std::min(n, m_size);
+        for (size_t i = 0; i < n; ++i)
+        {
+            // release resources of the removed elements
+            m_data[physical(i)] = T{};
+        }
+
+        if (!m_data.empty()) m_head = (m_head + n) % m_data.size();
+        m_size -= n;
+    }
+
+    /**
+     * @brief Removes the elements [first, first + n). Subsequent elements
+     * are moved, thus this takes linear time unless first is 0.
+     * @param first Position of the first element to remove
+     * @param n Number of elements to remove
+     */
+    void erase(size_t first, size_t n)
+    {
+        if (first >= m_size) return;
+        n = std::min(n, m_size - first);
+
+        if (first == 0) return pop_front(n);
+
+        for (size_t i = first; i + n < m_size; ++i)
+        {
+            (*this)[i] = std::move((*this)[i + n]);
+        }
+        for (size_t i = m_size - n; i < m_size; ++i)
+        {
+            (*this)[i] = T{};
+        }
+
+        m_size -= n;
+    }
+
+    /// removes all elements
+    void clear()
+    {
+        std::fill(m_data.begin(), m_data.end(), T{});
+        m_head = 0;
+        m_size = 0;
+    }
+
+    /**
+     * @brief Changes the capacity. The newest elements are kept.
+     * @param capacity New capacity
+     */
+    void setCapacity(size_t capacity)
+    {
+        size_t n = std::min(capacity, m_size);
+
+        std::vector<T> data(capacity);
+        for (size_t i = 0; i < n; ++i)
+        {
+            data[i] = std::move((*this)[m_size - n + i]);
+        }
+
+        m_data = std::move(data);
+        m_head = 0;
+        m_size = n;
+    }
+
+private:
+
+    /// storage
+    std::vector<T> m_data;
+
+    /// physical position of the oldest element
+    size_t m_head{0};
+
+    /// number of elements
+    size_t m_size{0};
+
+    size_t physical(size_t i) const
+    {
+        return (m_head + i) % m_data.size();
+    }
+};
+
+} // namespace detail
+
+} // namespace gt
+
+#endif // GTRINGBUFFER_H
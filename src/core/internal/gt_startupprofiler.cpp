@@ -0,0 +1,249 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gt_startupprofiler.h"
+
+#include "gt_logging.h"
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <algorithm>
+
+using namespace gt::detail;
+
+const char* StartupProfiler::S_ENV_VAR = "GTLAB_STARTUP_TRACE";
+const QString StartupProfiler::S_STARTUP = QStringLiteral("startup");
+const QString StartupProfiler::S_MODULE = QStringLiteral("module");
+
+StartupProfiler::Scope::Scope(StartupProfiler* profiler,
+                              QString name,
+                              QString category) :
+    m_profiler(profiler),
+    m_name(std::move(name)),
+    m_category(std::move(category))
+{
+    if (!m_profiler) return;
+
+    m_depth = m_profiler->enter();
+    m_start = m_profiler->elapsed();
+}
+
+StartupProfiler::Scope::Scope(Scope&& other) noexcept :
+    m_profiler(other.m_profiler),
+    m_name(std::move(other.m_name)),
+    m_category(std::move(other.m_category)),
+    m_start(other.m_start),
+    m_depth(other.m_depth)
+{
+    other.m_profiler = nullptr;
+}
+
+StartupProfiler::Scope::~Scope()
+{
+    end();
+}
+
+void
+StartupProfiler::Scope::end()
+{
+    if (!m_profiler) return;
+
+    Event event;
+    event.name = std::move(m_name);
+    event.category = std::move(m_category);
+    event.start = m_start;
+    event.duration = m_profiler->elapsed() - m_start;
+    event.depth = m_depth;
+
+    m_profiler->record(std::move(event));
+    m_profiler = nullptr;
+}
+
+StartupProfiler::StartupProfiler()
+{
+    m_timer.start();
+
+    QString value = qEnvironmentVariable(S_ENV_VAR);
+    m_enabled = !value.isEmpty();
+
+    if (value.endsWith(QStringLiteral(".json"), Qt::CaseInsensitive))
+    {
+        m_traceFilePath = value;
+    }
+}
+
+StartupProfiler&
+StartupProfiler::instance()
+{
+    static StartupProfiler self;
+    return self;
+}
+
+bool
+StartupProfiler::isEnabled() const
+{
+    return m_enabled;
+}
+
+void
+StartupProfiler::setEnabled(bool enabled)
+{
+    m_enabled = enabled;
+}
+
+QString const&
+StartupProfiler::traceFilePath() const
+{
+    return m_traceFilePath;
+}
+
+void
+StartupProfiler::setTraceFilePath(QString filePath)
+{
+    m_traceFilePath = std::move(filePath);
+}
+
+StartupProfiler::Scope
+StartupProfiler::phase(QString name, QString const& category)
+{
+    // inactive scope
+    if (!m_enabled || m_finished)
+    {
+        return Scope{nullptr, {}, {}};
+    }
+
+    return Scope{this, std::move(name), category};
+}
+
+qint64
+StartupProfiler::elapsed() const
+{
+    return m_timer.nsecsElapsed() / 1000;
+}
+
+std::vector<StartupProfiler::Event>
+StartupProfiler::events() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_events;
+}
+
+void
+StartupProfiler::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_events.clear();
+    m_depth = 0;
+    m_finished = false;
+}
+
+QString
+StartupProfiler::summary() const
+{
+    auto events = this->events();
+
+    // list the phases in order of their start
+    std::stable_sort(events.begin(), events.end(),
+                     [](Event const& a, Event const& b){
+        return a.start < b.start;
+    });
+
+    QString text;
+    for (Event const& e : events)
+    {
+        text += QStringLiteral("%1%2 [%3]: %4 ms (at %5 ms)\n")
+                    .arg(QString(2 * e.depth, ' '), e.name, e.category)
+                    .arg(e.duration / 1000.0, 0, 'f', 1)
+                    .arg(e.start / 1000.0, 0, 'f', 1);
+    }
+
+    text += QStringLiteral("total: %1 ms")
+                .arg(elapsed() / 1000.0, 0, 'f', 1);
+
+    return text;
+}
+
+QByteArray
+StartupProfiler::toChromeTrace() const
+{
+    qint64 pid = QCoreApplication::applicationPid();
+
+    QJsonArray traceEvents;
+    for (Event const& e : events())
+    {
+        QJsonObject json;
+        json.insert(QStringLiteral("name"), e.name);
+        json.insert(QStringLiteral("cat"), e.category);
+        json.insert(QStringLiteral("ph"), QStringLiteral("X"));
+        json.insert(QStringLiteral("ts"), e.start);
+        json.insert(QStringLiteral("dur"), e.duration);
+        json.insert(QStringLiteral("pid"), pid);
+        json.insert(QStringLiteral("tid"), 0);
+        traceEvents.append(json);
+    }
+
+    QJsonObject root;
+    root.insert(QStringLiteral("traceEvents"), traceEvents);
+    root.insert(QStringLiteral("displayTimeUnit"), QStringLiteral("ms"));
+
+    return QJsonDocument(root).toJson(QJsonDocument::Compact);
+}
+
+bool
+StartupProfiler::writeChromeTrace(QString const& filePath) const
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        gtWarning() << QObject::tr("Failed to write the startup trace '%1'!")
+                       .arg(filePath);
+        return false;
+    }
+
+    file.write(toChromeTrace());
+    return true;
+}
+
+void
+StartupProfiler::finish()
+{
+    if (!m_enabled || m_finished) return;
+
+    m_finished = true;
+
+    gtInfo() << QObject::tr("Startup phases:\n%1").arg(summary());
+
+    if (!m_traceFilePath.isEmpty() && writeChromeTrace(m_traceFilePath))
+    {
+        gtInfo() << QObject::tr("Startup trace written to '%1'")
+                    .arg(m_traceFilePath);
+    }
+}
+
+void
+StartupProfiler::record(Event event)
+{
+    QMutexLocker locker(&m_mutex);
+    m_depth = std::max(0, m_depth - 1);
+    m_events.push_back(std::move(event));
+}
+
+int
+StartupProfiler::enter()
+{
+    QMutexLocker locker(&m_mutex);
+    return m_depth++;
+}
+
+StartupProfiler::Scope
+gt::detail::startupPhase(QString name, QString const& category)
+{
+    return StartupProfiler::instance().phase(std::move(name), category);
+}
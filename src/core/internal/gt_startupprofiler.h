@@ -0,0 +1,231 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef GTSTARTUPPROFILER_H
+#define GTSTARTUPPROFILER_H
+
+#include "gt_core_exports.h"
+
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QString>
+
+#include <vector>
+
+namespace gt
+{
+namespace detail
+{
+
+/**
+ * @brief The StartupProfiler class.
+ * Records the wall time of the startup phases of GTlab and GTlabConsole
+ * (application initialization, module meta data, loading and initializing
+ * each module, session and project loading).
+ *
+ * The profiler is enabled by setting the environment variable
+ * `GTLAB_STARTUP_TRACE`. Once the startup has finished, a summary of all
+ * phases is logged. If the variable is set to a file path ending with
+ * ".json", the phases are additionally written to this file in the Chrome
+ * trace event format (chrome://tracing, Perfetto).
+ */
+class GT_CORE_EXPORT StartupProfiler
+{
+public:
+
+    /// name of the environment variable enabling the profiler
+    static const char* S_ENV_VAR;
+
+    /// category of the application startup phases
+    static const QString S_STARTUP;
+
+    /// category of the phases of a single module
+    static const QString S_MODULE;
+
+    /// recorded phase
+    struct Event
+    {
+        /// name of the phase
+        QString name;
+        /// category of the phase
+        QString category;
+        /// start time in us since the profiler was created
+        qint64 start{0};
+        /// duration in us
+        qint64 duration{0};
+        /// nesting level of the phase
+        int depth{0};
+    };
+
+    /**
+     * @brief Records a phase from its construction until its destruction.
+     * Does nothing if the profiler is disabled.
+     */
+    class GT_CORE_EXPORT Scope
+    {
+    public:
+
+        Scope(StartupProfiler* profiler, QString name, QString category);
+        ~Scope();
+
+        Scope(Scope&& other) noexcept;
+        Scope(Scope const&) = delete;
+        Scope& operator=(Scope const&) = delete;
+        Scope& operator=(Scope&&) = delete;
+
+        /**
+         * @brief Ends the phase before the scope is destroyed. Subsequent
+         * calls do nothing.
+         */
+        void end();
+
+    private:
+
+        StartupProfiler* m_profiler;
+        QString m_name;
+        QString m_category;
+        qint64 m_start{0};
+        int m_depth{0};
+    };
+
+    /**
+     * @brief Constructor. Enables the profiler if the environment variable
+     * is set.
+     */
+    StartupProfiler();
+
+    /**
+     * @brief Returns the profiler of the application. Should be accessed
+     * early in the main function, as all times are measured relative to the
+     * creation of the instance.
+     * @return Profiler instance
+     */
+    static StartupProfiler& instance();
+
+    /**
+     * @brief Returns whether phases are recorded
+     * @return Is enabled
+     */
+    bool isEnabled() const;
+
+    /**
+     * @brief Enables or disables the profiler
+     * @param enabled Enabled
+     */
+    void setEnabled(bool enabled);
+
+    /**
+     * @brief Returns the file path the chrome trace is written to when
+     * the startup has finished
+     * @return Trace file path (may be empty)
+     */
+    QString const& traceFilePath() const;
+
+    /**
+     * @brief Sets the file path the chrome trace is written to
+     * @param filePath Trace file path
+     */
+    void setTraceFilePath(QString filePath);
+
+    /**
+     * @brief Starts a phase, which ends once the returned scope is
+     * destroyed
+     * @param name Name of the phase
+     * @param category Category of the phase
+     * @return Scope of the phase
+     */
+    Scope phase(QString name, QString const& category = S_STARTUP);
+
+    /**
+     * @brief Returns the time since the profiler was created
+     * @return Elapsed time in us
+     */
+    qint64 elapsed() const;
+
+    /**
+     * @brief Returns the recorded phases in order of completion
+     * @return Phases
+     */
+    std::vector<Event> events() const;
+
+    /**
+     * @brief Removes all recorded phases
+     */
+    void clear();
+
+    /**
+     * @brief Returns a summary of the recorded phases. Each line lists a
+     * phase with its duration and start time, nested phases are indented.
+     * @return Summary
+     */
+    QString summary() const;
+
+    /**
+     * @brief Returns the recorded phases in the Chrome trace event format
+     * @return Json data
+     */
+    QByteArray toChromeTrace() const;
+
+    /**
+     * @brief Writes the recorded phases in the Chrome trace event format
+     * @param filePath File path
+     * @return Success
+     */
+    bool writeChromeTrace(QString const& filePath) const;
+
+    /**
+     * @brief Marks the end of the startup. Logs the summary and writes
+     * the chrome trace if a trace file path is set. Subsequent calls do
+     * nothing.
+     */
+    void finish();
+
+private:
+
+    /// reference time
+    QElapsedTimer m_timer;
+
+    /// recorded phases
+    std::vector<Event> m_events;
+
+    /// current nesting level
+    int m_depth{0};
+
+    /// file path of the chrome trace
+    QString m_traceFilePath;
+
+    /// whether phases are recorded
+    bool m_enabled{false};
+
+    /// whether the startup has finished
+    bool m_finished{false};
+
+    /// protects the recorded phases
+    mutable QMutex m_mutex;
+
+    /// called by a scope once a phase has ended
+    void record(Event event);
+
+    /// called by a scope once a phase has started
+    int enter();
+};
+
+/**
+ * @brief Starts a startup phase of the application profiler, which ends once
+ * the returned scope is destroyed
+ * @param name Name of the phase
+ * @param category Category of the phase
+ * @return Scope of the phase
+ */
+GT_CORE_EXPORT StartupProfiler::Scope startupPhase(
+        QString name,
+        QString const& category = StartupProfiler::S_STARTUP);
+
+} // namespace detail
+
+} // namespace gt
+
+#endif // GTSTARTUPPROFILER_H
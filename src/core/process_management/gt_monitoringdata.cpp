@@ -48,6 +48,12 @@ GtMonitoringData::data()
     return m_data;
 }
 
+const QMap<QString, QVariant>&
+GtMonitoringData::data() const
+{
+    return m_data;
+}
+
 bool
 GtMonitoringData::contains(const QString& pId)
 {
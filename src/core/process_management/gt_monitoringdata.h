@@ -43,6 +43,7 @@ public:
      * @return Monitoring data map.
      */
     const QMap<QString, QVariant>& data();
+    const QMap<QString, QVariant>& data() const;
 
     /**
      * @brief Returns true if property identification string exists,
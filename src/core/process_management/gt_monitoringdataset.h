@@ -65,6 +65,12 @@ public:
      */
     GtMonitoringData getData(const QString& uuid);
 
+    /**
+     * @brief Returns the monitoring data of all process components.
+     * @return Monitoring data by process component UUID.
+     */
+    const QMap<QString, GtMonitoringData>& data() const;
+
 private:
     /// Monitoring data.
     QMap<QString, GtMonitoringData> m_data;
@@ -13,6 +13,247 @@
 
 #include "gt_monitoringdatatable.h"
 
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+
+using Column = GtMonitoringDataTable::Column;
+
+constexpr double S_NAN = std::numeric_limits<double>::quiet_NaN();
+
+/**
+ * @brief Returns the storage type of a value
+ * @param value Value
+ * @return Storage type
+ */
+Column::Type
+storageType(const QVariant& value)
+{
+    switch (static_cast<QMetaType::Type>(value.userType()))
+    {
+    case QMetaType::Bool:
+    case QMetaType::Char:
+    case QMetaType::SChar:
+    case QMetaType::UChar:
+    case QMetaType::Short:
+    case QMetaType::UShort:
+    case QMetaType::Int:
+        return Column::Int;
+    // values that are represented exactly by a double
+    case QMetaType::UInt:
+    case QMetaType::Float:
+    case QMetaType::Double:
+        return Column::Double;
+    // 64 bit integers may exceed the precision of a double
+    default:
+        return Column::Variant;
+    }
+}
+
+} // namespace
+
+GtMonitoringDataTable::Column::Type
+GtMonitoringDataTable::Column::type() const
+{
+    return m_type;
+}
+
+int
+GtMonitoringDataTable::Column::size() const
+{
+    return m_valid.size();
+}
+
+bool
+GtMonitoringDataTable::Column::hasValue(int idx) const
+{
+    return idx >= 0 && idx < m_valid.size() && m_valid.testBit(idx);
+}
+
+const QVector<double>&
+GtMonitoringDataTable::Column::doubles() const
+{
+    return m_doubles;
+}
+
+const QVector<int>&
+GtMonitoringDataTable::Column::ints() const
+{
+    return m_ints;
+}
+
+const QVector<QVariant>&
+GtMonitoringDataTable::Column::variants() const
+{
+    return m_variants;
+}
+
+QVariant
+GtMonitoringDataTable::Column::value(int idx) const
+{
+    if (!hasValue(idx))
+    {
+        return {};
+    }
+
+    switch (m_type)
+    {
+    case Int:
+        return m_ints[idx];
+    case Double:
+        return m_doubles[idx];
+    case Variant:
+        return m_variants[idx];
+    case Empty:
+        break;
+    }
+
+    return {};
+}
+
+double
+GtMonitoringDataTable::Column::toDouble(int idx) const
+{
+    if (!hasValue(idx))
+    {
+        return S_NAN;
+    }
+
+    switch (m_type)
+    {
+    case Int:
+        return m_ints[idx];
+    case Double:
+        return m_doubles[idx];
+    case Variant:
+    {
+        bool ok = false;
+        double value = m_variants[idx].toDouble(&ok);
+        return ok ? value : S_NAN;
+    }
+    case Empty:
+        break;
+    }
+
+    return S_NAN;
+}
+
+void
+GtMonitoringDataTable::Column::resize(int size)
+{
+    int oldSize = m_valid.size();
+    m_valid.resize(size);
+
+    switch (m_type)
+    {
+    case Int:
+        m_ints.resize(size);
+        break;
+    case Double:
+        m_doubles.resize(size);
+        if (size > oldSize)
+        {
+            std::fill(m_doubles.begin() + oldSize, m_doubles.end(), S_NAN);
+        }
+        break;
+    case Variant:
+        m_variants.resize(size);
+        break;
+    case Empty:
+        break;
+    }
+}
+
+void
+GtMonitoringDataTable::Column::set(int idx, const QVariant& value)
+{
+    if (!value.isValid() || idx < 0 || idx >= size())
+    {
+        return;
+    }
+
+    Type type = storageType(value);
+
+    if (m_type == Empty)
+    {
+        promote(type);
+    }
+    else if (m_type != type && m_type != Variant)
+    {
+        // integers are stored in double columns, everything else requires
+        // a variant column
+        if (m_type == Int && type == Double)
+        {
+            promote(Double);
+        }
+        else if (!(m_type == Double && type == Int))
+        {
+            promote(Variant);
+        }
+    }
+
+    switch (m_type)
+    {
+    case Int:
+        m_ints[idx] = value.toInt();
+        break;
+    case Double:
+        m_doubles[idx] = value.toDouble();
+        break;
+    case Variant:
+        m_variants[idx] = value;
+        break;
+    case Empty:
+        return;
+    }
+
+    m_valid.setBit(idx);
+}
+
+void
+GtMonitoringDataTable::Column::promote(Type type)
+{
+    const int n = size();
+
+    switch (type)
+    {
+    case Int:
+        m_ints = QVector<int>(n, 0);
+        break;
+    case Double:
+    {
+        QVector<double> doubles(n, S_NAN);
+        for (int i = 0; i < n; ++i)
+        {
+            if (m_valid.testBit(i)) doubles[i] = toDouble(i);
+        }
+        m_doubles = std::move(doubles);
+        break;
+    }
+    case Variant:
+    {
+        QVector<QVariant> variants(n);
+        for (int i = 0; i < n; ++i)
+        {
+            if (m_valid.testBit(i)) variants[i] = value(i);
+        }
+        m_variants = std::move(variants);
+        break;
+    }
+    case Empty:
+        break;
+    }
+
+    // release the previous storage
+    if (type != Int) m_ints.clear();
+    if (type != Double) m_doubles.clear();
+    if (type != Variant) m_variants.clear();
+
+    m_type = type;
+}
+
 GtMonitoringDataTable::GtMonitoringDataTable()
 {
 
@@ -21,13 +262,15 @@ GtMonitoringDataTable::GtMonitoringDataTable()
 void
 GtMonitoringDataTable::clear()
 {
-    m_data.clear();
+    m_size = 0;
+    m_columns.clear();
+    m_columnIndex.clear();
 }
 
 int
 GtMonitoringDataTable::size() const
 {
-    return m_data.size();
+    return m_size;
 }
 
 bool
@@ -40,29 +283,55 @@ GtMonitoringDataTable::append(int iteration,
         return false;
     }
 
-    // get current data size
-    const int dataSize = m_data.size();
-
     // validate iteration number with current data size
-    if (iteration <= dataSize)
+    if (iteration <= m_size)
     {
         return false;
     }
 
-    // fill missing iterations using empty data sets
-    for (int i = dataSize; i < (iteration - 1); i++)
+    // missing iterations are filled with missing values
+    m_size = iteration;
+
+    for (Column& column : m_columns)
     {
-        m_data << GtMonitoringDataSet();
+        column.resize(m_size);
     }
 
-    // append new data set
-    m_data << dataSet;
+    const int idx = iteration - 1;
+
+    const auto& components = dataSet.data();
+    for (auto comp = components.cbegin(); comp != components.cend(); ++comp)
+    {
+        const auto& properties = comp.value().data();
+        for (auto prop = properties.cbegin(); prop != properties.cend(); ++prop)
+        {
+            QPair<QString, QString> key{comp.key(), prop.key()};
+
+            auto iter = m_columnIndex.find(key);
+            if (iter == m_columnIndex.end())
+            {
+                iter = m_columnIndex.insert(key, m_columns.size());
+                m_columns.append(Column{});
+                m_columns.last().resize(m_size);
+            }
+
+            m_columns[iter.value()].set(idx, prop.value());
+        }
+    }
 
     return true;
 }
 
 QVector<QVariant>
 GtMonitoringDataTable::getData(const QString& compUuid, const QString& propId)
+{
+    return static_cast<const GtMonitoringDataTable*>(this)->getData(compUuid,
+                                                                    propId);
+}
+
+QVector<QVariant>
+GtMonitoringDataTable::getData(const QString& compUuid,
+                               const QString& propId) const
 {
     // check strings
     if (propId.isEmpty() || compUuid.isEmpty())
@@ -74,20 +343,30 @@ GtMonitoringDataTable::getData(const QString& compUuid, const QString& propId)
     // create and initialize return vector
     QVector<QVariant> retval(size(), QVariant());
 
-    for (int i = 0; i < m_data.size(); i++)
-    {
-        if (m_data[i].contains(compUuid))
-        {
-            GtMonitoringData mdata = m_data[i].getData(compUuid);
+    const Column* col = column(compUuid, propId);
 
-            if (mdata.contains(propId))
-            {
-                QVariant mval = mdata.getData(propId);
+    if (!col)
+    {
+        return retval;
+    }
 
-                retval[i] = mval;
-            }
-        }
+    for (int i = 0; i < m_size; i++)
+    {
+        retval[i] = col->value(i);
     }
 
     return retval;
 }
+
+const GtMonitoringDataTable::Column*
+GtMonitoringDataTable::column(const QString& compUuid,
+                              const QString& propId) const
+{
+    auto iter = m_columnIndex.find(qMakePair(compUuid, propId));
+    if (iter == m_columnIndex.end())
+    {
+        return nullptr;
+    }
+
+    return &m_columns[iter.value()];
+}
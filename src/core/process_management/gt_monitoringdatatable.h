@@ -14,16 +14,134 @@
 
 #include "gt_core_exports.h"
 
+#include <QBitArray>
+#include <QHash>
+#include <QPair>
+#include <QVariant>
 #include <QVector>
 
 #include "gt_monitoringdataset.h"
 
 /**
- * @brief The GtMonitoringDataTable class
+ * @brief The GtMonitoringDataTable class.
+ * Stores the monitoring data of all iterations column wise, i.e. one column
+ * per monitored property of a process component. Numeric values are stored
+ * contiguously, thus series can be accessed without copying.
  */
 class GT_CORE_EXPORT GtMonitoringDataTable
 {
 public:
+    /**
+     * @brief The Column class.
+     * Values of one monitored property of all iterations. The storage type
+     * is deduced from the values: Integers and booleans are stored as int,
+     * unsigned integers and floating point values as double. Mixed numeric
+     * columns are stored as double, any other values as variant. Thus 64 bit
+     * integers are stored as variant to keep their precision. Values of int
+     * and double columns are returned as int and double respectively.
+     */
+    class GT_CORE_EXPORT Column
+    {
+    public:
+        enum Type
+        {
+            /// no value was set yet
+            Empty,
+            Int,
+            Double,
+            Variant
+        };
+
+        /**
+         * @brief Returns the storage type of the column.
+         * @return Storage type
+         */
+        Type type() const;
+
+        /**
+         * @brief Returns the number of values, i.e. the number of iterations.
+         * @return Number of values
+         */
+        int size() const;
+
+        /**
+         * @brief Returns whether a value was monitored in the iteration.
+         * @param idx Index of the iteration (iteration - 1)
+         * @return Whether a value exists
+         */
+        bool hasValue(int idx) const;
+
+        /**
+         * @brief Returns the values of a double column. Missing values are
+         * NaN. Empty for any other type.
+         * @return Values
+         */
+        const QVector<double>& doubles() const;
+
+        /**
+         * @brief Returns the values of an int column. Missing values are 0,
+         * use hasValue to check for missing values. Empty for any other type.
+         * @return Values
+         */
+        const QVector<int>& ints() const;
+
+        /**
+         * @brief Returns the values of a variant column. Missing values are
+         * null. Empty for any other type.
+         * @return Values
+         */
+        const QVector<QVariant>& variants() const;
+
+        /**
+         * @brief Returns the value of the iteration as variant.
+         * @param idx Index of the iteration (iteration - 1)
+         * @return Value. Null if missing
+         */
+        QVariant value(int idx) const;
+
+        /**
+         * @brief Returns the value of the iteration as double.
+         * @param idx Index of the iteration (iteration - 1)
+         * @return Value. NaN if missing or not numeric
+         */
+        double toDouble(int idx) const;
+
+    private:
+
+        friend class GtMonitoringDataTable;
+
+        /// storage type
+        Type m_type{Empty};
+        /// whether a value exists per iteration
+        QBitArray m_valid;
+        /// double values
+        QVector<double> m_doubles;
+        /// int values
+        QVector<int> m_ints;
+        /// any other values
+        QVector<QVariant> m_variants;
+
+        /**
+         * @brief Resizes the column. New entries are missing values
+         * @param size New size
+         */
+        void resize(int size);
+
+        /**
+         * @brief Sets the value of the iteration. The storage type is
+         * promoted if necessary.
+         * @param idx Index of the iteration (iteration - 1)
+         * @param value Value
+         */
+        void set(int idx, const QVariant& value);
+
+        /**
+         * @brief Changes the storage type. Converts the existing values.
+         * @param type New storage type
+         */
+        void promote(Type type);
+    };
+
     /**
      * @brief Constructor.
      */
@@ -58,9 +176,35 @@ public:
      */
     QVector<QVariant> getData(const QString& compUuid, const QString& propId);
 
+    /**
+     * @brief Returns data based on given process component uuid and property
+     * identification string.
+     * @param Process component UUID
+     * @param Property identifications tring
+     * @return Monitoring data.
+     */
+    QVector<QVariant> getData(const QString& compUuid,
+                              const QString& propId) const;
+
+    /**
+     * @brief Returns the column of the given property. The column has the
+     * size of the table. The pointer is invalidated by append and clear.
+     * @param Process component UUID
+     * @param Property identifications tring
+     * @return Column. Null if the property was never monitored.
+     */
+    const Column* column(const QString& compUuid,
+                         const QString& propId) const;
+
 private:
-    /// List of monitoring data sets.
-    QVector<GtMonitoringDataSet> m_data;
+    /// Number of iterations.
+    int m_size{0};
+
+    /// Columns of the monitored properties.
+    QVector<Column> m_columns;
+
+    /// Index of the column by process component UUID and property id.
+    QHash<QPair<QString, QString>, int> m_columnIndex;
 
 };
 
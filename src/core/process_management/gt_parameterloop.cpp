@@ -8,21 +8,90 @@
  *  Author: Jens Schmeink (AT-TWK)
  *  Tel.: +49 2203 601 2191
  */
+#include <QDir>
+#include <QtConcurrent>
+
+#include <vector>
+
 #include "gt_calculator.h"
+#include "gt_abstractrunnable.h"
+#include "gt_objectfactory.h"
+#include "gt_objectmementodiff.h"
+#include "gt_propertyconnection.h"
 
 #include "gt_parameterloop.h"
 
+namespace
+{
+
+/// runnable holding the copies of the linked data of a single sweep point.
+/// Directories and paths are provided by the runnable of the loop.
+class SweepRunnable : public GtAbstractRunnable
+{
+public:
+
+    explicit SweepRunnable(GtAbstractRunnable& parent) : m_parent(parent)
+    {
+        setAutoDelete(false);
+    }
+
+    void run() override {}
+
+    QDir tempDir() override { return m_parent.tempDir(); }
+
+    bool clearTempDir(const QString& path) override
+    {
+        return m_parent.clearTempDir(path);
+    }
+
+    QString projectPath() override { return m_parent.projectPath(); }
+
+    void appendLinkedObject(GtObject* obj) { m_linkedObjects.append(obj); }
+
+private:
+
+    GtAbstractRunnable& m_parent;
+};
+
+/// input and results of a single sweep point
+struct SweepPoint
+{
+    /// iteration index of the sweep point
+    int iteration{0};
+    /// value of the sweep parameter
+    double value{0.};
+    /// whether the linked data is kept for the merge
+    bool keepData{false};
+    /// whether the sweep point failed
+    bool failed{false};
+    /// monitoring data of the sweep point
+    GtMonitoringDataSet monitoringData;
+    /// states of all process components of the loop copy
+    QList<GtProcessComponent::STATE> states;
+    /// linked data after the run
+    QList<GtObjectMemento> data;
+};
+
+} // namespace
+
 GtParameterLoop::GtParameterLoop() :
     m_startVal("start", "start"),
     m_endVal("end", "end"),
     m_steps("steps", "steps"),
-    m_currentVal("currentVal", "currentVal")
+    m_currentVal("currentVal", "currentVal"),
+    m_parallel("parallel", tr("Parallel Execution"),
+               tr("Evaluates the sweep points concurrently. Each sweep point "
+                  "runs on an independent copy of the loop and of the "
+                  "original linked data, thus the sweep points must not "
+                  "depend on each other. Only the linked data of the last "
+                  "sweep point is kept."), false)
 {
     setObjectName("Parameter Loop");
 
     registerProperty(m_startVal);
     registerProperty(m_endVal);
     registerProperty(m_steps);
+    registerProperty(m_parallel);
 
     registerMonitoringProperty(m_currentVal);
 }
@@ -140,3 +209,229 @@ GtParameterLoop::runChildElements()
 
     return true;
 }
+
+bool
+GtParameterLoop::runIteration()
+{
+    if (!m_parallel)
+    {
+        return GtTask::runIteration();
+    }
+
+    return runParallelSweep();
+}
+
+bool
+GtParameterLoop::runParallelSweep()
+{
+    GtAbstractRunnable* parentRunnable = runnable();
+
+    if (!parentRunnable)
+    {
+        gtError() << tr("%1: Runnable not found!").arg(objectName());
+        return false;
+    }
+
+    // the original objects are only accessed by this thread, the sweep
+    // points are restored from mementos
+    GtObjectMemento const loopMemento = toMemento();
+    GtAbstractObjectFactory* loopFactory = factory();
+
+    QList<GtObjectMemento> dataMementos;
+    for (GtObject* obj : parentRunnable->linkedObjects())
+    {
+        dataMementos << obj->toMemento();
+    }
+
+    // connections between the components of the loop may be defined by
+    // the parent tasks
+    QList<GtObjectMemento> connectionMementos;
+    for (auto* task = qobject_cast<GtTask*>(parentObject()); task;
+         task = qobject_cast<GtTask*>(task->parentObject()))
+    {
+        for (auto* con : task->findDirectChildren<GtPropertyConnection*>())
+        {
+            if (getObjectByUuid(con->sourceUuid()) &&
+                getObjectByUuid(con->targetUuid()))
+            {
+                connectionMementos << con->toMemento();
+            }
+        }
+    }
+
+    std::vector<SweepPoint> points(m_maxIter.getVal());
+    for (int i = 0; i < m_maxIter.getVal(); ++i)
+    {
+        points[i].iteration = i + 1;
+        points[i].value = value(i);
+    }
+    points.back().keepData = true;
+
+    gtDebug() << tr("running %1 sweep points in parallel...")
+                 .arg(static_cast<int>(points.size()));
+
+    QtConcurrent::blockingMap(points, [&](SweepPoint& point) {
+        if (isInterruptionRequested())
+        {
+            point.failed = true;
+            return;
+        }
+
+        SweepRunnable pointRunnable(*parentRunnable);
+
+        for (GtObjectMemento memento : dataMementos)
+        {
+            GtObject* obj = memento.restore(gtObjectFactory);
+
+            if (!obj)
+            {
+                point.failed = true;
+                return;
+            }
+
+            pointRunnable.appendLinkedObject(obj);
+        }
+
+        auto* loop = GtObjectMemento(loopMemento)
+                .restore<GtParameterLoop*>(loopFactory);
+
+        if (!loop || !pointRunnable.appendProcessComponent(loop))
+        {
+            delete loop;
+            point.failed = true;
+            return;
+        }
+
+        for (GtObjectMemento memento : connectionMementos)
+        {
+            if (auto* con = memento.restore<GtPropertyConnection*>(
+                    loopFactory))
+            {
+                loop->appendChild(con);
+            }
+        }
+
+        for (auto* con : loop->findChildren<GtPropertyConnection*>())
+        {
+            if (!con->isConnected()) con->makeConnection();
+        }
+
+        loop->m_currentIter.setVal(point.iteration);
+        loop->m_currentVal.setVal(point.value);
+
+        QList<GtProcessComponent*> const childs = loop->processComponents();
+
+        for (GtProcessComponent* comp : childs)
+        {
+            comp->setStateRecursively(GtProcessComponent::QUEUED);
+        }
+
+        for (GtProcessComponent* comp : childs)
+        {
+            auto* calc = qobject_cast<GtCalculator*>(comp);
+
+            if (!comp->exec() && calc)
+            {
+                gtWarning() << tr("Sweep point %1 failed")
+                               .arg(point.iteration);
+                break;
+            }
+
+            if (isInterruptionRequested())
+            {
+                point.failed = true;
+                break;
+            }
+
+            if (calc && calc->runFailsOnWarning() &&
+                calc->currentState() == GtProcessComponent::WARN_FINISHED)
+            {
+                calc->setState(FAILED);
+                point.failed = true;
+                break;
+            }
+        }
+
+        point.monitoringData = loop->collectMonitoringData();
+
+        for (auto* comp : loop->findChildren<GtProcessComponent*>())
+        {
+            point.states << comp->currentState();
+        }
+
+        if (point.keepData)
+        {
+            for (GtObject* obj : pointRunnable.linkedObjects())
+            {
+                point.data << obj->toMemento();
+            }
+        }
+    });
+
+    if (isInterruptionRequested())
+    {
+        gtWarning() << "task terminated!";
+        setState(GtProcessComponent::TERMINATED);
+        return false;
+    }
+
+    // gather the results in order of the iterations
+    SweepPoint const* result = &points.back();
+
+    for (SweepPoint const& point : points)
+    {
+        m_currentIter.setVal(point.iteration);
+        m_currentVal.setVal(point.value);
+
+        emit transferMonitoringProperties();
+
+        if (!point.monitoringData.isEmpty())
+        {
+            emit monitoringDataTransfer(point.iteration, point.monitoringData);
+        }
+
+        if (point.failed)
+        {
+            result = &point;
+            break;
+        }
+    }
+
+    // the component states of the resulting sweep point are reported
+    QList<GtProcessComponent*> const comps =
+            findChildren<GtProcessComponent*>();
+
+    if (comps.size() == result->states.size())
+    {
+        for (int i = 0; i < comps.size(); ++i)
+        {
+            comps[i]->setState(result->states[i]);
+        }
+    }
+
+    if (result->failed)
+    {
+        setState(GtProcessComponent::FAILED);
+        return false;
+    }
+
+    // the linked data is updated with the results of the last sweep point.
+    // Changes of the other sweep points are discarded
+    QList<GtObject*> const& linked = parentRunnable->linkedObjects();
+
+    for (int i = 0; i < linked.size() && i < result->data.size(); ++i)
+    {
+        GtObjectMementoDiff diff(linked[i]->toMemento(), result->data[i]);
+
+        if (!diff.isNull() && !linked[i]->applyDiff(diff))
+        {
+            gtError() << tr("%1: Failed to apply the results of the sweep!")
+                         .arg(objectName());
+            return false;
+        }
+    }
+
+    m_lastEval = GtTask::EVAL_FINISHED;
+
+    return true;
+}
@@ -15,6 +15,7 @@
 
 #include "gt_task.h"
 
+#include "gt_boolproperty.h"
 #include "gt_doubleproperty.h"
 #include "gt_intproperty.h"
 
@@ -38,9 +39,28 @@ public:
 
     bool setUp() override;
 
+    /**
+     * @brief Runs the sweep. If parallel execution is enabled, all sweep
+     * points are evaluated concurrently, otherwise the default iteration
+     * procedure is used.
+     * @return Whether the sweep was successful
+     */
+    bool runIteration() override;
+
 private:
     bool runChildElements() override;
 
+    /**
+     * @brief Evaluates all sweep points concurrently. Each sweep point runs
+     * on an independent copy of the loop and of the original linked data,
+     * thus a sweep point does not see the changes of the previous ones.
+     * The monitoring data is emitted in order of the iterations. Only the
+     * linked data of the last sweep point is kept, the changes of all other
+     * sweep points are discarded.
+     * @return Whether the sweep was successful
+     */
+    bool runParallelSweep();
+
     GtDoubleProperty m_startVal;
 
     GtDoubleProperty m_endVal;
@@ -49,6 +69,8 @@ private:
 
     GtDoubleProperty m_currentVal;
 
+    GtBoolProperty m_parallel;
+
     /**
      * @brief value -  calculates the current value for the iteration step
      * @param iteration
@@ -58,6 +58,9 @@ struct GtProcessComponent::Impl
 
     /// Warning flag
     bool warning;
+
+    /// Whether a copy of the whole source data is required
+    bool fullSourceData{false};
 };
 
 GtProcessComponent::GtProcessComponent() :
@@ -341,6 +344,18 @@ GtProcessComponent::hasWarnings() const
     return pimpl->warning;
 }
 
+bool
+GtProcessComponent::requiresFullSourceData() const
+{
+    return pimpl->fullSourceData;
+}
+
+void
+GtProcessComponent::setRequiresFullSourceData(bool val)
+{
+    pimpl->fullSourceData = val;
+}
+
 GtProcessComponent::~GtProcessComponent() = default;
 
 GtProcessComponent::STATE
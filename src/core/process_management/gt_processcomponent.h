@@ -157,6 +157,15 @@ public:
      */
     bool hasWarnings() const;
 
+    /**
+     * @brief Returns whether the process component requires a copy of the
+     * whole source data (e.g. all packages of the project) when executed.
+     * By default only the objects referenced by object links and object
+     * paths are copied.
+     * @return Whether the full source data is required.
+     */
+    bool requiresFullSourceData() const;
+
     /**
      * @brief Returns process and project specific temporary directory.
      * @return Temporary directory object.
@@ -310,6 +319,16 @@ protected:
      */
     void setWarningFlag(bool val);
 
+    /**
+     * @brief Sets whether the process component requires a copy of the
+     * whole source data when executed. Must be enabled if the component
+     * accesses objects which are not referenced by its object link or
+     * object path properties (e.g. by searching the linked objects of the
+     * runnable).
+     * @param val Whether the full source data is required.
+     */
+    void setRequiresFullSourceData(bool val);
+
     /**
      * @brief Returns uuid string of given object link property.
      * @param prop Object link property.
@@ -12,6 +12,7 @@
 #include "gt_accessdata.h"
 #include "gt_calculator.h"
 #include "gt_abstractrunnable.h"
+#include "gt_boolproperty.h"
 #include "gt_coreapplication.h"
 #include "gt_objectlinkproperty.h"
 #include "gt_objectpathproperty.h"
@@ -42,6 +43,15 @@ struct GtTask::Impl
         gt::process_runner::S_ACCESS_ID,
         tr("Process Runner to run task with. Only relevant for the root task")
     };
+
+    /// Whether the task is executed on a copy of the whole project data
+    GtBoolProperty fullSourceData{
+        "fullSourceData", tr("Copy Full Project Data"),
+        tr("Executes the task on a copy of all packages of the project "
+           "instead of only the objects referenced by the process "
+           "components. Must be enabled if a process component accesses "
+           "objects it does not reference."), false
+    };
 };
 
 GtTask::GtTask() :
@@ -66,6 +76,7 @@ GtTask::GtTask() :
     qRegisterMetaType<GtMonitoringDataSet>("GtMonitoringDataSet");
 
     registerProperty(pimpl->processRunner, tr("Execution"));
+    registerProperty(pimpl->fullSourceData, tr("Execution"));
 
     pimpl->processRunner.hide(!gtApp || !gtApp->devMode());
 }
@@ -327,6 +338,12 @@ GtTask::selectedProcessRunner() const
     return pimpl->processRunner.accessData();
 }
 
+bool
+GtTask::fullSourceDataRequested() const
+{
+    return pimpl->fullSourceData.getVal();
+}
+
 void
 GtTask::onObjectDataMerged()
 {
@@ -601,6 +618,29 @@ GtTask::onMonitoringDataAvailable(int iteration, GtMonitoringDataSet const& set)
     emit monitoringDataAvailable();
 }
 
+void
+GtTask::appendMonitoringData(
+        QVector<QPair<int, GtMonitoringDataSet>> const& sets)
+{
+    bool appended = false;
+
+    for (auto const& entry : sets)
+    {
+        if (!pimpl->monitoringDataTable.append(entry.first, entry.second))
+        {
+            gtWarning().medium() << tr("Could not append data set!");
+            continue;
+        }
+
+        appended = true;
+    }
+
+    if (appended)
+    {
+        emit monitoringDataAvailable();
+    }
+}
+
 void
 GtTask::clearMonitoringData()
 {
@@ -131,6 +131,15 @@ public:
      */
     GtAccessData selectedProcessRunner() const;
 
+    /**
+     * @brief Returns whether the user requested to execute the task on a
+     * copy of the whole source data. This allows executing process
+     * components, which access objects they do not reference, without
+     * modifying them (see GtProcessComponent::requiresFullSourceData).
+     * @return Whether the full source data is requested
+     */
+    bool fullSourceDataRequested() const;
+
     /**
      * @brief Called after successfully restoring from memento
      */
@@ -163,6 +172,14 @@ public slots:
     void onMonitoringDataAvailable(int iteration,
                                    const GtMonitoringDataSet& set);
 
+    /**
+     * @brief Appends the monitoring data sets of several iterations.
+     * The monitoring data available signal is emitted only once.
+     * @param sets Monitoring data sets and their iteration numbers.
+     */
+    void appendMonitoringData(
+            const QVector<QPair<int, GtMonitoringDataSet>>& sets);
+
     /**
      * @brief Clears entire monitoring data.
      */
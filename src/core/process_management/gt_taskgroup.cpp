@@ -170,10 +170,21 @@ GtTaskGroup::save(const QString& projectPath,
         return false;
     }
 
+    const QString groupPath = m_pimpl->path(projectPath, scope);
+
     // externalize tasks
     for (const GtTask* task : findDirectChildren<GtTask*>())
     {
-        if (!m_pimpl->saveTaskToFile(task, m_pimpl->path(projectPath, scope)))
+        // skip tasks which have not changed since the last save
+        if (!task->hasChanges() && !task->hasChildChanged() &&
+            !task->newlyCreated() &&
+            QFile::exists(groupPath + QDir::separator() + task->uuid() +
+                          S_TASK_FILE_EXT))
+        {
+            continue;
+        }
+
+        if (!m_pimpl->saveTaskToFile(task, groupPath))
         {
             return false;
         }
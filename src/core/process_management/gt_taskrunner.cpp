@@ -9,8 +9,11 @@
  *  Tel.: +49 2203 601 2907
  */
 
+#include <QSet>
 #include <QThreadPool>
 
+#include <algorithm>
+
 #include "gt_logging.h"
 #include "gt_processcomponent.h"
 #include "gt_task.h"
@@ -20,11 +23,53 @@
 #include "gt_processdata.h"
 #include "gt_labeldata.h"
 #include "gt_structproperty.h"
+#include "gt_propertystructcontainer.h"
+#include "gt_objectpathproperty.h"
+#include "gt_relativeobjectlinkproperty.h"
+#include "gt_objectpath.h"
+#include "internal/gt_monitoringtransfer.h"
 
 #include "gt_taskrunner.h"
 
+namespace
+{
+
+/// appends the property and all of its sub properties to the list
+void
+appendProperties(GtAbstractProperty const* prop,
+                 QList<GtAbstractProperty const*>& list)
+{
+    list.append(prop);
+
+    for (GtAbstractProperty const* child : prop->fullProperties())
+    {
+        appendProperties(child, list);
+    }
+}
+
+/// returns all properties of the object including the entries of its
+/// property containers
+QList<GtAbstractProperty const*>
+allProperties(GtObject const& obj)
+{
+    QList<GtAbstractProperty const*> retval = obj.fullPropertyList();
+
+    for (auto const& container : obj.propertyContainers())
+    {
+        for (size_t i = 0; i < container.get().size(); ++i)
+        {
+            appendProperties(&container.get().at(i), retval);
+        }
+    }
+
+    return retval;
+}
+
+} // namespace
+
 GtTaskRunner::GtTaskRunner(GtTask* task) : m_task(task), m_runnable(nullptr),
-    m_source(nullptr)
+    m_source(nullptr),
+    m_monitoring(new gt::detail::MonitoringTransfer(this))
 {
 }
 
@@ -70,21 +115,11 @@ GtTaskRunner::setUp(GtAbstractRunnable* runnable, GtObject* source)
     m_dataToMerge.clear();
 
     // clear component mapping
-    m_componentMap.clear();
+    m_monitoring->clear();
 
-    // transfer source meta data to runnable
-    foreach (GtObject* srcObj, m_source->findDirectChildren<GtObject*>())
+    // transfer source data to runnable
+    foreach (GtObject* srcObj, collectSourceData(*m_task, *m_source))
     {
-        if (qobject_cast<GtProcessData*>(srcObj))
-        {
-            continue;
-        }
-
-        if (qobject_cast<GtLabelData*>(srcObj))
-        {
-            continue;
-        }
-
         m_runnable->appendSourceData(srcObj->toMemento());
     }
 
@@ -133,6 +168,9 @@ GtTaskRunner::run()
     // get global thread pool instance
     QThreadPool* tp = QThreadPool::globalInstance();
 
+    // transfer monitoring data periodically while the runnable is running
+    m_monitoring->start();
+
     // start runnable
     tp->start(m_runnable);
 }
@@ -143,6 +181,142 @@ GtTaskRunner::dataToMerge() const
     return m_dataToMerge;
 }
 
+QList<GtObject*>
+GtTaskRunner::collectSourceData(GtTask& task, GtObject& source)
+{
+    QList<GtObject*> topLevel;
+
+    foreach (GtObject* srcObj, source.findDirectChildren<GtObject*>())
+    {
+        if (qobject_cast<GtProcessData*>(srcObj))
+        {
+            continue;
+        }
+
+        if (qobject_cast<GtLabelData*>(srcObj))
+        {
+            continue;
+        }
+
+        topLevel.append(srcObj);
+    }
+
+    QList<GtProcessComponent*> components =
+            task.findChildren<GtProcessComponent*>();
+    components.prepend(&task);
+
+    bool fullSnapshot = std::any_of(components.begin(), components.end(),
+                                    [](GtProcessComponent const* pc) {
+        auto const* task = qobject_cast<GtTask const*>(pc);
+        return pc->requiresFullSourceData() ||
+               (task && task->fullSourceDataRequested());
+    });
+
+    if (fullSnapshot)
+    {
+        return topLevel;
+    }
+
+    // objects to snapshot, the order of discovery is kept
+    QList<GtObject*> linked;
+    QSet<GtObject const*> linkedSet;
+    // objects of which the properties are searched for links
+    QList<GtObject const*> pending(components.begin(), components.end());
+    QSet<GtObject const*> searched;
+
+    auto appendLinked = [&](GtObject* obj) {
+        if (!obj || linkedSet.contains(obj))
+        {
+            return;
+        }
+
+        linked.append(obj);
+        linkedSet.insert(obj);
+
+        // links of the snapshot must be resolvable as well
+        pending.append(obj);
+        for (GtObject const* child : obj->findChildren<GtObject*>())
+        {
+            pending.append(child);
+        }
+    };
+
+    while (!pending.isEmpty())
+    {
+        GtObject const* obj = pending.takeFirst();
+
+        // children of nested linked objects are listed more than once
+        if (searched.contains(obj))
+        {
+            continue;
+        }
+        searched.insert(obj);
+
+        for (GtAbstractProperty const* prop : allProperties(*obj))
+        {
+            if (auto* link = qobject_cast<GtObjectLinkProperty const*>(prop))
+            {
+                appendLinked(source.getObjectByUuid(
+                                 link->linkedObjectUUID()));
+            }
+            else if (auto* rel =
+                     qobject_cast<GtRelativeObjectLinkProperty const*>(prop))
+            {
+                appendLinked(source.getObjectByUuid(rel->getVal()));
+            }
+            else if (auto* path =
+                     qobject_cast<GtObjectPathProperty const*>(prop))
+            {
+                // paths are resolved starting at the top level objects,
+                // thus the whole top level object is required
+                for (GtObject* top : qAsConst(topLevel))
+                {
+                    if (path->path().getObject(top))
+                    {
+                        appendLinked(top);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    QSet<GtObject const*> topLevelSet;
+    for (GtObject const* top : qAsConst(topLevel))
+    {
+        topLevelSet.insert(top);
+    }
+
+    // only top level data may be snapshot, process and label data are
+    // never transferred. Nested linked objects stay part of the snapshot of
+    // their linked ancestor instead of being transferred as separate roots.
+    QList<GtObject*> retval;
+
+    for (GtObject* obj : qAsConst(linked))
+    {
+        bool valid = topLevelSet.contains(obj);
+        bool nested = false;
+
+        for (GtObject const* p = obj; !valid && !nested;)
+        {
+            p = p->parentObject();
+            if (!p) break;
+
+            nested = linkedSet.contains(p);
+            valid = topLevelSet.contains(p);
+        }
+
+        if (valid && !nested)
+        {
+            retval.append(obj);
+        }
+    }
+
+    gtDebug().medium() << tr("Source data objects:") << retval.size();
+
+    return retval;
+}
+
 GtTask*
 GtTaskRunner::cloneTask()
 {
@@ -221,30 +395,9 @@ GtTaskRunner::setupElements(GtProcessComponent* orig,
             orig, &GtProcessComponent::handleStateChanged);
     connect(cloned, &GtProcessComponent::progressStateChanged,
             orig, &GtProcessComponent::setProgress);
-    connect(cloned, &GtProcessComponent::transferMonitoringProperties,
-            this, &GtTaskRunner::transferMonitoringProperties);
-
-    // check whether process component is a task
-    GtTask* tmpTaskOrig = qobject_cast<GtTask*>(orig);
-
-    if (tmpTaskOrig)
-    {
-        // cast cloned process component to task
-        GtTask* tmpTaskCloned = qobject_cast<GtTask*>(cloned);
-
-        // check cloned task object
-        if (tmpTaskCloned)
-        {
-            // connect task specific signals
-            connect(tmpTaskCloned, &GtTask::monitoringDataTransfer,
-                    tmpTaskOrig, &GtTask::onMonitoringDataAvailable);
-            connect(tmpTaskCloned, &GtTask::triggerClearMonitoringData,
-                    tmpTaskOrig, &GtTask::clearMonitoringData);
-        }
-    }
 
-    // append to component mapping structure
-    m_componentMap.insert(cloned, orig);
+    // map monitoring properties and connect monitoring signals
+    m_monitoring->registerComponent(*cloned, *orig);
 
     // loop over children and setup them recursively
     for (int i = 0; i < origChilds.size(); i++)
@@ -275,6 +428,10 @@ GtTaskRunner::handleRunnableFinished()
 
     m_dataToMerge.append(m_runnable->outputData());
 
+    // transfer remaining monitoring data before the clones are deleted
+    m_monitoring->stop();
+    m_monitoring->clear();
+
     delete m_runnable;
 
     if (m_task)
@@ -285,64 +442,3 @@ GtTaskRunner::handleRunnableFinished()
 
     emit finished();
 }
-
-void
-GtTaskRunner::transferMonitoringProperties()
-{
-    // cast sender to process component
-    GtProcessComponent* component = qobject_cast<GtProcessComponent*>(sender());
-
-    // check process component
-    if (!component)
-    {
-        // not a process component
-        return;
-    }
-
-    // check whether component is registered in mapping structure
-    if (!m_componentMap.contains(component))
-    {
-        qWarning() << "component not found in mapping structure!";
-        return;
-    }
-
-    // get original process component from mapping structure
-    GtProcessComponent* orig = m_componentMap.value(component);
-
-    // transfer all monitoring properties to original
-    foreach (GtAbstractProperty* prop, component->monitoringProperties())
-    {
-        // find property in original
-        GtAbstractProperty* origProp = orig->findProperty(prop->ident());
-
-        // check original property
-        if (!origProp)
-        {
-            qWarning() << "original property not found!";
-            return;
-        }
-
-        // set original property to new value
-        origProp->setValueFromVariant(prop->valueToVariant());
-    }
-
-    // transfer property struct container monitoring properties to original
-    for(const auto& ref : component->containerMonitoringPropertyRefs())
-    {
-        auto* oProp = ref.resolve(*orig);
-
-        // check original property
-        if (!oProp)
-        {
-            qWarning() << tr("Transfer of monitoring property failed. "
-                             "'%1' not found!").arg(ref.toString());
-            return;
-        }
-
-        // set original property to new value
-        if (auto* prop = ref.resolve(*component))
-        {
-            oProp->setValueFromVariant(prop->valueToVariant());
-        }
-    }
-}
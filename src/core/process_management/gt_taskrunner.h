@@ -26,6 +26,14 @@ class GtProcessComponent;
 class GtObject;
 class GtObjectLinkProperty;
 
+namespace gt
+{
+namespace detail
+{
+class MonitoringTransfer;
+} // namespace detail
+} // namespace gt
+
 /**
  * @brief The GtTaskRunner class
  */
@@ -63,6 +71,19 @@ public:
      */
     const QList<GtObjectMemento>& dataToMerge() const;
 
+    /**
+     * @brief Collects the source objects which are transferred to the
+     * runnable. Only the objects referenced by object link, relative object
+     * link and object path properties of the task and of the referenced
+     * objects themselves are collected. All top level objects of the source
+     * are returned if any process component of the task requires the full
+     * source data.
+     * @param task Task to collect the source objects for
+     * @param source Source/root object of the data objects
+     * @return Source objects to snapshot
+     */
+    static QList<GtObject*> collectSourceData(GtTask& task, GtObject& source);
+
 private:
     /// pointer to task
     QPointer<GtTask> m_task;
@@ -76,8 +97,9 @@ private:
     /// Container constiting of data to merge back into central data model
     QList<GtObjectMemento> m_dataToMerge;
 
-    /// Map of all process components and their cloned counterpart
-    QMap<GtProcessComponent*, GtProcessComponent*> m_componentMap;
+    /// Transfers the monitoring data of the cloned process components to
+    /// the original process components
+    gt::detail::MonitoringTransfer* m_monitoring;
 
     /**
      * @brief cloneTask
@@ -99,11 +121,6 @@ private slots:
      */
     void handleRunnableFinished();
 
-    /**
-     * @brief Transfers all monitoring properties from sender.
-     */
-    void transferMonitoringProperties();
-
 signals:
     /**
      * @brief Emitted after execution process.
@@ -18,6 +18,8 @@
 const quint16 gt::process_runner::S_DEFAULT_PORT = 8040;
 const QString gt::process_runner::S_DEFAULT_HOST{"localhost"};
 const QString gt::process_runner::S_ACCESS_ID{"Process Runner"};
+const QString gt::process_runner::S_READY_MESSAGE{
+    "Process runner is ready for connections"};
 
 QString
 gt::process_runner::portLockFilePath(quint16 port)
@@ -76,7 +78,7 @@ gt::process_runner::MementoDiffPayload::MementoDiffPayload() :
 gt::process_runner::MementoDiffPayload::MementoDiffPayload(
         const GtObjectMementoDiff& diff) :
     m_pMementoDiff("mementoDiff", tr("Memento Diff"), tr("Memento Diff"),
-                   diff.toByteArray())
+                   GtUnit::None, diff.toBinary())
 {
     setObjectName("MementoDiff");
 
@@ -86,5 +88,10 @@ gt::process_runner::MementoDiffPayload::MementoDiffPayload(
 GtObjectMementoDiff
 gt::process_runner::MementoDiffPayload::mementoDiff() const
 {
-    return GtObjectMementoDiff{m_pMementoDiff.getVal().toLatin1()};
+    QVariant const& value = m_pMementoDiff.getVal();
+
+    // binary data or XML string
+    return GtObjectMementoDiff{value.type() == QVariant::ByteArray ?
+                                   value.toByteArray() :
+                                   value.toString().toLatin1()};
 }
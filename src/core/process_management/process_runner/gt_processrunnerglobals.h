@@ -15,6 +15,7 @@
 #include "gt_enumproperty.h"
 #include "gt_processcomponent.h"
 #include "gt_stringproperty.h"
+#include "gt_variantproperty.h"
 #include <QVariant>
 
 class GtProcessRunnerResponse;
@@ -31,6 +32,8 @@ Q_NAMESPACE_EXPORT(GT_CORE_EXPORT)
 GT_CORE_EXPORT extern const quint16 S_DEFAULT_PORT;
 GT_CORE_EXPORT extern const QString S_DEFAULT_HOST;
 GT_CORE_EXPORT extern const QString S_ACCESS_ID;
+/// printed by the process runner once it accepts connections
+GT_CORE_EXPORT extern const QString S_READY_MESSAGE;
 
 GT_CORE_EXPORT QString portLockFilePath(quint16 port);
 
@@ -111,9 +114,9 @@ private:
 };
 
 /**
- * @brief The GtProcessComponentMetaData class.
- * Helper class for storing the state of a process component
- * (used in the process executor)
+ * @brief The MementoDiffPayload class.
+ * Helper class for transferring a memento diff. The diff is stored in the
+ * binary format, diffs stored as XML string are still accepted.
  */
 class GT_CORE_EXPORT MementoDiffPayload : public GtObject
 {
@@ -129,7 +132,7 @@ public:
 
 private:
 
-    GtStringProperty m_pMementoDiff;
+    GtVariantProperty m_pMementoDiff;
 };
 
 } // namespace process_runner
@@ -0,0 +1,207 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gt_processrunnerprotocol.h"
+
+#include <QObject>
+#include <QtEndian>
+
+#include <algorithm>
+
+const quint32 gt::process_runner::S_FRAME_MAGIC = 0x47545052; // "GTPR"
+const quint8 gt::process_runner::S_FRAME_VERSION = 1;
+const int gt::process_runner::S_FRAME_HEADER_SIZE = 12;
+const int gt::process_runner::S_MAX_FRAME_SIZE = 256 * 1024 * 1024;
+
+namespace
+{
+
+/// offsets of the header fields
+constexpr int S_VERSION_OFFSET = 4;
+constexpr int S_TYPE_OFFSET = 5;
+constexpr int S_LENGTH_OFFSET = 8;
+
+/// maximum number of digits of the size prefix of the previous protocol
+constexpr int S_MAX_LEGACY_DIGITS = 10;
+
+bool
+isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+} // namespace
+
+using namespace gt::process_runner;
+
+QByteArray
+gt::process_runner::makeFrame(const QByteArray& payload, PayloadType type)
+{
+    char header[S_FRAME_HEADER_SIZE] = {};
+    qToBigEndian<quint32>(S_FRAME_MAGIC, header);
+    header[S_VERSION_OFFSET] = char(S_FRAME_VERSION);
+    header[S_TYPE_OFFSET] = char(type);
+    qToBigEndian<quint32>(quint32(payload.size()), header + S_LENGTH_OFFSET);
+
+    QByteArray frame;
+    frame.reserve(S_FRAME_HEADER_SIZE + payload.size());
+    frame.append(header, S_FRAME_HEADER_SIZE);
+    frame.append(payload);
+    return frame;
+}
+
+void
+FrameReader::append(const QByteArray& data)
+{
+    if (m_offset >= m_buffer.size())
+    {
+        // all frames were read, no need to copy the data
+        m_buffer = data;
+        m_offset = 0;
+        return;
+    }
+
+    // drop frames that were read already
+    if (m_offset > 0)
+    {
+        m_buffer.remove(0, m_offset);
+        m_offset = 0;
+    }
+
+    m_buffer.append(data);
+}
+
+FrameReader::Status
+FrameReader::next(Frame& frame)
+{
+    int const available = bufferedSize();
+
+    if (available <= 0) return Incomplete;
+
+    char const* data = m_buffer.constData() + m_offset;
+
+    if (isDigit(data[0])) return nextLegacy(frame);
+
+    if (available < S_FRAME_HEADER_SIZE) return Incomplete;
+
+    if (qFromBigEndian<quint32>(data) != S_FRAME_MAGIC)
+    {
+        return error(QObject::tr("Invalid frame header"));
+    }
+
+    quint8 const version = quint8(data[S_VERSION_OFFSET]);
+    if (version != S_FRAME_VERSION)
+    {
+        return error(QObject::tr("Unsupported frame version (%1)")
+                         .arg(version));
+    }
+
+    quint8 const type = quint8(data[S_TYPE_OFFSET]);
+    if (type != MementoPayload)
+    {
+        return error(QObject::tr("Unknown payload type (%1)").arg(type));
+    }
+
+    quint32 const length = qFromBigEndian<quint32>(data + S_LENGTH_OFFSET);
+    if (length > quint32(m_maxFrameSize - S_FRAME_HEADER_SIZE))
+    {
+        return error(QObject::tr("Frame size exceeds the limit "
+                                 "(%1 of max. %2 bytes)")
+                         .arg(length).arg(m_maxFrameSize));
+    }
+
+    int const total = S_FRAME_HEADER_SIZE + int(length);
+
+    // the length is not trusted, the buffer only grows with the received data
+    if (available < total) return Incomplete;
+
+    frame.type = PayloadType(type);
+    frame.payload = QByteArray::fromRawData(data + S_FRAME_HEADER_SIZE,
+                                            int(length));
+    m_offset += total;
+
+    return FrameAvailable;
+}
+
+FrameReader::Status
+FrameReader::nextLegacy(Frame& frame)
+{
+    int const available = bufferedSize();
+    char const* data = m_buffer.constData() + m_offset;
+
+    int digits = 0;
+    while (digits < available && isDigit(data[digits]))
+    {
+        if (++digits > S_MAX_LEGACY_DIGITS)
+        {
+            return error(QObject::tr("Data size could not be parsed"));
+        }
+    }
+
+    // size prefix may be incomplete
+    if (digits == available) return Incomplete;
+
+    bool ok = false;
+    qint64 const length =
+        QByteArray::fromRawData(data, digits).toLongLong(&ok);
+    if (!ok)
+    {
+        return error(QObject::tr("Data size could not be parsed"));
+    }
+
+    if (length > m_maxFrameSize - digits)
+    {
+        return error(QObject::tr("Frame size exceeds the limit "
+                                 "(%1 of max. %2 bytes)")
+                         .arg(length).arg(m_maxFrameSize));
+    }
+
+    if (available < digits + length) return Incomplete;
+
+    frame.type = MementoPayload;
+    frame.payload = QByteArray::fromRawData(data + digits, int(length));
+    m_offset += digits + int(length);
+
+    return FrameAvailable;
+}
+
+void
+FrameReader::setMaxFrameSize(int size)
+{
+    m_maxFrameSize = std::max(size, S_FRAME_HEADER_SIZE);
+}
+
+int
+FrameReader::maxFrameSize() const
+{
+    return m_maxFrameSize;
+}
+
+void
+FrameReader::clear()
+{
+    m_buffer.clear();
+    m_offset = 0;
+}
+
+int
+FrameReader::bufferedSize() const
+{
+    return m_buffer.size() - m_offset;
+}
+
+QString const&
+FrameReader::errorString() const
+{
+    return m_error;
+}
+
+FrameReader::Status
+FrameReader::error(QString const& msg)
+{
+    m_error = msg;
+    return Error;
+}
@@ -0,0 +1,163 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef GT_PROCESSRUNNERPROTOCOL_H
+#define GT_PROCESSRUNNERPROTOCOL_H
+
+#include "gt_core_exports.h"
+
+#include <QByteArray>
+#include <QString>
+
+namespace gt
+{
+namespace process_runner
+{
+
+/// magic number of a frame ("GTPR")
+GT_CORE_EXPORT extern const quint32 S_FRAME_MAGIC;
+
+/// version of the frame format
+GT_CORE_EXPORT extern const quint8 S_FRAME_VERSION;
+
+/// size of the frame header in bytes
+GT_CORE_EXPORT extern const int S_FRAME_HEADER_SIZE;
+
+/// default maximum size of a frame (header and payload) in bytes
+GT_CORE_EXPORT extern const int S_MAX_FRAME_SIZE;
+
+/**
+ * @brief Type of the payload of a frame
+ */
+enum PayloadType : quint8
+{
+    /// memento of a command, response or notification (binary or XML)
+    MementoPayload = 1
+};
+
+/**
+ * @brief A frame of the process runner protocol.
+ *
+ * A frame consists of a fixed size header (magic number, version, payload
+ * type and payload length, big endian) and the payload.
+ */
+struct Frame
+{
+    /// type of the payload
+    PayloadType type{MementoPayload};
+    /// payload data
+    QByteArray payload{};
+};
+
+/**
+ * @brief Prepends the frame header to the payload
+ * @param payload Payload data
+ * @param type Type of the payload
+ * @return Frame data
+ */
+GT_CORE_EXPORT QByteArray makeFrame(const QByteArray& payload,
+                                    PayloadType type = MementoPayload);
+
+/**
+ * @brief The FrameReader class.
+ * Reassembles frames from the data received in arbitrary chunks.
+ *
+ * The data is appended to a single buffer, which only grows with the data
+ * actually received. Frames are parsed incrementally, i.e. only the header
+ * is inspected until the frame is complete. Frames announcing a length
+ * above the maximum frame size are rejected, the connection should be
+ * closed in this case. Payloads of complete frames are not copied, they
+ * reference the internal buffer.
+ *
+ * Frames prepending the payload size as ASCII digits (previous protocol
+ * version) are still accepted.
+ */
+class GT_CORE_EXPORT FrameReader
+{
+public:
+
+    enum Status
+    {
+        /// no complete frame available yet
+        Incomplete = 0,
+        /// the next frame was read
+        FrameAvailable,
+        /// the data is corrupted, the buffer must be cleared
+        Error
+    };
+
+    /**
+     * @brief Appends received data to the buffer
+     * @param data Data
+     */
+    void append(const QByteArray& data);
+
+    /**
+     * @brief Reads the next complete frame. The payload references the
+     * internal buffer and is only valid until this reader is modified again,
+     * i.e. the frame must be processed before calling append, next or
+     * clear.
+     * @param frame Frame (output)
+     * @return Status
+     */
+    Status next(Frame& frame);
+
+    /**
+     * @brief Sets the maximum size of a frame (header and payload). Frames
+     * exceeding this size are treated as errors.
+     * @param size Maximum frame size in bytes
+     */
+    void setMaxFrameSize(int size);
+
+    /**
+     * @brief Returns the maximum size of a frame (header and payload)
+     * @return Maximum frame size in bytes
+     */
+    int maxFrameSize() const;
+
+    /**
+     * @brief Discards all buffered data
+     */
+    void clear();
+
+    /**
+     * @brief Returns the number of buffered bytes, which were not read yet
+     * @return Number of bytes
+     */
+    int bufferedSize() const;
+
+    /**
+     * @brief Returns the reason of the last error
+     * @return Error string
+     */
+    QString const& errorString() const;
+
+private:
+
+    /// received data
+    QByteArray m_buffer;
+
+    /// position of the next frame in the buffer
+    int m_offset{0};
+
+    /// maximum size of a frame
+    int m_maxFrameSize{S_MAX_FRAME_SIZE};
+
+    /// reason of the last error
+    QString m_error;
+
+    /// reads a frame using the previous protocol version
+    Status nextLegacy(Frame& frame);
+
+    /// sets the error string
+    Status error(QString const& msg);
+};
+
+} // namespace process_runner
+
+} // namespace gt
+
+#endif // GT_PROCESSRUNNERPROTOCOL_H
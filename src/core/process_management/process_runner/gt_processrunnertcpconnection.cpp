@@ -18,8 +18,6 @@
 #include "gt_processrunnercommandfactory.h"
 
 #include <QTcpSocket>
-#include <QRegularExpression>
-#include <QDomDocument>
 
 GtProcessRunnerTcpConnection::GtProcessRunnerTcpConnection(QObject* parent) :
     GtProcessRunnerConnectionStrategy(parent),
@@ -44,7 +42,8 @@ void
 GtProcessRunnerTcpConnection::writeData(GtEventLoop& loop,
                                         const QByteArray& data)
 {
-    m_socket->write(loop, data, GtTcpSocket::PrependDataSize);
+    m_socket->write(loop, gt::process_runner::makeFrame(data),
+                    GtTcpSocket::RawData);
 }
 
 void
@@ -78,73 +77,59 @@ GtProcessRunnerTcpConnection::close()
 void
 GtProcessRunnerTcpConnection::onRead()
 {
-    static QRegularExpression regex{R"(^\d+)"};
+    using gt::process_runner::Frame;
+    using gt::process_runner::FrameReader;
 
-    m_buffer += m_socket->readAll();
+    m_reader.append(m_socket->readAll());
 
-    if (m_buffer.isEmpty())
+    Frame frame;
+    FrameReader::Status status;
+
+    // parse all complete frames in buffer
+    while ((status = m_reader.next(frame)) == FrameReader::FrameAvailable)
     {
-        // all data must have been parsed successfully
-        return emit clearReadTimeout();
-    }
+        // data is either binary or XML
+        GtObjectMemento memento{frame.payload};
 
-    // fetch size of data
-    QRegularExpressionMatch match = regex.match(m_buffer);
+        if (memento.isNull())
+        {
+            gtWarningId("TCP")
+                    << tr("Parsing error: data is neither a valid binary nor "
+                          "XML memento!");
+            qWarning().noquote() << "TCP: Data:\n" << frame.payload;
+            continue;
+        }
 
-    bool ok = false;
-    auto captured = match.captured();
-    int size = captured.toInt(&ok);
+        GtObject* obj = memento.restore(&gtProcessRunnerCommandFactory);
 
-    if (!match.hasMatch() || !ok)
+        queueData(std::unique_ptr<GtObject>(obj));
+    }
+
+    if (status == FrameReader::Error)
     {
         gtWarningId("TCP")
                 << tr("Failed to parse data!")
-                << gt::brackets(tr("Data size could not be parsed"));
-        return m_buffer.clear();
-    }
+                << gt::brackets(m_reader.errorString());
+        m_reader.clear();
 
-    // read data
-    auto data = m_buffer.mid(captured.size(), size);
-    if (data.size() != size)
-    {
-        gtDebugId("TCP")
-                << tr("Incomplete data! (%1/%2)")
-                       .arg(data.size()).arg(size);
-        return;
+        // the stream cannot be resynchronized, reject the connection
+        close();
+        return emit clearReadTimeout();
     }
 
-    // remove data from buffer
-    m_buffer.remove(0, captured.size() + size);
-
-    // data may not be complete yet
-    QDomDocument doc;
-    QString errMsg;
-    int errRow = 0;
-    int errCol = 0;
-
-    // rudimental check if XML data is complete
-    if (!doc.setContent(data, &errMsg, &errRow, &errCol))
+    if (m_reader.bufferedSize() == 0)
     {
-        gtWarningId("TCP")
-                << tr("Parsing error: row (%1) col (%2) error (%3)")
-                       .arg(errRow).arg(errCol).arg(errMsg);
-        qWarning().noquote() << "TCP: Data:\n"   << data;
-        qWarning().noquote() << "TCP: Buffer:\n" << m_buffer;
-        return;
+        // all data must have been parsed successfully
+        return emit clearReadTimeout();
     }
 
-    GtObjectMemento memento{doc.documentElement()};
-    GtObject* obj = memento.restore(&gtProcessRunnerCommandFactory);
-
-    queueData(std::unique_ptr<GtObject>(obj));
-
-    // parse pending commands in buffer
-    onRead();
+    gtDebugId("TCP") << tr("Incomplete data! (%1 bytes buffered)")
+                            .arg(m_reader.bufferedSize());
 }
 
 void
 GtProcessRunnerTcpConnection::onReadTimeout()
 {
     gtErrorId("TCP") << tr("Reading incomplete data timed out!");
-    m_buffer.clear();
+    m_reader.clear();
 }
@@ -13,6 +13,7 @@
 
 #include "gt_processrunnerconnectionstrategy.h"
 #include "gt_tcpsocket.h"
+#include "gt_processrunnerprotocol.h"
 
 #include <QTimer>
 
@@ -73,8 +74,8 @@ private:
     /// Pointer to socket (owned by this)
     QPointer<GtTcpSocket> m_socket;
 
-    /// Buffer for reading incompleete packages
-    QByteArray m_buffer{};
+    /// Reassembles the frames of incomplete packages
+    gt::process_runner::FrameReader m_reader{};
 
     /// Timeout timer for reading incomplete packages
     QTimer m_readTimer;
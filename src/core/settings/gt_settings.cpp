@@ -75,6 +75,12 @@ struct GtSettings::Impl
 
     /// Whether to autostart the process runner
     GtSettingsItem* m_autostartProcessRunner;
+
+    /// Number of process runners kept running
+    GtSettingsItem* m_processRunnerPoolSize;
+
+    /// Maximum number of concurrently executed tasks
+    GtSettingsItem* m_maxConcurrentTasks;
 };
 
 GtSettings::GtSettings()
@@ -140,6 +146,12 @@ GtSettings::GtSettings()
 
     pimpl->m_autostartProcessRunner = registerSetting(
                 QStringLiteral("application/process_runner/autostart"), false);
+
+    pimpl->m_processRunnerPoolSize = registerSetting(
+                QStringLiteral("application/process_runner/poolsize"), 1);
+
+    pimpl->m_maxConcurrentTasks = registerSetting(
+                QStringLiteral("application/process/maxconcurrenttasks"), 1);
 }
 
 QList<GtShortCutSettingsData>
@@ -461,3 +473,27 @@ GtSettings::setAutostartProcessRunner(bool value)
 {
     return pimpl->m_autostartProcessRunner->setValue(value);
 }
+
+int
+GtSettings::processRunnerPoolSize() const
+{
+    return pimpl->m_processRunnerPoolSize->getValue().toInt();
+}
+
+void
+GtSettings::setProcessRunnerPoolSize(int value)
+{
+    return pimpl->m_processRunnerPoolSize->setValue(value);
+}
+
+int
+GtSettings::maxConcurrentTasks() const
+{
+    return pimpl->m_maxConcurrentTasks->getValue().toInt();
+}
+
+void
+GtSettings::setMaxConcurrentTasks(int value)
+{
+    return pimpl->m_maxConcurrentTasks->setValue(value);
+}
@@ -381,6 +381,34 @@ public:
      */
     void setAutostartProcessRunner(bool value);
 
+    /**
+     * @brief Number of process runners, which are kept running in the
+     * background to execute tasks without starting a new process runner.
+     * Only used if the process runner is started automatically.
+     * @return Pool size
+     */
+    int processRunnerPoolSize() const;
+
+    /**
+     * @brief Setter for the number of process runners kept running
+     * @param value Value
+     */
+    void setProcessRunnerPoolSize(int value);
+
+    /**
+     * @brief Maximum number of independent tasks, which are executed
+     * concurrently by the core process executor. Tasks sharing linked
+     * objects are always executed one after another.
+     * @return Maximum number of concurrent tasks
+     */
+    int maxConcurrentTasks() const;
+
+    /**
+     * @brief Setter for the maximum number of concurrent tasks
+     * @param value Value
+     */
+    void setMaxConcurrentTasks(int value);
+
 private:
 
     struct Impl;
@@ -32,6 +32,19 @@ public:
      */
     virtual void onProjectLoaded(const QString& projectDir) = 0;
 
+    /**
+     * @brief Called when an externalization session was started. The
+     * interface may keep resources (e.g. files) open until the session is
+     * finished.
+     */
+    virtual void onSessionStarted() {}
+
+    /**
+     * @brief Called when the externalization session was finished. Resources
+     * kept open for the session should be released.
+     */
+    virtual void onSessionFinished() {}
+
 protected:
 
     /**
@@ -21,10 +21,11 @@ GtObject*
 GtAbstractObjectFactory::newObject(const QString& className, GtObject* parent)
 {
     GtObject* retval = nullptr;
-    if (m_knownClasses.contains(className))
+    // use const lookups only, so that concurrent reads do not detach the hash
+    auto iter = m_knownClasses.constFind(className);
+    if (iter != m_knownClasses.constEnd())
     {
-        const QMetaObject& mo = m_knownClasses[className];
-        retval = newObject(mo, parent);
+        retval = newObject(*iter, parent);
         if (!retval)
         {
             if (!m_silent)
@@ -52,10 +53,10 @@ GtAbstractObjectFactory::newObject(const QString& className, GtObject* parent)
 QString
 GtAbstractObjectFactory::superClassName(const QString& className) const
 {
-    if (m_knownClasses.contains(className))
+    auto iter = m_knownClasses.constFind(className);
+    if (iter != m_knownClasses.constEnd())
     {
-        const QMetaObject& mo = m_knownClasses[className];
-        return mo.superClass()->className();
+        return iter->superClass()->className();
     }
 
     return QString();
@@ -66,11 +67,11 @@ GtAbstractObjectFactory::classHierarchy(const QString& className)
 {
     QStringList retval;
 
-    if (m_knownClasses.contains(className))
+    auto iter = m_knownClasses.constFind(className);
+    if (iter != m_knownClasses.constEnd())
     {
         retval << className;
-        const QMetaObject& mo = m_knownClasses[className];
-        if (const QMetaObject* smo = mo.superClass())
+        if (const QMetaObject* smo = iter->superClass())
         {
             retval.append(classHierarchy(smo));
         }
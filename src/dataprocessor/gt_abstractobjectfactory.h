@@ -21,6 +21,10 @@ class GtObject;
 
 /**
  * @brief The GtAbstractObjectFactory class
+ *
+ * Classes are registered while the modules are loaded. Afterwards the
+ * registry is only read, which may be done from several threads at once
+ * (e.g. when loading the module files of a project concurrently).
  */
 class GT_DATAMODEL_EXPORT GtAbstractObjectFactory
 {
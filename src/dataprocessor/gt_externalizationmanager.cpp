@@ -17,6 +17,11 @@
 #include <QDir>
 #include <QDirIterator>
 #include <QFileInfo>
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
 
 GtExternalizationManager::GtExternalizationManager() = default;
 
@@ -53,6 +58,37 @@ GtExternalizationManager::enableExternalization(const QVariant& boolValue)
     m_isExternalizationEnabled = boolValue.toBool();
 }
 
+const GtExternalizationManager::StorageLayout&
+GtExternalizationManager::storageLayout() const
+{
+    return m_storageLayout;
+}
+
+void
+GtExternalizationManager::setStorageLayout(StorageLayout layout)
+{
+    layout.compressionLevel = qBound(0, layout.compressionLevel, 9);
+    m_storageLayout = layout;
+}
+
+void
+GtExternalizationManager::enableChunkedLayout(const QVariant& boolValue)
+{
+    m_storageLayout.chunked = boolValue.toBool();
+}
+
+void
+GtExternalizationManager::setCompressionLevel(const QVariant& intValue)
+{
+    m_storageLayout.compressionLevel = qBound(0, intValue.toInt(), 9);
+}
+
+void
+GtExternalizationManager::enableShuffle(const QVariant& boolValue)
+{
+    m_storageLayout.shuffle = boolValue.toBool();
+}
+
 void
 GtExternalizationManager::onProjectLoaded(QString projectDir)
 {
@@ -87,6 +123,112 @@ GtExternalizationManager::registerExernalizationInterface(
     m_externalizationInterfaces.append(interface);
 }
 
+void
+GtExternalizationManager::beginSession()
+{
+    if (m_sessionCount++ > 0)
+    {
+        return;
+    }
+
+    for (const auto& interface : qAsConst(m_externalizationInterfaces))
+    {
+        if (interface) interface->onSessionStarted();
+    }
+}
+
+void
+GtExternalizationManager::endSession()
+{
+    if (m_sessionCount <= 0)
+    {
+        gtWarning() << tr("No externalization session active!");
+        return;
+    }
+
+    if (--m_sessionCount > 0)
+    {
+        return;
+    }
+
+    for (const auto& interface : qAsConst(m_externalizationInterfaces))
+    {
+        if (interface) interface->onSessionFinished();
+    }
+}
+
+bool
+GtExternalizationManager::isSessionActive() const
+{
+    return m_sessionCount > 0;
+}
+
+bool
+GtExternalizationManager::externalize(
+        const QList<GtExternalizedObject*>& objects)
+{
+    struct Job
+    {
+        GtExternalizedObject* object;
+        QString hash;
+    };
+
+    Session session;
+
+    bool success = true;
+
+    std::vector<Job> jobs;
+    jobs.reserve(objects.size());
+
+    for (GtExternalizedObject* obj : objects)
+    {
+        if (!obj || !m_isExternalizationEnabled || !obj->isFetched())
+        {
+            continue;
+        }
+
+        if (!obj->canExternalize())
+        {
+            gtDebug().medium()
+                    << tr("Skipping externalization of invalid object:")
+                    << obj->objectName();
+            success = false;
+            continue;
+        }
+
+        jobs.push_back({obj, {}});
+    }
+
+    // the hash of objects without externalized children covers a distinct
+    // subtree, thus these hashes can be calculated concurrently
+    auto split = std::stable_partition(jobs.begin(), jobs.end(),
+                                       [](const Job& job){
+        return job.object->findChild<GtExternalizedObject*>() == nullptr;
+    });
+
+    QtConcurrent::blockingMap(jobs.begin(), split, [](Job& job){
+        job.hash = job.object->calcExtHash();
+    });
+
+    std::for_each(split, jobs.end(), [](Job& job){
+        job.hash = job.object->calcExtHash();
+    });
+
+    // objects of the same class are stored alongside each other
+    std::stable_sort(jobs.begin(), jobs.end(), [](const Job& a, const Job& b){
+        return std::strcmp(a.object->metaObject()->className(),
+                           b.object->metaObject()->className()) < 0;
+    });
+
+    // data is written serially
+    for (Job& job : jobs)
+    {
+        success &= job.object->externalizeHelper(std::move(job.hash));
+    }
+
+    return success;
+}
+
 void
 GtExternalizationManager::setProjectDir(QString projectDir)
 {
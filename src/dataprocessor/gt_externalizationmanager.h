@@ -51,6 +51,35 @@ public:
      */
     bool isExternalizationEnabled() const;
 
+    /**
+     * @brief The StorageLayout struct.
+     * Layout of the datasets of externalized objects
+     */
+    struct StorageLayout
+    {
+        /// whether the datasets are chunked. Chunked datasets are resizable,
+        /// thus they are extended instead of recreated if their size changes
+        bool chunked{false};
+        /// deflate compression level (0-9). Requires a chunked layout,
+        /// 0 disables the compression
+        int compressionLevel{0};
+        /// whether the shuffle filter is applied before compressing the data
+        bool shuffle{false};
+    };
+
+    /**
+     * @brief Returns the layout used for writing externalized datasets.
+     * @return storage layout
+     */
+    StorageLayout const& storageLayout() const;
+
+    /**
+     * @brief Sets the layout used for writing externalized datasets. Existing
+     * datasets keep their layout until they are recreated.
+     * @param layout storage layout
+     */
+    void setStorageLayout(StorageLayout layout);
+
     /**
      * @brief returns the base path of the project
      * @return project dir
@@ -84,6 +113,46 @@ public:
      */
     void registerExernalizationInterface(ExternalizationInterface inter);
 
+    /**
+     * @brief Starts an externalization session. While a session is active
+     * the externalization interfaces may keep their resources open, e.g. the
+     * HDF5 file. Sessions may be nested.
+     */
+    void beginSession();
+
+    /**
+     * @brief Finishes the externalization session started by beginSession.
+     */
+    void endSession();
+
+    /**
+     * @brief Returns whether an externalization session is active
+     * @return is session active
+     */
+    bool isSessionActive() const;
+
+    /**
+     * @brief Externalizes the objects within one externalization session.
+     * The hashes of the objects are calculated concurrently, the data is
+     * written serially afterwards.
+     * @param objects Objects to externalize
+     * @return success
+     */
+    bool externalize(const QList<GtExternalizedObject*>& objects);
+
+    /**
+     * @brief Scope guard for an externalization session
+     */
+    class Session
+    {
+    public:
+        Session() { GtExternalizationManager::instance()->beginSession(); }
+        ~Session() { GtExternalizationManager::instance()->endSession(); }
+
+        Session(const Session&) = delete;
+        Session& operator=(const Session&) = delete;
+    };
+
 public slots:
 
     /**
@@ -99,6 +168,27 @@ public slots:
      */
     void enableExternalization(const QVariant& boolValue);
 
+    /**
+     * @brief varaint based setter to enable/disable the chunked layout of
+     * externalized datasets.
+     * @param boolValue Must be convertible to bool
+     */
+    void enableChunkedLayout(const QVariant& boolValue);
+
+    /**
+     * @brief varaint based setter for the compression level of externalized
+     * datasets.
+     * @param intValue Must be convertible to int (0-9)
+     */
+    void setCompressionLevel(const QVariant& intValue);
+
+    /**
+     * @brief varaint based setter to enable/disable the shuffle filter of
+     * externalized datasets.
+     * @param boolValue Must be convertible to bool
+     */
+    void enableShuffle(const QVariant& boolValue);
+
     void onProjectLoaded(QString projectDir);
 
 private:
@@ -114,8 +204,14 @@ private:
     /// whether to use the externalization feature
     bool m_isExternalizationEnabled{false};
 
+    /// layout of externalized datasets
+    StorageLayout m_storageLayout{};
+
     /// externalization interfaces
     QVector<ExternalizationInterface> m_externalizationInterfaces{};
+
+    /// number of nested externalization sessions
+    int m_sessionCount{0};
 };
 
 #endif // GTEXTERNALIZEDOBJECTMANAGER_H
@@ -0,0 +1,134 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef GTEXTERNALIZEDDATASELECTION_H
+#define GTEXTERNALIZEDDATASELECTION_H
+
+#include <QtGlobal>
+
+#include <algorithm>
+
+/**
+ * @brief The GtExternalizedDataSelection struct.
+ * Selects a subset of the externalized data of an object, i.e. a range of
+ * rows (first dimension) and a range of columns (second dimension) of a
+ * dataset. Used to fetch only the part of the data that is accessed.
+ */
+struct GtExternalizedDataSelection
+{
+    /// first selected row
+    qint64 rowOffset{0};
+    /// number of selected rows, negative selects all remaining rows
+    qint64 rowCount{-1};
+    /// first selected column
+    qint64 columnOffset{0};
+    /// number of selected columns, negative selects all remaining columns
+    qint64 columnCount{-1};
+
+    /**
+     * @brief Selects a range of rows including all columns
+     * @param offset First row
+     * @param count Number of rows
+     * @return selection
+     */
+    static GtExternalizedDataSelection rows(qint64 offset, qint64 count = -1)
+    {
+        return {offset, count, 0, -1};
+    }
+
+    /**
+     * @brief Selects a range of columns including all rows
+     * @param offset First column
+     * @param count Number of columns
+     * @return selection
+     */
+    static GtExternalizedDataSelection columns(qint64 offset,
+                                               qint64 count = -1)
+    {
+        return {0, -1, offset, count};
+    }
+
+    /**
+     * @brief Returns whether the whole data is selected
+     * @return is full selection
+     */
+    bool isFull() const
+    {
+        return rowOffset <= 0 && rowCount < 0 &&
+               columnOffset <= 0 && columnCount < 0;
+    }
+
+    /**
+     * @brief Returns whether the other selection is a subset of this selection
+     * @param other Other selection
+     * @return contains other
+     */
+    bool contains(GtExternalizedDataSelection const& other) const
+    {
+        return containsRange(rowOffset, rowCount,
+                             other.rowOffset, other.rowCount) &&
+               containsRange(columnOffset, columnCount,
+                             other.columnOffset, other.columnCount);
+    }
+
+    /**
+     * @brief Returns the smallest selection containing both selections
+     * @param other Other selection
+     * @return united selection
+     */
+    GtExternalizedDataSelection
+    united(GtExternalizedDataSelection const& other) const
+    {
+        GtExternalizedDataSelection retval;
+        uniteRange(rowOffset, rowCount, other.rowOffset, other.rowCount,
+                   retval.rowOffset, retval.rowCount);
+        uniteRange(columnOffset, columnCount,
+                   other.columnOffset, other.columnCount,
+                   retval.columnOffset, retval.columnCount);
+        return retval;
+    }
+
+    bool operator==(GtExternalizedDataSelection const& other) const
+    {
+        return rowOffset == other.rowOffset && rowCount == other.rowCount &&
+               columnOffset == other.columnOffset &&
+               columnCount == other.columnCount;
+    }
+
+    bool operator!=(GtExternalizedDataSelection const& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+
+    static bool containsRange(qint64 offset, qint64 count,
+                              qint64 otherOffset, qint64 otherCount)
+    {
+        if (otherOffset < offset) return false;
+        if (count < 0) return true;
+        if (otherCount < 0) return false;
+        return otherOffset + otherCount <= offset + count;
+    }
+
+    static void uniteRange(qint64 offset, qint64 count,
+                           qint64 otherOffset, qint64 otherCount,
+                           qint64& retOffset, qint64& retCount)
+    {
+        retOffset = std::min(offset, otherOffset);
+
+        if (count < 0 || otherCount < 0)
+        {
+            retCount = -1;
+            return;
+        }
+
+        retCount = std::max(offset + count, otherOffset + otherCount) -
+                   retOffset;
+    }
+};
+
+#endif // GTEXTERNALIZEDDATASELECTION_H
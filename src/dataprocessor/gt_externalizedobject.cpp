@@ -14,8 +14,14 @@
 #include "gt_logging.h"
 #include "gt_utilities.h"
 #include "gt_externalizationmanager.h"
+#include "gt_objectio.h"
+#include "gt_objectmemento.h"
+#include "internal/contenthash.h"
 #include "internal/gt_externalizedobjectprivate.h"
 
+#include <algorithm>
+#include <array>
+
 using namespace gt::internal;
 
 GtExternalizedObject::GtExternalizedObject() :
@@ -45,12 +51,34 @@ GtExternalizedObject::refCount() const
     return pimpl->refCount;
 }
 
+int
+GtExternalizedObject::partialRefCount() const
+{
+    return pimpl->partialRefCount;
+}
+
 bool
 GtExternalizedObject::isFetched() const
 {
     return pimpl->pFetched;
 }
 
+bool
+GtExternalizedObject::isPartiallyFetched() const
+{
+    return pimpl->partiallyFetched;
+}
+
+GtExternalizedDataSelection
+GtExternalizedObject::fetchedSelection() const
+{
+    if (pimpl->partiallyFetched)
+    {
+        return pimpl->selection;
+    }
+    return {};
+}
+
 void
 GtExternalizedObject::setFetchInitialVersion(bool value) const
 {
@@ -73,32 +101,46 @@ GtExternalizedObject::hasModifiedData(const QString& otherHash) const
 QString
 GtExternalizedObject::calcExtHash()
 {
-    // cache properties
-    bool fetched{pimpl->pFetched};
-    bool fiv{pimpl->pFetchInitialVersion};
-    QString hash{pimpl->pCachedHash};
-    QVariant metaData{pimpl->pMetaData};
-    ExternalizeStates states = pimpl->states;
-
-    // reset original values
-    auto finally = gt::finally([&, fetched, fiv, states](){
-        pimpl->pCachedHash = hash;
-        pimpl->pMetaData.setVal(metaData);
-        pimpl->states = states;
-        pimpl->pFetchInitialVersion = fiv;
-        pimpl->pFetched = fetched;
-    });
-    Q_UNUSED(finally)
-
-    // clear properties for hash calculation
-    pimpl->pFetched.revert();
-    pimpl->pFetchInitialVersion.revert();
-    pimpl->pCachedHash.revert();
-    pimpl->pMetaData.revert();
-    pimpl->states = {};
-
-    // calc object hash
-    return calcHash();
+    // the member properties are hashed using their default values. The
+    // object is not modified, thus the hash may be calculated concurrently
+    // for distinct objects
+    GtExternalizedObjectPrivate const defaults;
+    std::array<GtAbstractProperty const*, 4> const members{
+        &defaults.pFetched,
+        &defaults.pFetchInitialVersion,
+        &defaults.pCachedHash,
+        &defaults.pMetaData
+    };
+
+    GtObjectMemento memento = GtObjectIO().toMemento(this, true, true);
+
+    for (GtObjectMemento::PropertyData& p : memento.properties)
+    {
+        auto iter = std::find_if(members.begin(), members.end(),
+                                 [&p](GtAbstractProperty const* member){
+            return member->ident() == p.name;
+        });
+
+        if (iter != members.end())
+        {
+            p.setData((*iter)->valueToVariant());
+        }
+    }
+
+    // the hash identifies the externalized data stored in existing projects,
+    // thus it does not depend on the default hash algorithm
+    gt::HashAlgorithm const algorithm = gt::HashAlgorithm::Sha256;
+
+    // same structure as the hash of GtObject
+    gt::detail::ContentHash hash(algorithm);
+    hash.addData(memento.calculatePropertyHash(algorithm));
+
+    for (GtObject const* child : findDirectChildren())
+    {
+        hash.addData(QByteArray::fromHex(child->calcHash(algorithm).toLatin1()));
+    }
+
+    return hash.result().toHex();
 }
 
 const
@@ -128,6 +170,21 @@ GtExternalizedObject::canExternalize() const
     return true;
 }
 
+bool
+GtExternalizedObject::canFetchPartially() const
+{
+    return false;
+}
+
+bool
+GtExternalizedObject::doFetchPartialData(
+        QVariant& /*metaData*/,
+        bool /*fetchInitialVersion*/,
+        GtExternalizedDataSelection const& /*selection*/)
+{
+    return false;
+}
+
 bool
 GtExternalizedObject::fetch()
 {
@@ -149,6 +206,14 @@ GtExternalizedObject::fetchHelper()
 
     gtDebug().medium() << "Fetching object..." << gt::quoted(objectName());
 
+    // partial data is replaced by the whole data
+    if (pimpl->partiallyFetched)
+    {
+        pimpl->partiallyFetched = false;
+        pimpl->selection = {};
+        doClearExternalizedData();
+    }
+
     // fetch
     if (!doFetchData(pimpl->pMetaData.get(), pimpl->pFetchInitialVersion))
     {
@@ -187,12 +252,101 @@ GtExternalizedObject::release()
     }
 
     // dont externalize if data is still in use
-    if (pimpl->refCount > 0 || pimpl->states & KeepInternalized)
+    if (pimpl->refCount > 0 || pimpl->partialRefCount > 0)
+    {
+        return true;
+    }
+
+    return releaseHelper();
+}
+
+bool
+GtExternalizedObject::fetchPartial(GtExternalizedDataSelection const& selection,
+                                   bool& partial)
+{
+    partial = false;
+
+    // the whole data is already fetched or must be fetched
+    if (isFetched() || selection.isFull() || !canFetchPartially())
+    {
+        return fetch();
+    }
+
+    if (pimpl->partiallyFetched)
+    {
+        if (pimpl->selection.contains(selection))
+        {
+            partial = true;
+            pimpl->partialRefCount += 1;
+            return true;
+        }
+
+        // the partial data is still accessed by others and must not be
+        // replaced by another selection -> fetch the whole data instead
+        return fetch();
+    }
+
+    partial = true;
+    pimpl->partialRefCount += 1;
+
+    gtDebug().medium() << "Fetching selection of object..."
+                       << gt::quoted(objectName());
+
+    if (!doFetchPartialData(pimpl->pMetaData.get(), pimpl->pFetchInitialVersion,
+                            selection))
+    {
+        gtError() << tr("Fetching selection of object failed!")
+                  << tr("(Path: '%1')").arg(objectPath());
+        pimpl->selection = {};
+        // clear any internalized data
+        doClearExternalizedData();
+        return false;
+    }
+
+    pimpl->partiallyFetched = true;
+    pimpl->selection = selection;
+    return true;
+}
+
+bool
+GtExternalizedObject::releasePartial()
+{
+    pimpl->partialRefCount -= 1;
+
+    if (pimpl->partialRefCount > 0)
+    {
+        return true;
+    }
+
+    // free the partial data
+    if (pimpl->partiallyFetched)
+    {
+        pimpl->partiallyFetched = false;
+        pimpl->selection = {};
+        doClearExternalizedData();
+        return true;
+    }
+
+    // the whole data was fetched in the meantime
+    if (pimpl->refCount > 0 || !isFetched() ||
+        !gtExternalizationManager->isExternalizationEnabled())
+    {
+        return true;
+    }
+
+    return releaseHelper();
+}
+
+bool
+GtExternalizedObject::releaseHelper()
+{
+    if (pimpl->states & KeepInternalized)
     {
         return true;
     }
 
     assert(pimpl->refCount == 0);
+    assert(pimpl->partialRefCount <= 0);
 
     // scedule for externalization
     if (hasModifiedData())
@@ -225,9 +379,12 @@ GtExternalizedObject::externalize()
         return false;
     }
 
-    // recalculate object hash
-    QString hash{calcExtHash()};
+    return externalizeHelper(calcExtHash());
+}
 
+bool
+GtExternalizedObject::externalizeHelper(QString hash)
+{
     // check if not marked for externalization or has changes
     if (!(pimpl->states & ExternalizeOnSave || pimpl->states & KeepInternalized ||
           hasModifiedData(hash)))
@@ -256,7 +413,7 @@ GtExternalizedObject::externalize()
     pimpl->setExternalizeState(KeepInternalized, false);
 
     // clear data
-    if (pimpl->refCount == 0)
+    if (pimpl->refCount == 0 && pimpl->partialRefCount == 0)
     {
         pimpl->pFetched = false;
         doClearExternalizedData();
@@ -292,16 +449,47 @@ GtExternalizedObjectData::GtExternalizedObjectData(GtExternalizedObject* base) :
     }
 }
 
+GtExternalizedObjectData::GtExternalizedObjectData(
+        GtExternalizedObject* base,
+        GtExternalizedDataSelection const& selection) :
+    m_base{base}
+{
+    if (m_base)
+    {
+        m_base->fetchPartial(selection, m_partial);
+    }
+}
+
 GtExternalizedObjectData::~GtExternalizedObjectData()
 {
     if (m_base)
     {
-        m_base->release();
+        if (m_partial)
+        {
+            m_base->releasePartial();
+        }
+        else
+        {
+            m_base->release();
+        }
     }
 }
 
 bool
 GtExternalizedObjectData::isValid() const
 {
-    return m_base != nullptr && m_base->isFetched() && m_base->isDataValid();
+    return m_base != nullptr &&
+           (m_base->isFetched() || (m_partial && m_base->isPartiallyFetched())) &&
+           m_base->isDataValid();
+}
+
+GtExternalizedDataSelection
+GtExternalizedObjectData::selection() const
+{
+    if (!m_base)
+    {
+        return {};
+    }
+
+    return m_base->fetchedSelection();
 }
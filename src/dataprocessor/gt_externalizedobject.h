@@ -14,6 +14,7 @@
 
 #include "gt_datamodel_exports.h"
 #include "gt_object.h"
+#include "gt_externalizeddataselection.h"
 
 #include <QPointer>
 
@@ -45,6 +46,31 @@ T_Data fetchExternalizedData(T_Base* obj)
     return T_Data{obj};
 }
 
+/**
+ * @brief Will fetch a helper object for accessing a selection of the data of
+ * an externalized object. Only the selected data is fetched if supported by
+ * the object.
+ * @tparam T_Base Base object class. Must be a subclass of GtExternalizedObject
+ * @tparam T_Data Data object class. Must be a subclass of
+ * GtExternalizedObjectData and must be constructible using a selection.
+ * @param obj Object to fetch a helper object for.
+ * @param selection Selection of the data to fetch
+ * @return helper object
+ */
+template<typename T_Base, typename T_Data = typename T_Base::Data>
+T_Data fetchExternalizedData(T_Base* obj,
+                             GtExternalizedDataSelection const& selection)
+{
+    static_assert (
+        std::is_base_of<GtExternalizedObject, T_Base>(),
+        "T_Base must be derived of GtExternalizedObject");
+    static_assert (
+        std::is_base_of<GtExternalizedObjectData, T_Data>(),
+        "T_Data must be derived of GtExternalizedObjectData");
+
+    return T_Data{obj, selection};
+}
+
 } // namespace gt
 
 
@@ -55,6 +81,10 @@ T_Data fetchExternalizedData(T_Base* obj)
     public: using Data = DataClass; \
     template <typename T = Data> T fetchData() { \
         return gt::fetchExternalizedData(this); \
+    } \
+    template <typename T = Data> \
+    T fetchData(GtExternalizedDataSelection const& selection) { \
+        return gt::fetchExternalizedData(this, selection); \
     } private:
 
 /// Marco for adding a dedicated base method impl for accessing the base class.
@@ -79,6 +109,16 @@ class GT_DATAMODEL_EXPORT GtExternalizedObjectData
 public:
 
     explicit GtExternalizedObjectData(GtExternalizedObject* base);
+
+    /**
+     * @brief Fetches only the selected data of the base object. If the
+     * object does not support partial fetching the whole data is fetched.
+     * @param base Base object
+     * @param selection Selection of the data to fetch
+     */
+    GtExternalizedObjectData(GtExternalizedObject* base,
+                             GtExternalizedDataSelection const& selection);
+
     virtual ~GtExternalizedObjectData();
 
     GtExternalizedObjectData(const GtExternalizedObjectData&) = default;
@@ -92,10 +132,23 @@ public:
      */
     bool isValid() const;
 
+    /**
+     * @brief Returns the selection of the data that is currently fetched. The
+     * selection may be larger than the requested selection, indices of the
+     * internal data are relative to this selection.
+     * @return fetched selection
+     */
+    GtExternalizedDataSelection selection() const;
+
 protected:
 
     /// pointer to base class
     QPointer<Base> m_base{};
+
+private:
+
+    /// whether a partial reference to the base object is held
+    bool m_partial{false};
 };
 
 /**
@@ -124,6 +177,13 @@ public:
      */
     int refCount() const;
 
+    /**
+     * @brief Returns the current number of accesses to a selection of the
+     * data.
+     * @return partial ref count
+     */
+    int partialRefCount() const;
+
     /**
      * @brief Externalize. Will externalize the object only if its fetched and
      * the object has changed. Call this function with care, as the previous
@@ -146,10 +206,27 @@ public:
      */
     Q_INVOKABLE bool isFetched() const;
 
+    /**
+     * @brief Returns whether only a selection of the data is fetched. The
+     * partial data is read only and is not externalized.
+     * @return whether the object is partially fetched
+     */
+    Q_INVOKABLE bool isPartiallyFetched() const;
+
+    /**
+     * @brief Returns the selection of the data that is fetched. Is a full
+     * selection if the whole data is fetched.
+     * @return fetched selection
+     */
+    GtExternalizedDataSelection fetchedSelection() const;
+
     /**
      * @brief Calculates a special hash of this object used to check for changes
      * in the externalized data. Member variables of this class do not count
-     * towards a different hash.
+     * towards a different hash. The object is not modified, thus the hash of
+     * distinct objects may be calculated concurrently. The hash is always
+     * calculated using SHA-256 (independent of the default hash algorithm)
+     * to match the hashes stored in existing projects.
      * @return new hash
      */
     QString calcExtHash();
@@ -199,6 +276,28 @@ protected:
      */
     virtual bool doExternalizeData(QVariant& metaData) = 0;
 
+    /**
+     * @brief Returns whether the object can fetch a selection of its data. If
+     * not, the whole data is fetched for partial accesses.
+     * @return can fetch partially
+     */
+    virtual bool canFetchPartially() const;
+
+    /**
+     * @brief Method to implement for fetching a selection of the externalized
+     * data. Will only be called if canFetchPartially returns true. The data
+     * fetched must at least contain the selection.
+     * @param metaData Data that may need to be saved in between sessions to
+     * help fetch/externalize the dataset.
+     * @param fetchInitialVersion Whether to fetch the intial version of the
+     * data (i.e. the original data that has not changed)
+     * @param selection Selection of the data to fetch
+     * @return success
+     */
+    virtual bool doFetchPartialData(
+            QVariant& metaData, bool fetchInitialVersion,
+            GtExternalizedDataSelection const& selection);
+
     /**
      * @brief doClearExternalizedData method to implement for clearing the
      * externalized data.
@@ -227,12 +326,47 @@ private:
      */
     bool release();
 
+    /**
+     * @brief Increments the partial ref count and fetches the selection of
+     * the data. Fetches the whole data if partial fetching is not supported
+     * or if the selection is not contained in the partial data, that is
+     * already fetched.
+     * @param selection Selection to fetch
+     * @param partial Set to whether a partial reference was acquired. If
+     * false, a full reference was acquired instead.
+     * @return whether fetching was successfull.
+     */
+    bool fetchPartial(GtExternalizedDataSelection const& selection,
+                      bool& partial);
+
+    /**
+     * @brief Decrements the partial ref count. Clears the partial data once
+     * it is no longer accessed.
+     * @return success
+     */
+    bool releasePartial();
+
+    /**
+     * @brief Helper method for clearing the data once it is no longer
+     * accessed. Should not be called directly.
+     * @return success
+     */
+    bool releaseHelper();
+
     /**
      * @brief Helper method for fetching. Should not be called directly.
      * @return success
      */
     bool fetchHelper();
 
+    /**
+     * @brief Helper method for externalizing using a precalculated hash.
+     * Should not be called directly.
+     * @param hash Hash of the object, calculated by calcExtHash
+     * @return success
+     */
+    bool externalizeHelper(QString hash);
+
     /**
      * @brief Setter for the fetchInitialVersion property
      * @param value Whether the initial version should be fetched
@@ -61,6 +61,13 @@ public:
      */
     void fetch();
 
+    /**
+     * @brief fetches a new data object to internalize a selection of the base
+     * object. T_Data must be constructible using a selection.
+     * @param selection Selection of the data to fetch
+     */
+    void fetch(GtExternalizedDataSelection const& selection);
+
     /**
      * @brief sets the object to fetch
      * @param object new base
@@ -116,6 +123,13 @@ inline void GtExternalizedObjectFetcher<T_Base, T_Data>::fetch()
     m_dataPtr = std::make_unique<T_Data>(m_objPtr);
 }
 
+template<class T_Base, class T_Data>
+inline void GtExternalizedObjectFetcher<T_Base, T_Data>::fetch(
+        GtExternalizedDataSelection const& selection)
+{
+    m_dataPtr = std::make_unique<T_Data>(m_objPtr, selection);
+}
+
 template<class T_Base, class T_Data>
 inline void GtExternalizedObjectFetcher<T_Base, T_Data>::set(T_Base* object)
 {
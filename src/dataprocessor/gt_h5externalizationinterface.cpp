@@ -15,11 +15,10 @@
 #include "gt_logging.h"
 #include "gt_externalizationmanager.h"
 
-#include "genh5_file.h"
-
 #include <QDir>
 #include <QFile>
 #include <QFileInfo>
+#include <QMutexLocker>
 
 const QString GtH5ExternalizationInterface::S_PROJECT_BASENAME =
         QStringLiteral("project.ext");
@@ -98,4 +97,57 @@ GtH5ExternalizationInterface::projectHDF5FilePath(bool useBackupFile) const
 
     return projectDir.absoluteFilePath(name + GenH5::File::dotFileSuffix());
 }
+
+void
+GtH5ExternalizationInterface::onSessionStarted()
+{
+    QMutexLocker locker{&m_mutex};
+    m_sessionActive = true;
+}
+
+void
+GtH5ExternalizationInterface::onSessionFinished()
+{
+    QMutexLocker locker{&m_mutex};
+    m_sessionActive = false;
+    m_sessionFiles.clear();
+}
+
+GenH5::File
+GtH5ExternalizationInterface::openFile(GenH5::FileAccessFlags flags,
+                                       bool useBackupFile) noexcept(false)
+{
+    QString filePath = projectHDF5FilePath(useBackupFile);
+
+    if (filePath.isEmpty())
+    {
+        throw GenH5::FileException{"Invalid HDF5 file path"};
+    }
+
+    QMutexLocker locker{&m_mutex};
+
+    if (!m_sessionActive)
+    {
+        return GenH5::File{filePath.toUtf8(), flags};
+    }
+
+    bool writable = !(flags & GenH5::ReadOnly);
+
+    auto iter = m_sessionFiles.find(useBackupFile);
+    if (iter != m_sessionFiles.end())
+    {
+        if (iter->second.writable || !writable)
+        {
+            return iter->second.file;
+        }
+
+        // close read only file before reopening it with write access
+        m_sessionFiles.erase(iter);
+    }
+
+    GenH5::File file{filePath.toUtf8(), flags};
+    m_sessionFiles.emplace(useBackupFile, SessionFile{file, writable});
+
+    return file;
+}
 #endif
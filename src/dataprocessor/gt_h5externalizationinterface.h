@@ -15,6 +15,12 @@
 #ifdef GT_H5
 #include "gt_abstractexternalizationinterface.h"
 
+#include "genh5_file.h"
+
+#include <QMutex>
+
+#include <map>
+
 #define gtH5ExternalizationInterface (GtH5ExternalizationInterface::instance())
 
 /**
@@ -56,8 +62,47 @@ public:
      */
     QString projectHDF5FilePath(bool useBackupFile) const;
 
+    /**
+     * @brief Keeps the hdf5 files opened by openFile open until the session
+     * is finished.
+     */
+    void onSessionStarted() override;
+
+    /**
+     * @brief Closes the hdf5 files kept open during the session.
+     */
+    void onSessionFinished() override;
+
+    /**
+     * @brief Opens the project hdf5 file. While an externalization session
+     * is active, the file is opened only once and reused. A file opened in
+     * read only mode is reopened if write access is requested.
+     * Throws if the file could not be opened.
+     * @param flags File access flags
+     * @param useBackupFile whether to open the backup file or main project
+     * file
+     * @return file
+     */
+    GenH5::File openFile(GenH5::FileAccessFlags flags,
+                         bool useBackupFile) noexcept(false);
+
 private:
 
+    struct SessionFile
+    {
+        GenH5::File file;
+        bool writable;
+    };
+
+    /// files kept open during a session (key: whether its the backup file)
+    std::map<bool, SessionFile> m_sessionFiles;
+
+    /// whether a session is active
+    bool m_sessionActive{false};
+
+    /// guards the session files
+    QMutex m_mutex;
+
     /**
      * @brief GtH5ExternalizationInterface
      */
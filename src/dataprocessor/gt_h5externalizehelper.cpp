@@ -15,15 +15,21 @@
 #ifdef GT_H5
 #include "gt_externalizedobject.h"
 #include "gt_h5externalizationinterface.h"
+#include "gt_externalizationmanager.h"
 
 #include "genh5_file.h"
 #include "genh5_reference.h"
+#include "genh5_datasetcproperties.h"
+
+#include <hdf5.h>
 
 #include <QDir>
 #include <QDirIterator>
 #include <QFile>
 #include <QFileInfo>
 
+#include <algorithm>
+
 static const auto S_GT_VERSION_ATTR = QByteArrayLiteral("GT_VERSION");
 static const auto S_EXT_HASH_ATTR = QByteArrayLiteral("GT_EXT_HASH");
 
@@ -140,6 +146,123 @@ updateAttributes(const GenH5::DataSet& dset, QString const& hash)
     dset.writeAttribute(S_EXT_HASH_ATTR, hashData);
 }
 
+/// target size of a chunk in bytes
+constexpr hsize_t S_CHUNK_SIZE = 64 * 1024;
+
+/**
+ * @brief Creates the dataspace of a new dataset. The first dimension of
+ * chunked datasets is unlimited, thus the dataset can be extended.
+ * @param dspace dataspace of the data
+ * @param layout storage layout
+ * @return dataspace
+ */
+inline GenH5::DataSpace
+makeDataSpace(GenH5::DataSpace const& dspace,
+              GtExternalizationManager::StorageLayout const& layout)
+{
+    if (!layout.chunked)
+    {
+        return dspace;
+    }
+
+    GenH5::Dimensions dims = dspace.dimensions();
+    GenH5::Dimensions maxDims = dims;
+    if (!maxDims.empty())
+    {
+        maxDims[0] = H5S_UNLIMITED;
+    }
+
+    return GenH5::DataSpace{dims, maxDims};
+}
+
+/**
+ * @brief Creates the creation properties of a new dataset. Chunks span all
+ * but the first dimension, the number of rows per chunk is chosen such that
+ * a chunk has roughly S_CHUNK_SIZE bytes.
+ * @param dtype datatype of the data
+ * @param dspace dataspace of the data
+ * @param layout storage layout
+ * @return dataset creation properties
+ */
+inline GenH5::DataSetCProperties
+makeProperties(GenH5::DataType const& dtype,
+               GenH5::DataSpace const& dspace,
+               GtExternalizationManager::StorageLayout const& layout)
+{
+    GenH5::DataSetCProperties props;
+
+    GenH5::Dimensions chunks = dspace.dimensions();
+    if (!layout.chunked || chunks.empty())
+    {
+        return props;
+    }
+
+    hsize_t rowSize = std::max<hsize_t>(dtype.size(), 1);
+    for (int i = 1; i < chunks.size(); ++i)
+    {
+        chunks[i] = std::max<hsize_t>(chunks[i], 1);
+        rowSize *= chunks[i];
+    }
+    chunks[0] = std::max<hsize_t>(S_CHUNK_SIZE / rowSize, 1);
+
+    // the order of the filters matters: shuffle before compressing
+    bool success = H5Pset_chunk(props.id(), static_cast<int>(chunks.size()),
+                                chunks.data()) >= 0;
+
+    if (layout.compressionLevel > 0)
+    {
+        if (layout.shuffle)
+        {
+            success &= H5Pset_shuffle(props.id()) >= 0;
+        }
+        success &= H5Pset_deflate(props.id(),
+                                  static_cast<unsigned>(
+                                      layout.compressionLevel)) >= 0;
+    }
+
+    if (!success)
+    {
+        throw GenH5::PropertyListException{
+            "Failed to set the chunked layout of the dataset"
+        };
+    }
+
+    return props;
+}
+
+/**
+ * @brief Resizes a chunked dataset to the dataspace. Only the extent of the
+ * first dimension can change. This only avoids recreating the dataset, the
+ * data is still written as a whole afterwards.
+ * @param dset dataset
+ * @param dspace new dataspace
+ * @return success. Fails for contiguous datasets.
+ */
+inline bool
+resizeDataSet(GenH5::DataSet& dset, GenH5::DataSpace const& dspace)
+{
+    GenH5::Dimensions current = dset.dataSpace().dimensions();
+    GenH5::Dimensions dims = dspace.dimensions();
+
+    if (current.size() != dims.size() || dims.empty() ||
+        !std::equal(current.begin() + 1, current.end(), dims.begin() + 1))
+    {
+        return false;
+    }
+
+    // contiguous datasets cannot be resized
+    hid_t plist = H5Dget_create_plist(dset.id());
+    bool chunked = plist >= 0 && H5Pget_layout(plist) == H5D_CHUNKED;
+    if (plist >= 0) H5Pclose(plist);
+
+    if (!chunked)
+    {
+        return false;
+    }
+
+    return H5Dset_extent(dset.id(), dims.data()) >= 0;
+}
+
 inline QString
 className(QString const& name)
 {
@@ -176,15 +299,39 @@ GenH5::File
 GtH5ExternalizeHelper::openFile(GenH5::FileAccessFlags flags,
                                 bool accessBackupFile) const noexcept(false)
 {
-    auto filePath = gtH5ExternalizationInterface->projectHDF5FilePath(
-                accessBackupFile);
+    return gtH5ExternalizationInterface->openFile(flags, accessBackupFile);
+}
+
+GenH5::DataSpaceSelection
+GtH5ExternalizeHelper::hyperslab(GenH5::DataSet const& dset,
+                                 GtExternalizedDataSelection const& selection
+                                 ) noexcept(false)
+{
+    GenH5::DataSpace dspace = dset.dataSpace();
+    GenH5::Dimensions dims = dspace.dimensions();
 
-    if (filePath.isEmpty())
-    {
-        throw GenH5::FileException{"Invalid HDF5 file path"};
-    }
+    GenH5::Dimensions offset = dims;
+    GenH5::Dimensions count = dims;
+    std::fill(offset.begin(), offset.end(), 0);
 
-    return GenH5::File{filePath.toUtf8(), flags};
+    const auto selectRange = [&](int dim, qint64 first, qint64 n){
+        if (dim >= dims.size())
+        {
+            return;
+        }
+
+        auto size = static_cast<qint64>(dims[dim]);
+        first = qBound(qint64{0}, first, size);
+        n = n < 0 ? size - first : std::min(n, size - first);
+
+        offset[dim] = static_cast<hsize_t>(first);
+        count[dim] = static_cast<hsize_t>(n);
+    };
+
+    selectRange(0, selection.rowOffset, selection.rowCount);
+    selectRange(1, selection.columnOffset, selection.columnCount);
+
+    return GenH5::hyperSlab(dspace, count, offset);
 }
 
 GenH5::DataSet
@@ -195,12 +342,17 @@ GtH5ExternalizeHelper::overwriteDataSet(const GenH5::DataType& dataType,
 {
     GenH5::File file = openFile({ GenH5::Create | GenH5::Open});
 
+    auto const& layout = gtExternalizationManager->storageLayout();
+
     // try retrieving by h5 reference
     auto dset = dereferenceDataSet(file, refVariant);
     if (dset.isValid())
     {
-        // make sure dataset has enough space
-        if (dset.dataSpace() != dataSpace || dset.dataType() != dataType)
+        // make sure dataset has enough space, chunked datasets are resized.
+        // Note: the whole data is rewritten regardless, as the rows that
+        // changed are not known
+        if (dset.dataType() != dataType ||
+            (dset.dataSpace() != dataSpace && !resizeDataSet(dset, dataSpace)))
         {
             dset.deleteRecursively();
             dset = GenH5::DataSet{};
@@ -213,7 +365,9 @@ GtH5ExternalizeHelper::overwriteDataSet(const GenH5::DataType& dataType,
 
         // try retrieving by path
         auto group =  file.root().createGroup(className(m_metaData).toUtf8());
-        dset = group.createDataSet(m_objUuid.toUtf8(), dataType, dataSpace);
+        dset = group.createDataSet(m_objUuid.toUtf8(), dataType,
+                                   makeDataSpace(dataSpace, layout),
+                                   makeProperties(dataType, dataSpace, layout));
 
         // update ref
         referenceDataSet(dset, refVariant);
@@ -16,11 +16,13 @@
 #include "gt_datamodel_exports.h"
 #include "gt_logging.h"
 #include "gt_logging/qt_bindings.h"
+#include "gt_externalizeddataselection.h"
 
 #include "genh5_version.h"
 #include "genh5_data.h"
 #include "genh5_dataset.h"
 #include "genh5_file.h"
+#include "genh5_dataspaceselection.h"
 
 class GtExternalizedObject;
 /**
@@ -60,6 +62,35 @@ public:
               QVariant& refVariant,
               bool fetchInitialVersion) const noexcept(false);
 
+    /**
+     * @brief reads a selection of the data from the desired dataset. Only the
+     * hyperslab of the selection is read from the file.
+     * @tparam T data type of the dataset to read
+     * @param data data object
+     * @param refVariant varaint containing the reference to a HDF5 dataset
+     * @param selection rows (first dimension) and columns (second dimension)
+     * to read. Columns of compound data are selected by the members of the
+     * data type instead.
+     * @return success (will throw if operation fails)
+     */
+    template<typename Data>
+    bool read(Data& data,
+              QVariant& refVariant,
+              bool fetchInitialVersion,
+              GtExternalizedDataSelection const& selection
+              ) const noexcept(false);
+
+    /**
+     * @brief Creates the hyperslab of the dataset for the selection. The
+     * selection is clamped to the extent of the dataset.
+     * @param dset dataset
+     * @param selection selection
+     * @return hyperslab
+     */
+    static GenH5::DataSpaceSelection hyperslab(
+            GenH5::DataSet const& dset,
+            GtExternalizedDataSelection const& selection) noexcept(false);
+
     /**
      * @brief Opens the associated HDF5 file
      * @param flags Access flags of the file
@@ -143,6 +174,28 @@ GtH5ExternalizeHelper::read(Data& data,
 
     return true;
 }
+
+template<typename Data>
+inline bool
+GtH5ExternalizeHelper::read(Data& data,
+                            QVariant& refVariant,
+                            bool fetchInitialVersion,
+                            GtExternalizedDataSelection const& selection
+                            ) const noexcept(false)
+{
+    // open the associated dataset
+    auto dset = openDataSet(refVariant, fetchInitialVersion);
+
+    // read the selected data from the dataset
+    if (!dset.read(data, hyperslab(dset, selection)))
+    {
+        gtError() << QObject::tr("HDF5: Could not read from the dataset!")
+                  << QObject::tr("(Reading selection failed)");
+        return false;
+    }
+
+    return true;
+}
 #endif
 
 #endif // GTH5EXTERNALIZEHELPER
@@ -18,6 +18,7 @@
 #include "gt_structproperty.h"
 #include "gt_propertystructcontainer.h"
 #include "gt_objectfactory.h"
+#include "internal/contenthash.h"
 
 #include "gt_object.h"
 #include "gt_qtutilities.h"
@@ -25,8 +26,20 @@
 #include <QUuid>
 #include <QSignalMapper>
 #include <QThread>
+#include <QChildEvent>
+#include <QCoreApplication>
+#include <QMultiHash>
 
 #include <algorithm>
+#include <atomic>
+
+namespace
+{
+
+/// algorithm used by GtObject::calcHash
+std::atomic<gt::HashAlgorithm> s_hashAlgorithm{gt::HashAlgorithm::Fast};
+
+} // namespace
 
 struct DummyData
 {
@@ -37,6 +50,10 @@ struct DummyData
 
 struct GtObject::Impl
 {
+    /// uuid -> object lookup table of an object tree. Multiple entries per
+    /// uuid are possible, e.g. if a clone is part of the same tree
+    using UuidIndex = QMultiHash<QString, GtObject*>;
+
     bool isDummy() const
     {
         return m_isDummy;
@@ -88,6 +105,321 @@ struct GtObject::Impl
     /// TODO: use a variant here
     DummyData dummyData;
 
+    /// uuid index of the object tree. Only set for the root object of a tree
+    /// and only once a uuid lookup was requested
+    std::unique_ptr<UuidIndex> uuidIndex;
+
+    /// cached direct child objects in order of the QObject children.
+    /// Only valid once created on first access
+    QVector<GtObject*> childObjects;
+
+    /// whether the child object cache was created
+    bool childCacheValid{false};
+
+    /// whether the cached rows of the child objects are up to date
+    bool childRowsValid{false};
+
+    /// position of the object within the child objects of its parent
+    int row{-1};
+
+    /// cached hash of the object data (not including the children)
+    QByteArray ownHash;
+
+    /// cached hash of the object including all children. Only set if the
+    /// data of the whole subtree is tracked by change signals
+    QByteArray fullHash;
+
+    /// algorithm of the cached hashes
+    gt::HashAlgorithm hashAlgorithm{gt::HashAlgorithm::Fast};
+
+    /// whether properties were registered, which do not signal changes
+    bool hasSilentProperties{false};
+
+    /**
+     * @brief Clears the cached full hashes of the object and of all its
+     * parents.
+     * @param obj Object
+     * @param ownData Whether the data of the object itself changed
+     */
+    static void invalidateHashes(GtObject& obj, bool ownData = true)
+    {
+        if (ownData) obj.pimpl->ownHash.clear();
+
+        for (GtObject* o = &obj; o; o = o->parentObject())
+        {
+            o->pimpl->fullHash.clear();
+        }
+    }
+
+    /**
+     * @brief Clears the cached hashes of the whole subtree and of all
+     * parents of the object.
+     * @param obj Object
+     */
+    static void invalidateHashesRecursively(GtObject& obj)
+    {
+        for (GtObject* child : obj.findChildren<GtObject*>())
+        {
+            child->pimpl->ownHash.clear();
+            child->pimpl->fullHash.clear();
+        }
+
+        invalidateHashes(obj);
+    }
+
+    /**
+     * @brief Returns whether the hash of the object data may be cached, i.e.
+     * whether all changes of the data are signaled. Data stored in meta
+     * properties or silent properties may change silently.
+     * @param obj Object
+     * @return Whether the hash may be cached
+     */
+    static bool isHashCacheable(GtObject const& obj)
+    {
+        return !obj.isDummy() && !obj.pimpl->hasSilentProperties &&
+               obj.metaObject()->propertyCount() ==
+                   QObject::staticMetaObject.propertyCount();
+    }
+
+    /**
+     * @brief Returns the hash of the object including all children. Cached
+     * hashes are reused, only uncached subtrees are hashed.
+     * @param obj Object
+     * @param algorithm Hash algorithm
+     * @param cacheable Set to false if the hash may not be cached
+     * @return Hash
+     */
+    static QByteArray hash(GtObject const& obj, gt::HashAlgorithm algorithm,
+                           bool& cacheable)
+    {
+        Impl& d = *obj.pimpl;
+
+        if (d.hashAlgorithm != algorithm)
+        {
+            d.ownHash.clear();
+            d.fullHash.clear();
+            d.hashAlgorithm = algorithm;
+        }
+
+        if (!d.fullHash.isEmpty())
+        {
+            return d.fullHash;
+        }
+
+        bool subtreeCacheable = isHashCacheable(obj);
+
+        QByteArray own = d.ownHash;
+
+        if (own.isEmpty())
+        {
+            own = GtObjectIO().toMemento(&obj, true, true)
+                    .calculatePropertyHash(algorithm);
+
+            if (subtreeCacheable) d.ownHash = own;
+        }
+
+        // same structure as the full hash of a memento
+        gt::detail::ContentHash hash(algorithm);
+        hash.addData(own);
+
+        for (GtObject const* child : obj.findDirectChildren())
+        {
+            hash.addData(Impl::hash(*child, algorithm, subtreeCacheable));
+        }
+
+        QByteArray retval = hash.result();
+
+        if (subtreeCacheable) d.fullHash = retval;
+
+        cacheable = cacheable && subtreeCacheable;
+
+        return retval;
+    }
+
+    /**
+     * @brief Returns whether the uuid index and the child object cache can be
+     * used. Both are maintained using child events, which are only delivered
+     * if an application instance exists.
+     * @return Whether child events are available
+     */
+    static bool childEventsAvailable()
+    {
+        return QCoreApplication::instance() &&
+               !QCoreApplication::closingDown();
+    }
+
+    /**
+     * @brief Returns the root object of the tree the object belongs to
+     * @param obj Object
+     * @return Root object
+     */
+    static GtObject& treeRoot(GtObject& obj)
+    {
+        GtObject* root = &obj;
+        while (GtObject* p = root->parentObject())
+        {
+            root = p;
+        }
+        return *root;
+    }
+
+    /**
+     * @brief Returns the uuid index of the tree the object belongs to.
+     * @param obj Object
+     * @return Uuid index. Nullptr if no index was created for the tree yet
+     */
+    static UuidIndex* treeIndex(GtObject& obj)
+    {
+        return treeRoot(obj).pimpl->uuidIndex.get();
+    }
+
+    /**
+     * @brief Returns the uuid index of the tree the object belongs to. The
+     * index is created if it does not exist yet.
+     * @param obj Object
+     * @return Uuid index
+     */
+    static UuidIndex& createTreeIndex(GtObject& obj)
+    {
+        GtObject& root = treeRoot(obj);
+        auto& index = root.pimpl->uuidIndex;
+
+        if (!index)
+        {
+            index = std::make_unique<UuidIndex>();
+            insertSubtree(*index, root);
+        }
+
+        return *index;
+    }
+
+    /**
+     * @brief Adds the object and all its children to the uuid index
+     * @param index Uuid index
+     * @param obj Object
+     */
+    static void insertSubtree(UuidIndex& index, GtObject& obj)
+    {
+        index.insert(obj.uuid(), &obj);
+        for (GtObject* child : obj.findChildren())
+        {
+            index.insert(child->uuid(), child);
+        }
+    }
+
+    /**
+     * @brief Removes the object and all its children from the uuid index
+     * @param index Uuid index
+     * @param obj Object
+     */
+    static void removeSubtree(UuidIndex& index, GtObject& obj)
+    {
+        index.remove(obj.uuid(), &obj);
+        for (GtObject* child : obj.findChildren())
+        {
+            index.remove(child->uuid(), child);
+        }
+    }
+
+    /**
+     * @brief Updates the uuid of the object and its entry in the uuid index
+     * @param obj Object
+     * @param uuid New uuid
+     */
+    static void changeUuid(GtObject& obj, QString uuid)
+    {
+        UuidIndex* index = treeIndex(obj);
+
+        if (index)
+        {
+            index->remove(obj.pimpl->uuid, &obj);
+            index->insert(uuid, &obj);
+        }
+
+        obj.pimpl->uuid = std::move(uuid);
+
+        invalidateHashes(obj);
+    }
+
+    /**
+     * @brief Returns the cached direct child objects of the object. The
+     * cache is created if it does not exist yet.
+     * @param obj Object
+     * @return Child objects
+     */
+    static QVector<GtObject*> const& childCache(GtObject const& obj)
+    {
+        Impl& d = *obj.pimpl;
+
+        if (!d.childCacheValid)
+        {
+            d.childObjects.clear();
+            for (QObject* c : obj.children())
+            {
+                if (auto* child = qobject_cast<GtObject*>(c))
+                {
+                    d.childObjects.push_back(child);
+                }
+            }
+            d.childCacheValid = true;
+            d.childRowsValid = false;
+        }
+
+        return d.childObjects;
+    }
+
+    /**
+     * @brief Updates the rows of all cached child objects if necessary
+     */
+    void updateChildRows()
+    {
+        if (childRowsValid) return;
+
+        for (int i = 0; i < childObjects.size(); ++i)
+        {
+            childObjects[i]->pimpl->row = i;
+        }
+        childRowsValid = true;
+    }
+
+    /**
+     * @brief Appends the child to the child object cache
+     * @param child Child object
+     */
+    void appendChildObject(GtObject& child)
+    {
+        if (!childCacheValid) return;
+
+        child.pimpl->row = childObjects.size();
+        childObjects.push_back(&child);
+    }
+
+    /**
+     * @brief Removes the child from the child object cache
+     * @param child Child object
+     */
+    void removeChildObject(GtObject& child)
+    {
+        if (!childCacheValid) return;
+
+        int pos = child.pimpl->row;
+        if (pos < 0 || pos >= childObjects.size() ||
+            childObjects.at(pos) != &child)
+        {
+            pos = childObjects.indexOf(&child);
+        }
+
+        if (pos < 0) return;
+
+        childObjects.remove(pos);
+        child.pimpl->row = -1;
+
+        // rows of subsequent children have changed
+        if (pos != childObjects.size())
+        {
+            childRowsValid = false;
+        }
+    }
 };
 
 GtObject::GtObject(GtObject* parent) :
@@ -107,7 +439,22 @@ GtObject::GtObject(GtObject* parent) :
     connect(this, SIGNAL(objectNameChanged(QString)), SLOT(changed()));
 }
 
-GtObject::~GtObject() = default;
+GtObject::~GtObject()
+{
+    // children are destroyed afterwards, when this object is no longer a
+    // GtObject. Thus the whole subtree is removed from the uuid index here
+    if (GtObject* p = parentObject())
+    {
+        if (Impl::UuidIndex* index = Impl::treeIndex(*p))
+        {
+            Impl::removeSubtree(*index, *this);
+        }
+
+        p->pimpl->removeChildObject(*this);
+
+        Impl::invalidateHashes(*p, false);
+    }
+}
 
 GtObject::ObjectFlags
 GtObject::objectFlags() const
@@ -160,18 +507,28 @@ GtObject::fromMemento(const GtObjectMemento& memento)
 
     // merge data
     memento.mergeTo(*this, *pimpl->factory);
+
+    Impl::invalidateHashesRecursively(*this);
 }
 
 bool
 GtObject::applyDiff(GtObjectMementoDiff& diff)
 {
-    return GtObjectIO::applyDiff(diff, this);
+    bool success = GtObjectIO::applyDiff(diff, this);
+
+    Impl::invalidateHashesRecursively(*this);
+
+    return success;
 }
 
 bool
 GtObject::revertDiff(GtObjectMementoDiff& diff)
 {
-    return GtObjectIO::revertDiff(diff, this);
+    bool success = GtObjectIO::revertDiff(diff, this);
+
+    Impl::invalidateHashesRecursively(*this);
+
+    return success;
 }
 
 namespace {
@@ -303,13 +660,13 @@ GtObject::setUuid(const QString& val)
         return;
     }
 
-    pimpl->uuid = val;
+    Impl::changeUuid(*this, val);
 }
 
 void
 GtObject::newUuid(bool renewChildUUIDs)
 {
-    pimpl->uuid = QUuid::createUuid().toString();
+    Impl::changeUuid(*this, QUuid::createUuid().toString());
 
     if (renewChildUUIDs)
     {
@@ -320,10 +677,33 @@ GtObject::newUuid(bool renewChildUUIDs)
 QString
 GtObject::calcHash() const
 {
-    GtObjectMemento mem = toMemento();
-    mem.calculateHashes();
+    return calcHash(defaultHashAlgorithm());
+}
 
-    return mem.fullHash().toHex();
+QString
+GtObject::calcHash(gt::HashAlgorithm algorithm) const
+{
+    bool cacheable = true;
+
+    return Impl::hash(*this, algorithm, cacheable).toHex();
+}
+
+void
+GtObject::setDefaultHashAlgorithm(gt::HashAlgorithm algorithm)
+{
+    s_hashAlgorithm = algorithm;
+}
+
+gt::HashAlgorithm
+GtObject::defaultHashAlgorithm()
+{
+    return s_hashAlgorithm;
+}
+
+bool
+GtObject::hasSilentData() const
+{
+    return !Impl::isHashCacheable(*this);
 }
 
 bool
@@ -383,12 +763,37 @@ GtObject::childNumber() const
 {
     GtObject const* p = parentObject();
 
-    if (p)
+    if (!p)
+    {
+        return -1;
+    }
+
+    if (!Impl::childEventsAvailable())
     {
         return p->findDirectChildren().indexOf(this);
     }
 
-    return -1;
+    Impl::childCache(*p);
+    p->pimpl->updateChildRows();
+
+    return pimpl->row;
+}
+
+GtObject*
+GtObject::childAt(int pos)
+{
+    if (!Impl::childEventsAvailable())
+    {
+        return findDirectChildren().value(pos, nullptr);
+    }
+
+    return Impl::childCache(*this).value(pos, nullptr);
+}
+
+GtObject const*
+GtObject::childAt(int pos) const
+{
+    return const_cast<GtObject*>(this)->childAt(pos);
 }
 
 QObject*
@@ -403,6 +808,17 @@ GtObject::parent() const
     return QObject::parent();
 }
 
+int
+GtObject::directChildCount() const
+{
+    if (!Impl::childEventsAvailable())
+    {
+        return findDirectChildren().size();
+    }
+
+    return Impl::childCache(*this).size();
+}
+
 GtObject*
 GtObject::parentObject()
 {
@@ -623,6 +1039,7 @@ GtObject::propertyContainers() const
 void
 GtObject::changed()
 {
+    Impl::invalidateHashes(*this);
     setFlag(GtObject::HasOwnChanges);
     emit dataChanged(this);
 }
@@ -727,7 +1144,33 @@ GtObject::getObjectByUuid(const QString& objectUUID)
         return this;
     }
 
-    return gt::findObject(objectUUID, findChildren());
+    if (!Impl::childEventsAvailable())
+    {
+        return gt::findObject(objectUUID, findChildren());
+    }
+
+    // the index covers the whole tree, thus the object found must be
+    // a child of this object
+    auto isChild = [this](QObject const* obj) {
+        while ((obj = obj->parent()))
+        {
+            if (obj == this) return true;
+        }
+        return false;
+    };
+
+    Impl::UuidIndex const& index = Impl::createTreeIndex(*this);
+
+    for (auto iter = index.find(objectUUID);
+         iter != index.end() && iter.key() == objectUUID; ++iter)
+    {
+        if (isChild(iter.value()))
+        {
+            return iter.value();
+        }
+    }
+
+    return nullptr;
 }
 
 const GtObject*
@@ -766,6 +1209,7 @@ GtObject::connectProperty(GtAbstractProperty& property)
 {
     connect(&property, &GtAbstractProperty::changed, this,
             [this, p = &property]() {
+        Impl::invalidateHashes(*this);
         setFlag(GtObject::HasOwnChanges, true);
         emit dataChanged(this, p);
     });
@@ -868,18 +1312,21 @@ GtObject::registerPropertyStructContainer(GtPropertyStructContainer & c)
 
     connect(&c, &GtPropertyStructContainer::entryChanged, this,
             [this](int, GtAbstractProperty* property) {
+        Impl::invalidateHashes(*this);
         setFlag(GtObject::HasOwnChanges, true);
         emit dataChanged(this, property);
     });
 
     connect(&c, &GtPropertyStructContainer::entryAdded, this,
             [this](int) {
+        Impl::invalidateHashes(*this);
         setFlag(GtObject::HasOwnChanges, true);
         emit dataChanged(this);
     });
 
     connect(&c, &GtPropertyStructContainer::entryRemoved, this,
             [this](int) {
+        Impl::invalidateHashes(*this);
         setFlag(GtObject::HasOwnChanges, true);
         emit dataChanged(this);
     });
@@ -909,6 +1356,7 @@ GtObject::registerSilentProperty(GtAbstractProperty& property)
     }
 
     pimpl->properties.append(&property);
+    pimpl->hasSilentProperties = true;
     return true;
 }
 
@@ -939,6 +1387,42 @@ GtObject::childAccepted(GtObject* /*child*/)
     return true;
 }
 
+void
+GtObject::childEvent(QChildEvent* event)
+{
+    // destroyed children are no longer GtObjects at this point. They are
+    // removed from the uuid index and the child cache in the destructor
+    auto* child = qobject_cast<GtObject*>(event->child());
+
+    if (child && event->added())
+    {
+        // the child is no longer the root of its own tree
+        child->pimpl->uuidIndex.reset();
+
+        if (Impl::UuidIndex* index = Impl::treeIndex(*this))
+        {
+            Impl::insertSubtree(*index, *child);
+        }
+
+        pimpl->appendChildObject(*child);
+
+        Impl::invalidateHashes(*this, false);
+    }
+    else if (child && event->removed())
+    {
+        if (Impl::UuidIndex* index = Impl::treeIndex(*this))
+        {
+            Impl::removeSubtree(*index, *child);
+        }
+
+        pimpl->removeChildObject(*child);
+
+        Impl::invalidateHashes(*this, false);
+    }
+
+    QObject::childEvent(event);
+}
+
 bool
 gt::isDerivedFromClass(GtObject* obj, const QString& superClassName)
 {
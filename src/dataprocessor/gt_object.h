@@ -66,6 +66,17 @@ T findRoot(Object& object, T last = nullptr);
  */
 void GT_DATAMODEL_EXPORT moveToThread(GtObject& object, QThread* thread);
 
+/**
+ * @brief Algorithms used to calculate the content hashes of objects
+ */
+enum class HashAlgorithm
+{
+    /// Fast non-cryptographic hash (XXH64)
+    Fast,
+    /// SHA-256
+    Sha256
+};
+
 }
 
 /**
@@ -242,11 +253,42 @@ public:
     void newUuid(bool renewChildUUIDs = false);
 
     /**
-     * @brief Calculates object specific hash.
+     * @brief Calculates object specific hash using the default hash
+     * algorithm. The hashes of objects which are fully tracked by change
+     * signals are cached and only recalculated along the path of a change.
      * @return Object specific hash.
      */
     QString calcHash() const;
 
+    /**
+     * @brief Calculates object specific hash using the given algorithm.
+     * @param algorithm Hash algorithm
+     * @return Object specific hash.
+     */
+    QString calcHash(gt::HashAlgorithm algorithm) const;
+
+    /**
+     * @brief Sets the algorithm used by calcHash(). Defaults to
+     * gt::HashAlgorithm::Fast. Changing the algorithm changes all hashes,
+     * thus it should be set before any project is loaded.
+     * @param algorithm Hash algorithm
+     */
+    static void setDefaultHashAlgorithm(gt::HashAlgorithm algorithm);
+
+    /**
+     * @brief Returns the algorithm used by calcHash().
+     * @return Hash algorithm
+     */
+    static gt::HashAlgorithm defaultHashAlgorithm();
+
+    /**
+     * @brief Returns whether the data of the object may change without
+     * flagging the object as changed. This is the case for meta properties,
+     * silent properties and dummy objects.
+     * @return Whether the object has silent data
+     */
+    bool hasSilentData() const;
+
     /**
      * @brief Returns true if is default flag is active. Otherwise false is
      * returned.
@@ -300,6 +342,15 @@ public:
      */
     int childNumber() const;
 
+    /**
+     * @brief Returns the direct child object at the given position. The
+     * position corresponds to the child number of the child object.
+     * @param pos Position index
+     * @return Child object. Returns nullptr if the position is out of range
+     */
+    GtObject* childAt(int pos);
+    GtObject const* childAt(int pos) const;
+
     /**
      * @brief Reimplemented from QObject. Returns the parent with const
      * correctness
@@ -432,6 +483,12 @@ public:
               gt::trait::enable_if_ptr_derived_of_qobject<T> = true>
     int childCount(const QString& name = {}) const
     {
+        if (std::is_same<gt::trait::const_ptr<T>, GtObject const*>::value &&
+            name.isEmpty())
+        {
+            return directChildCount();
+        }
+
         return findDirectChildren<gt::trait::const_ptr<T>>(name).size();
     }
 
@@ -600,6 +657,8 @@ public:
      * Searches for an object with the uuid.
      * The functions checks the object itself and all children if one of them
      * has an identical uuid to the given argument.
+     * The lookup uses a uuid index of the object tree, which is created on
+     * first use and kept up to date afterwards.
      * @param uuid
      * @return the pointer to the found object with the given uuid,
      * if no object was found return nullptr.
@@ -698,6 +757,13 @@ protected:
      */
     virtual bool childAccepted(GtObject* child);
 
+    /**
+     * @brief Reimplemented from QObject. Keeps the uuid index of the object
+     * tree up to date if children are added or removed.
+     * @param event Child event
+     */
+    void childEvent(QChildEvent* event) override;
+
 protected slots:
     /**
      * @brief changed
@@ -715,6 +781,12 @@ private:
      */
     QString objectPath(QString& str) const;
 
+    /**
+     * @brief Returns the number of direct child objects
+     * @return Number of direct child objects
+     */
+    int directChildCount() const;
+
     /**
      * @brief Connects the property changed singal to the data changed signal
      * of this object
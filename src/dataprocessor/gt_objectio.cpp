@@ -12,6 +12,8 @@
 #include <QStringList>
 #include <QMetaProperty>
 #include <QDomDocument>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
 #include <QUuid>
 #include <QPointF>
 #include <QDataStream>
@@ -61,6 +63,16 @@ namespace
     GtObjectMemento::PropertyData
     readProperty(const QDomElement& element, bool& error);
 
+    GtObjectMemento::PropertyData
+    readStreamProperty(QXmlStreamReader& reader);
+
+    GtObjectMemento::PropertyData
+    readStreamPropertyContainer(QXmlStreamReader& reader);
+
+    void
+    writeProperty(const GtObjectMemento::PropertyData& property,
+                  QXmlStreamWriter& writer);
+
 
     bool
     handlePropContEntryChanged(GtObject& parentObject,
@@ -220,7 +232,7 @@ GtObjectIO::setFactory(GtAbstractObjectFactory* factory)
 }
 
 GtObjectMemento
-GtObjectIO::toMemento(const GtObject* o, bool clone)
+GtObjectIO::toMemento(const GtObject* o, bool clone, bool skipChildren)
 {
     // global object element
     GtObjectMemento memento;
@@ -251,6 +263,11 @@ GtObjectIO::toMemento(const GtObject* o, bool clone)
     // object name
     memento.setIdent(o->objectName());
 
+    if (skipChildren)
+    {
+        return memento;
+    }
+
     // child objects
     auto const directChildren = o->findDirectChildren();
     memento.childObjects.reserve(directChildren.size());
@@ -334,6 +351,120 @@ GtObjectIO::toMemento(const QDomElement& e)
     return memento;
 }
 
+GtObjectMemento
+GtObjectIO::toMemento(QXmlStreamReader& reader)
+{
+    assert(reader.isStartElement() && reader.name() == gt::xml::S_OBJECT_TAG);
+
+    // global object element
+    QXmlStreamAttributes const attributes = reader.attributes();
+
+    auto memento = GtObjectMemento{}
+        .setClassName(attributes.value(gt::xml::S_CLASS_TAG).toString())
+        .setUuid(attributes.value(gt::xml::S_UUID_TAG).toString())
+        .setIdent(attributes.value(gt::xml::S_NAME_TAG).toString());
+
+    // only the first object list is read
+    bool childrenRead = false;
+
+    while (reader.readNextStartElement())
+    {
+        QStringRef const tag = reader.name();
+
+        if (tag == gt::xml::S_PROPERTY_TAG)
+        {
+            memento.properties.push_back(readStreamProperty(reader));
+        }
+        else if (tag == gt::xml::S_PROPERTYLIST_TAG)
+        {
+            QXmlStreamAttributes const attr = reader.attributes();
+            QString fieldType = attr.value(gt::xml::S_TYPE_TAG).toString();
+            QString fieldName = attr.value(gt::xml::S_NAME_TAG).toString();
+            QString text = reader.readElementText(
+                        QXmlStreamReader::IncludeChildElements);
+
+            if (!fieldType.isEmpty() && !fieldName.isEmpty())
+            {
+                GtObjectMemento::PropertyData propData;
+                propData.name = fieldName;
+                propData.setData(propertyListToVariant(text, fieldType));
+
+                memento.properties.push_back(propData);
+            }
+        }
+        else if (tag == gt::xml::S_PROPERTYCONT_TAG)
+        {
+            memento.propertyContainers.push_back(
+                        readStreamPropertyContainer(reader));
+        }
+        else if (tag == gt::xml::S_OBJECTLIST_TAG && !childrenRead)
+        {
+            childrenRead = true;
+
+            while (reader.readNextStartElement())
+            {
+                if (reader.name() != gt::xml::S_OBJECT_TAG)
+                {
+                    reader.skipCurrentElement();
+                    continue;
+                }
+
+                memento.childObjects.push_back(toMemento(reader));
+            }
+        }
+        else
+        {
+            reader.skipCurrentElement();
+        }
+    }
+
+    return memento;
+}
+
+void
+GtObjectIO::writeMemento(const GtObjectMemento& memento,
+                         QXmlStreamWriter& writer)
+{
+    // attributes are written in alphabetical order
+    writer.writeStartElement(gt::xml::S_OBJECT_TAG);
+    writer.writeAttribute(gt::xml::S_CLASS_TAG, memento.className());
+    writer.writeAttribute(gt::xml::S_NAME_TAG, memento.ident());
+    writer.writeAttribute(gt::xml::S_UUID_TAG, memento.uuid());
+
+    for (const GtObjectMemento::PropertyData& property : memento.properties)
+    {
+        writeProperty(property, writer);
+    }
+
+    for (const GtObjectMemento::PropertyData& container :
+         memento.propertyContainers)
+    {
+        writer.writeStartElement(gt::xml::S_PROPERTYCONT_TAG);
+        writer.writeAttribute(gt::xml::S_NAME_TAG, container.name);
+
+        for (const GtObjectMemento::PropertyData& entry :
+             container.childProperties)
+        {
+            writeProperty(entry, writer);
+        }
+
+        writer.writeEndElement();
+    }
+
+    if (!memento.childObjects.isEmpty())
+    {
+        writer.writeStartElement(gt::xml::S_OBJECTLIST_TAG);
+
+        for (const GtObjectMemento& child : memento.childObjects)
+        {
+            writeMemento(child, writer);
+        }
+
+        writer.writeEndElement();
+    }
+
+    writer.writeEndElement();
+}
 
 bool
 applyDiffOnObject(QDomElement& parent, GtObject* parentObject, DiffMode mode)
@@ -695,6 +826,166 @@ readProperty(const QDomElement& element, bool& error)
     return propData;
 }
 
+GtObjectMemento::PropertyData
+readStreamProperty(QXmlStreamReader& reader)
+{
+    GtObjectMemento::PropertyData propData;
+
+    // attributes must be read before the element text
+    QXmlStreamAttributes const attributes = reader.attributes();
+
+    QString fieldType = attributes.value(gt::xml::S_TYPE_TAG).toString();
+    propData.name = attributes.value(gt::xml::S_NAME_TAG).toString();
+
+    QString fieldActive = attributes.value(gt::xml::S_ACTIVE_TAG).toString();
+    if (!fieldActive.isEmpty())
+    {
+        propData.isActive = QVariant(fieldActive).toBool();
+    }
+
+    // equivalent to QDomElement::text
+    QString text = reader.readElementText(
+                QXmlStreamReader::IncludeChildElements);
+
+    propData.setData(propertyToVariant(text, fieldType));
+
+    return propData;
+}
+
+GtObjectMemento::PropertyData
+readStreamStructPropertyEntry(QXmlStreamReader& reader, bool& error)
+{
+    error = true;
+    GtObjectMemento::PropertyData pd;
+
+    QXmlStreamAttributes const attributes = reader.attributes();
+
+    const auto typeName = attributes.value(gt::xml::S_TYPE_TAG).toString();
+    const auto name = attributes.value(gt::xml::S_NAME_TAG).toString();
+
+    if (typeName.isEmpty())
+    {
+        gtError().noquote().nospace()
+                << "Empty type in property container entry on line "
+                << reader.lineNumber();
+        reader.skipCurrentElement();
+        return pd;
+    }
+
+    if (name.isEmpty())
+    {
+        gtError().noquote().nospace()
+                << "Empty name in property container entry on line "
+                << reader.lineNumber();
+        reader.skipCurrentElement();
+        return pd;
+    }
+
+    pd.toStruct(typeName);
+    pd.name = name;
+
+    while (reader.readNextStartElement())
+    {
+        if (reader.name() != gt::xml::S_PROPERTY_TAG)
+        {
+            reader.skipCurrentElement();
+            continue;
+        }
+
+        pd.childProperties.push_back(readStreamProperty(reader));
+    }
+
+    error = false;
+    return pd;
+}
+
+GtObjectMemento::PropertyData
+readStreamPropertyContainer(QXmlStreamReader& reader)
+{
+    assert(reader.name() == gt::xml::S_PROPERTYCONT_TAG);
+
+    GtObjectMemento::PropertyData pd;
+    pd.name = reader.attributes().value(gt::xml::S_NAME_TAG).toString();
+
+    while (reader.readNextStartElement())
+    {
+        if (reader.name() != gt::xml::S_PROPERTY_TAG)
+        {
+            reader.skipCurrentElement();
+            continue;
+        }
+
+        bool error = false;
+        auto entry = readStreamStructPropertyEntry(reader, error);
+
+        if (!error) pd.childProperties.push_back(std::move(entry));
+    }
+
+    return pd;
+}
+
+void
+writeProperty(const GtObjectMemento::PropertyData& property,
+              QXmlStreamWriter& writer)
+{
+    using PD = GtObjectMemento::PropertyData;
+
+    QString tag = gt::xml::S_PROPERTY_TAG;
+    QString type = property.dataType();
+    QString text;
+    // properties without value do not contain a text node
+    bool writeEmptyText = true;
+
+    switch(property.type())
+    {
+    case PD::ENUM_T:
+        text = property.data().toString();
+        break;
+    case PD::STRUCT_T:
+        text = GtObjectIO::variantToString(property.data());
+        writeEmptyText = false;
+        break;
+    case PD::DATA_T:
+        if (GtObjectIO::usePropertyList(property.data()))
+        {
+            tag = gt::xml::S_PROPERTYLIST_TAG;
+            GtObjectIO::propertyListStringType(property.data(), text, type);
+        }
+        else
+        {
+            text = GtObjectIO::variantToString(property.data());
+            writeEmptyText = false;
+        }
+        break;
+    }
+
+    // attributes are written in alphabetical order. Active is only written,
+    // if active == false, otherwise assume true
+    writer.writeStartElement(tag);
+
+    if (!property.isActive)
+    {
+        writer.writeAttribute(gt::xml::S_ACTIVE_TAG,
+                              QVariant(false).toString());
+    }
+
+    writer.writeAttribute(gt::xml::S_NAME_TAG, property.name);
+    writer.writeAttribute(gt::xml::S_TYPE_TAG, type);
+
+    if (!text.isEmpty() || writeEmptyText)
+    {
+        // remove carriage returns to avoid double definitions
+        writer.writeCharacters(text.remove(QLatin1Char('\r')));
+    }
+
+    for (const PD& child : property.childProperties)
+    {
+        writeProperty(child, writer);
+    }
+
+    writer.writeEndElement();
+}
+
 } // namespace
 
 
@@ -19,6 +19,8 @@
 
 class QDomElement;
 class QDomDocument;
+class QXmlStreamReader;
+class QXmlStreamWriter;
 class GtObject;
 class GtAbstractObjectFactory;
 class GtObjectMementoDiff;
@@ -45,8 +47,10 @@ public:
     /** Creates Memento from given GtObject.
         @param o GtObject pointer
         @param clone Wether identiy information should be cloned or not
+        @param skipChildren Wether only the properties of this GtObject should be stored or also all child-GtObjects
         @return GtObjectMemento memento */
-    GtObjectMemento toMemento(const GtObject* o, bool clone = true);
+    GtObjectMemento toMemento(const GtObject* o, bool clone = true,
+                              bool skipChildren = false);
 
     /** Creates QDomElement from given GtObjectMemento.
         @param m GtObjectMemento
@@ -71,6 +75,20 @@ public:
         @return GtObjectMemento memento */
     GtObjectMemento toMemento(const QDomElement& e);
 
+    /** Creates Memento from the object element the stream reader is
+        positioned at. Afterwards the reader is positioned at the end of
+        the object element.
+        @param reader XML stream reader
+        @return GtObjectMemento memento */
+    GtObjectMemento toMemento(QXmlStreamReader& reader);
+
+    /** Writes the given memento as object element to the stream writer.
+        The output is identical to the ordered output of the dom element
+        (see gt::xml::writeDomElementOrderedAttribute).
+        @param m GtObjectMemento
+        @param writer XML stream writer */
+    void writeMemento(const GtObjectMemento& m, QXmlStreamWriter& writer);
+
 
     /**
      * @brief applyDiff
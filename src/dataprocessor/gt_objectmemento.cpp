@@ -13,6 +13,7 @@
 #include <QIODevice>
 #include <QDataStream>
 #include <QMetaProperty>
+#include <QtConcurrent>
 
 #include "gt_externalizedobject.h"
 #include "gt_objectmemento.h"
@@ -23,6 +24,9 @@
 #include "gt_structproperty.h"
 #include "gt_exceptions.h"
 #include "internal/varianthasher.h"
+#include "internal/binaryformat.h"
+#include "internal/contenthash.h"
+#include "internal/subtreeconcurrency.h"
 #include "internal/gt_externalizedobjectprivate.h"
 
 using PD = GtObjectMemento::PropertyData;
@@ -48,6 +52,11 @@ GtObjectMemento::GtObjectMemento(const QDomElement& element)
 
 GtObjectMemento::GtObjectMemento(const QByteArray& byteArray)
 {
+    if (gt::detail::binary::isMemento(byteArray))
+    {
+        gt::detail::binary::read(byteArray, *this);
+        return;
+    }
 
     QDomDocument doc;
     if (!doc.setContent(byteArray))
@@ -59,6 +68,11 @@ GtObjectMemento::GtObjectMemento(const QByteArray& byteArray)
 
 }
 
+GtObjectMemento::GtObjectMemento(QXmlStreamReader& reader)
+{
+    *this = GtObjectIO().toMemento(reader);
+}
+
 bool
 GtObjectMemento::isNull() const
 {
@@ -96,6 +110,23 @@ GtObjectMemento::toByteArray() const
     return doc.toByteArray();
 }
 
+QByteArray
+GtObjectMemento::toBinary() const
+{
+    if (isNull()) return {};
+
+    return gt::detail::binary::write(*this);
+}
+
+void
+GtObjectMemento::writeToStream(QXmlStreamWriter& writer) const
+{
+    if (!isNull())
+    {
+        GtObjectIO().writeMemento(*this, writer);
+    }
+}
+
 const QString&
 GtObjectMemento::className() const
 {
@@ -145,10 +176,10 @@ GtObjectMemento::canCastTo(const QString& classname,
 }
 
 void
-propertyHashHelper(const PD& property, QCryptographicHash& hash,
+propertyHashHelper(const PD& property, gt::detail::ContentHash& hash,
                                     gt::detail::VariantHasher& variantHasher)
 {
-    QCryptographicHash propHash(QCryptographicHash::Sha256);
+    gt::detail::ContentHash propHash(hash.algorithm());
 
     // hash property
     propHash.addData(property.name.toUtf8());
@@ -171,16 +202,11 @@ propertyHashHelper(const PD& property, QCryptographicHash& hash,
     hash.addData(property.hash);
 }
 
-void
-GtObjectMemento::calculateHashes() const
+QByteArray
+GtObjectMemento::calculatePropertyHash(gt::HashAlgorithm algorithm) const
 {
-    if (!m_fullHash.isNull())
-    {
-        return;
-    }
-
     // initialize hash function
-    QCryptographicHash hash(QCryptographicHash::Sha256);
+    gt::detail::ContentHash hash(algorithm);
 
     // hash members
     hash.addData(className().toUtf8());
@@ -198,9 +224,34 @@ GtObjectMemento::calculateHashes() const
         propertyHashHelper(p, hash, variantHasher);
     }
 
+    return hash.result();
+}
+
+void
+GtObjectMemento::calculateHashes() const
+{
+    if (!m_fullHash.isNull())
+    {
+        return;
+    }
+
+    gt::HashAlgorithm algorithm = GtObject::defaultHashAlgorithm();
+
     // store property hash
-    m_propertyHash = hash.result();
-    hash.reset();
+    m_propertyHash = calculatePropertyHash(algorithm);
+
+    gt::detail::ContentHash hash(algorithm);
+
+    // sibling subtrees are independent, large ones are hashed concurrently
+    if (childObjects.size() > 1 &&
+        gt::detail::countObjects(*this, gt::detail::S_CONCURRENT_SUBTREE_SIZE)
+            >= gt::detail::S_CONCURRENT_SUBTREE_SIZE)
+    {
+        QtConcurrent::blockingMap(childObjects.cbegin(), childObjects.cend(),
+                                  [](const GtObjectMemento& child) {
+            child.calculateHashes();
+        });
+    }
 
     // hash over property hash and child elements
     hash.addData(m_propertyHash);
@@ -22,6 +22,8 @@
 
 class GtAbstractObjectFactory;
 class GtObjecIO;
+class QXmlStreamReader;
+class QXmlStreamWriter;
 class QCryptographicHash;
 class VariantHasher;
 class GtPropertyStructInstance;
@@ -46,11 +48,20 @@ public:
     explicit GtObjectMemento(const QDomElement& element);
 
     /**
-     * @brief GtObjectMemento
-     * @param byteArray
+     * @brief Reads the memento from a byte array. The data may either be XML
+     * (see toByteArray) or the binary format (see toBinary).
+     * @param byteArray Memento data
      */
     explicit GtObjectMemento(const QByteArray& byteArray);
 
+    /**
+     * @brief Reads the memento from the object element the stream reader is
+     * positioned at. Afterwards the reader is positioned at the end of the
+     * object element.
+     * @param reader XML stream reader
+     */
+    explicit GtObjectMemento(QXmlStreamReader& reader);
+
     /**
      * @brief interface from QDomElement
      */
@@ -66,6 +77,21 @@ public:
      */
     QByteArray toByteArray() const;
 
+    /**
+     * @brief Returns the memento in a compact binary format. Values are not
+     * converted to strings. Intended for transient data, e.g. the clipboard
+     * or the process runner. Use toByteArray for XML data.
+     * @return Binary memento data
+     */
+    QByteArray toBinary() const;
+
+    /**
+     * @brief Writes the memento as object element to the stream writer
+     * without creating a dom document.
+     * @param writer XML stream writer
+     */
+    void writeToStream(QXmlStreamWriter& writer) const;
+
     /**
      * TODO: move to object io
      *
@@ -237,10 +263,19 @@ public:
     const QByteArray& fullHash() const {return m_fullHash;}
 
     /**
-     * @brief update fullHash and propertyHash, needs to be called before accessing these
+     * @brief update fullHash and propertyHash, needs to be called before accessing these.
+     * Uses the default hash algorithm of GtObject.
      */
     void calculateHashes() const;
 
+    /**
+     * @brief Calculates the hash of this object's properties (not including
+     * the child objects) using the given algorithm. The result is not cached.
+     * @param algorithm Hash algorithm
+     * @return Property hash
+     */
+    QByteArray calculatePropertyHash(gt::HashAlgorithm algorithm) const;
+
     struct ExternalizationInfo
     {
         bool isFetched = true;
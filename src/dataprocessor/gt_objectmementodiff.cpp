@@ -17,12 +17,17 @@
 #include "gt_algorithms.h"
 #include "gt_xmlexpr.h"
 #include "gt_objectfactory.h"
+#include "internal/subtreeconcurrency.h"
+#include "internal/binaryformat.h"
 
 #include <QCryptographicHash>
 #include <QHash>
+#include <QMutex>
+#include <QtConcurrent>
 
 #include <tl/optional.hpp>
 #include <algorithm>
+#include <vector>
 
 using PD = GtObjectMemento::PropertyData;
 
@@ -41,9 +46,21 @@ GtObjectMementoDiff::GtObjectMementoDiff(const GtObjectMemento& left,
 
 GtObjectMementoDiff::GtObjectMementoDiff(const QByteArray& byteArray)
 {
+    if (gt::detail::binary::isDocument(byteArray))
+    {
+        gt::detail::binary::read(byteArray, *this);
+        return;
+    }
+
     setContent(byteArray);
 }
 
+QByteArray
+GtObjectMementoDiff::toBinary() const
+{
+    return gt::detail::binary::write(*this);
+}
+
 GtObjectMementoDiff::GtObjectMementoDiff()
 {
 }
@@ -243,6 +260,10 @@ fetchExternalizedMementos(const GtObjectMemento& leftOrig,
         return {};
     }
 
+    // the externalization backend may not be used concurrently
+    static QMutex fetchMutex;
+    QMutexLocker locker(&fetchMutex);
+
     if (!objectToFetch->internalize())
     {
         gtError() << QObject::tr("Failed to internalize %1 memento for '%2'!")
@@ -331,154 +352,120 @@ GtObjectMementoDiff::makeDiff(const GtObjectMemento& leftOrig,
                                      diffObj);
     }
 
+    int const nLeft = left.childObjects.size();
+    int const nRight = right.childObjects.size();
+
     // create map of child object uuids
-    QHash<QString,int> leftChildIndexMap;
-    QHash<QString, int> completeMap;
-    QHash<QString, int> indexChangeMap;
-    for (int lchildIndex = 0; lchildIndex < left.childObjects.size(); lchildIndex++)
+    QHash<QString, int> leftChildIndexMap;
+    leftChildIndexMap.reserve(nLeft);
+    for (int lchildIndex = 0; lchildIndex < nLeft; lchildIndex++)
     {
         const GtObjectMemento& lchild(left.childObjects[lchildIndex]);
         leftChildIndexMap.insert(lchild.uuid(), lchildIndex);
-        completeMap.insert(lchild.uuid(), lchildIndex);
     }
 
+    // only the last child of duplicated uuids is considered
+    auto const isTracked = [&](int lchildIndex) {
+        return leftChildIndexMap.value(
+                   left.childObjects[lchildIndex].uuid()) == lchildIndex;
+    };
+
+    // index of the left child for each right child (-1 if added)
+    std::vector<int> rightToLeft(nRight, -1);
+    std::vector<bool> leftKept(nLeft, false);
+    std::vector<int> addedIndices;
+    // pairs of left and right index of modified children
+    std::vector<std::pair<int, int>> modified;
+
+    GtObjectIO oio;
+
     // look for modified/added children
-    for (int rchildIndex = 0; rchildIndex < right.childObjects.size(); rchildIndex++)
+    for (int rchildIndex = 0; rchildIndex < nRight; rchildIndex++)
     {
         const GtObjectMemento& rchild (right.childObjects[rchildIndex]);
-        auto lchildIter = leftChildIndexMap.find(rchild.uuid());
-        if (lchildIter != leftChildIndexMap.end())
+        auto lchildIter = leftChildIndexMap.constFind(rchild.uuid());
+        if (lchildIter != leftChildIndexMap.constEnd() && !leftKept[*lchildIter])
         {
             // check for modifications
             const GtObjectMemento& lchild(left.childObjects[*lchildIter]);
             if (lchild.fullHash() != rchild.fullHash())
             {
-                if (!makeDiff(lchild, rchild, diffRoot))
-                {
-                    return false;
-                }
+                modified.emplace_back(*lchildIter, rchildIndex);
             }
-            // take item from list to track removed objects
-            leftChildIndexMap.erase(lchildIter);
+
+            rightToLeft[rchildIndex] = *lchildIter;
+            leftKept[*lchildIter] = true;
         }
         else
         {
             diffObjectEmpty = false;
             // added child
-            GtObjectIO oio;
             QDomElement rchildElem = oio.toDomElement(rchild, *this, false);
             handleObjectAdded(rchildElem, rchildIndex, diffObj);
 
-            completeMap.insert(rchild.uuid(), rchildIndex);
-            gt::for_each_key(completeMap, [&](const QString& uuid)
-            {
-                if (uuid != rchild.uuid())
-                {
-                    if (completeMap.value(uuid) >= rchildIndex)
-                    {
-                        completeMap.insert(uuid, completeMap.value(uuid) + 1);
-
-                        if (!indexChangeMap.contains(uuid))
-                        {
-                            indexChangeMap.insert(uuid, 1);
-                        }
-                        else
-                        {
-                            indexChangeMap.insert(uuid, indexChangeMap.value(uuid) + 1);
-                        }
-                    }
-                }
-            });
+            addedIndices.push_back(rchildIndex);
         }
     }
 
-    QList<int> leftChildIndexSort = leftChildIndexMap.values();
-    std::sort(std::begin(leftChildIndexSort), std::end(leftChildIndexSort));
+    if (!makeChildDiffs(left, right, modified, diffRoot))
+    {
+        return false;
+    }
 
     // look for removed children
-    foreach (int lchildIndex, leftChildIndexSort)
+    for (int lchildIndex = 0; lchildIndex < nLeft; lchildIndex++)
     {
+        if (leftKept[lchildIndex] || !isTracked(lchildIndex)) continue;
+
         diffObjectEmpty = false;
         const GtObjectMemento& lchild(left.childObjects[lchildIndex]);
-        GtObjectIO oio;
         QDomElement lchildElem = oio.toDomElement(lchild, *this, false);
         handleObjectRemoved(lchildElem, lchildIndex, diffObj);
-
-        int completeMapIndex = completeMap.value(lchild.uuid());
-        gt::for_each_key(completeMap, [&](const QString& uuid)
-        {
-            if (uuid != lchild.uuid())
-            {
-                int index = completeMap.value(uuid);
-                if (index > completeMapIndex)
-                {
-                    if (indexChangeMap.contains(uuid))
-                    {
-                        indexChangeMap.insert(uuid, indexChangeMap.value(uuid) - 1);
-                    }
-                    else
-                    {
-                        indexChangeMap.insert(uuid, -1);
-                    }
-                }
-            }
-        });
-
-        if (indexChangeMap.contains(lchild.uuid()))
-        {
-            indexChangeMap.remove(lchild.uuid());
-        }
     }
 
-    gt::for_each_key(indexChangeMap, [&](const QString& uuid)
+    // Expected index of each kept child after inserting the added children
+    // at their new indices and dropping the removed children. Children that
+    // are not located at their expected index have been moved. Added
+    // children keep their index, as subsequent insertions only shift
+    // children behind them.
+    std::vector<int> expectedIndex(nLeft, -1);
+    auto added = addedIndices.cbegin();
+    int slot = 0;
+    int pos = 0;
+    for (int lchildIndex = 0; lchildIndex < nLeft; lchildIndex++)
     {
-        if (indexChangeMap.value(uuid) == 0)
+        if (!isTracked(lchildIndex)) continue;
+
+        for (; added != addedIndices.cend() && *added == slot; ++added)
         {
-            indexChangeMap.remove(uuid);
+            ++slot;
+            ++pos;
         }
-    });
 
-//  look for index changes
-    QHash<QString, int> lchildMap;
-    for (int lchildIndex = 0; lchildIndex < left.childObjects.size(); lchildIndex++)
-    {
-        const GtObjectMemento& lchild(left.childObjects[lchildIndex]);
-        lchildMap.insert(lchild.uuid(), lchildIndex);
+        if (leftKept[lchildIndex]) expectedIndex[lchildIndex] = pos++;
+        ++slot;
     }
 
-    QHash<QString,int> rchildMap;
-    for (int rchildIndex = 0; rchildIndex < right.childObjects.size(); rchildIndex++)
+    // look for index changes
+    for (int rchildIndex = 0; rchildIndex < nRight; rchildIndex++)
     {
-        const GtObjectMemento& rchild(right.childObjects[rchildIndex]);
-        rchildMap.insert(rchild.uuid(), rchildIndex);
-    }
+        int lchildIndex = rightToLeft[rchildIndex];
 
-    gt::for_each_key(rchildMap, [&](const QString& uuid)
-    {
-        if (!lchildMap.contains(uuid))
+        if (lchildIndex < 0 || expectedIndex[lchildIndex] == rchildIndex)
         {
-            return;
+            continue;
         }
 
-        int indexOld = lchildMap.value(uuid);
-        int indexNew = rchildMap.value(uuid);
-        int indexChange = 0;
-
-        if (indexChangeMap.contains(uuid))
-        {
-            indexChange = indexChangeMap.value(uuid);
-        }
-        int diff = indexNew - indexOld - indexChange;
+        diffObjectEmpty = false;
 
-        if (diff != 0)
-        {
-            diffObjectEmpty = false;
-            const GtObjectMemento& rchild (right.childObjects[indexNew]);
-            GtObjectIO oio;
-            QDomElement childElem = oio.toDomElement(rchild, *this, false);
-            handleIndexChanged(childElem, indexOld, indexNew, diffObj);
-        }
-    });
+        // only the identification of the child is stored
+        const GtObjectMemento& rchild (right.childObjects[rchildIndex]);
+        QDomElement childElem = this->createElement(gt::xml::S_OBJECT_TAG);
+        childElem.setAttribute(gt::xml::S_NAME_TAG, rchild.ident());
+        childElem.setAttribute(gt::xml::S_UUID_TAG, rchild.uuid());
+        childElem.setAttribute(gt::xml::S_CLASS_TAG, rchild.className());
+        handleIndexChanged(childElem, lchildIndex, rchildIndex, diffObj);
+    }
 
     if (!diffObjectEmpty)
     {
@@ -496,6 +483,86 @@ GtObjectMementoDiff::makeDiff(const GtObjectMemento& leftOrig,
     return true;
 }
 
+bool
+GtObjectMementoDiff::makeChildDiffs(
+    const GtObjectMemento& left,
+    const GtObjectMemento& right,
+    const std::vector<std::pair<int, int>>& modified,
+    QDomElement& diffRoot)
+{
+    using gt::detail::S_CONCURRENT_SUBTREE_SIZE;
+
+    int size = 0;
+    for (const auto& indices : modified)
+    {
+        if (size >= S_CONCURRENT_SUBTREE_SIZE) break;
+
+        size += gt::detail::countObjects(right.childObjects[indices.second],
+                                         S_CONCURRENT_SUBTREE_SIZE - size);
+    }
+
+    if (modified.size() < 2 || size < S_CONCURRENT_SUBTREE_SIZE)
+    {
+        for (const auto& indices : modified)
+        {
+            if (!makeDiff(left.childObjects[indices.first],
+                          right.childObjects[indices.second], diffRoot))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // The diffs of sibling subtrees are independent and are created
+    // concurrently in separate documents. The results are appended in order
+    // of the children, as if the diffs were created serially.
+    struct ChildDiff
+    {
+        std::pair<int, int> indices;
+        GtObjectMementoDiff diff{};
+        bool success{false};
+    };
+
+    std::vector<ChildDiff> childDiffs(modified.size());
+    for (size_t i = 0; i < modified.size(); ++i)
+    {
+        childDiffs[i].indices = modified[i];
+    }
+
+    QtConcurrent::blockingMap(childDiffs, [&](ChildDiff& child) {
+        QDomElement nullElem;
+        child.success = child.diff.makeDiff(
+                    left.childObjects[child.indices.first],
+                    right.childObjects[child.indices.second], nullElem);
+    });
+
+    for (ChildDiff& child : childDiffs)
+    {
+        QDomElement elem = child.diff.firstChildElement();
+        while (!elem.isNull())
+        {
+            QDomNode imported = this->importNode(elem, true);
+
+            if (diffRoot.isNull())
+            {
+                this->appendChild(imported);
+            }
+            else
+            {
+                diffRoot.appendChild(imported);
+            }
+
+            elem = elem.nextSiblingElement();
+        }
+
+        if (!child.success) return false;
+    }
+
+    return true;
+}
+
 void
 GtObjectMementoDiff::handleAttributeChange(const QString& name,
                                            const QString& leftVal,
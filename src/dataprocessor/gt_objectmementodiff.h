@@ -18,6 +18,9 @@
 #include <QHash>
 #include <QByteArray>
 
+#include <utility>
+#include <vector>
+
 class QDomElement;
 class GtObject;
 
@@ -39,8 +42,20 @@ public:
     GtObjectMementoDiff(const GtObjectMemento& left,
                         const GtObjectMemento& right);
 
+    /**
+     * @brief Reads the diff from a byte array. The data may either be XML
+     * (see toByteArray) or the binary format (see toBinary).
+     * @param byteArray Diff data
+     */
     explicit GtObjectMementoDiff(const QByteArray& byteArray);
 
+    /**
+     * @brief Returns the diff in a compact binary format. Intended for
+     * transient data. Use toByteArray for XML data.
+     * @return Binary diff data
+     */
+    QByteArray toBinary() const;
+
     /**
      * @brief Creates an empty diff.
      */
@@ -103,6 +118,21 @@ private:
      */
     bool makeDiff(const GtObjectMemento& left, const GtObjectMemento& right, QDomElement& diffRoot);
 
+    /**
+     * @brief Creates the diffs of the modified children. Large sibling
+     * subtrees are diffed concurrently.
+     * @param left Left parent memento
+     * @param right Right parent memento
+     * @param modified Pairs of left and right child indices of the modified
+     * children
+     * @param diffRoot Diff root
+     * @return Success
+     */
+    bool makeChildDiffs(const GtObjectMemento& left,
+                        const GtObjectMemento& right,
+                        const std::vector<std::pair<int, int>>& modified,
+                        QDomElement& diffRoot);
+
     /**
      * @brief handleAttributeChange
      */
@@ -59,7 +59,7 @@ GtObjectModel::rowCount(const QModelIndex& parent) const
         return 0;
     }
 
-    return parentItem->findDirectChildren<GtObject*>().size();
+    return parentItem->childCount<GtObject*>();
 }
 
 QModelIndex
@@ -87,8 +87,7 @@ GtObjectModel::index(int row, int col, const QModelIndex& parent) const
         return {};
     }
 
-    GtObject* childItem =
-        parentItem->findDirectChildren<GtObject*>().value(row);
+    GtObject* childItem = parentItem->childAt(row);
 
     if (!childItem)
     {
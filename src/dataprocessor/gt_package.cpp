@@ -13,6 +13,9 @@
 #include "gt_objectfactory.h"
 #include "gt_logging.h"
 
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
+
 GtPackage::GtPackage()
 {
     setObjectName("Package");
@@ -24,36 +27,7 @@ GtPackage::readData(const QDomElement& root)
     QDomElement oe = root.firstChildElement("object");
     while (!oe.isNull())
     {
-        GtObjectMemento memento(oe);
-
-        if (!memento.isNull())
-        {
-            // default object
-            GtObject* dobj = findDirectChild<GtObject*>(memento.ident());
-
-            if (dobj)
-            {
-                // TODO: warning for unknown data element
-                //gtDebug() << tr("default object found!") << " ("
-                //          << dobj->objectName() << ") " << tr("restoring...");
-                dobj->setFactory(gtObjectFactory);
-                dobj->fromMemento(memento);
-            }
-            else
-            {
-                GtObject* cobj = memento.restore(gtObjectFactory);
-
-                if (cobj)
-                {
-                    appendChild(cobj);
-                }
-                else
-                {
-                    gtWarning() << tr("unknown data element skipped!")
-                                << "(" << memento.className() << ")";
-                }
-            }
-        }
+        restoreChild(GtObjectMemento(oe));
 
         oe = oe.nextSiblingElement("object");
     }
@@ -82,3 +56,70 @@ bool GtPackage::saveMiscData(const QDir &projectDir)
 {
     return true;
 }
+
+bool
+GtPackage::supportsStreamIO() const
+{
+    return false;
+}
+
+bool
+GtPackage::readStreamData(QXmlStreamReader& reader)
+{
+    while (reader.readNextStartElement())
+    {
+        if (reader.name() != QLatin1String("object"))
+        {
+            reader.skipCurrentElement();
+            continue;
+        }
+
+        // only a single child memento is held in memory
+        restoreChild(GtObjectMemento(reader));
+    }
+
+    return !reader.hasError();
+}
+
+bool
+GtPackage::saveStreamData(QXmlStreamWriter& writer)
+{
+    foreach (GtObject* obj, findDirectChildren<GtObject*>())
+    {
+        obj->toMemento().writeToStream(writer);
+    }
+
+    return !writer.hasError();
+}
+
+void
+GtPackage::restoreChild(const GtObjectMemento& memento)
+{
+    if (memento.isNull())
+    {
+        return;
+    }
+
+    // default object
+    GtObject* dobj = findDirectChild<GtObject*>(memento.ident());
+
+    if (dobj)
+    {
+        dobj->setFactory(gtObjectFactory);
+        dobj->fromMemento(memento);
+    }
+    else
+    {
+        GtObject* cobj = memento.restore(gtObjectFactory);
+
+        if (cobj)
+        {
+            appendChild(cobj);
+        }
+        else
+        {
+            gtWarning() << tr("unknown data element skipped!")
+                        << "(" << memento.className() << ")";
+        }
+    }
+}
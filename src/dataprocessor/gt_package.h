@@ -18,6 +18,9 @@
 class QDomElement;
 class QDomDocument;
 class QDir;
+class QXmlStreamReader;
+class QXmlStreamWriter;
+class GtObjectMemento;
 
 /**
  * @brief The GtPackage class
@@ -59,12 +62,60 @@ public:
      */
     virtual bool saveMiscData(const QDir& projectDir);
 
+    /**
+     * @brief Returns whether the package data is read and saved using the
+     * stream based methods readStreamData and saveStreamData instead of
+     * readData and saveData. This avoids holding the complete module file
+     * as dom document in memory.
+     *
+     * Packages that do not implement a custom data format should reimplement
+     * this method and return true.
+     *
+     * The data methods of the package (readData, saveData, readStreamData,
+     * saveStreamData, readMiscData and saveMiscData) are always called from
+     * the thread owning the package. Only the module files are read and
+     * written concurrently, thus these methods are not required to be thread
+     * safe.
+     *
+     * @return Whether the stream based methods are used
+     */
+    virtual bool supportsStreamIO() const;
+
+    /**
+     * @brief Module specific data read method using a stream reader.
+     *
+     * The reader is positioned at the root element of the module file and
+     * must be positioned at its end afterwards. The default implementation
+     * restores all object elements one after another.
+     *
+     * @return Returns true if data was successfully read.
+     */
+    virtual bool readStreamData(QXmlStreamReader& reader);
+
+    /**
+     * @brief Module specific data save method using a stream writer.
+     *
+     * The root element of the module file is already written. The default
+     * implementation writes all child objects one after another.
+     *
+     * @return Returns true if data was successfully saved.
+     */
+    virtual bool saveStreamData(QXmlStreamWriter& writer);
+
 protected:
     /**
      * @brief GtPackage
      */
     GtPackage();
 
+private:
+    /**
+     * @brief Restores the memento as child object. Merges the memento into
+     * the existing child object of the same name, if available.
+     * @param memento Memento of the child object
+     */
+    void restoreChild(const GtObjectMemento& memento);
+
 };
 
 #endif // GTPACKAGE_H
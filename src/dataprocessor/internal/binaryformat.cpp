@@ -0,0 +1,544 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "binaryformat.h"
+
+#include "gt_objectmemento.h"
+#include "gt_objectio.h"
+#include "gt_logging.h"
+
+#include <QBuffer>
+#include <QDataStream>
+#include <QDomDocument>
+#include <QHash>
+#include <QPointF>
+#include <QSysInfo>
+#include <QVector>
+
+#include <algorithm>
+
+namespace
+{
+
+using PD = GtObjectMemento::PropertyData;
+
+constexpr char S_MEMENTO_MAGIC[] = "GTMB";
+constexpr char S_DOCUMENT_MAGIC[] = "GTDB";
+constexpr int S_MAGIC_SIZE = 4;
+
+/// marks a string, which is not yet part of the string table
+constexpr quint32 S_NEW_STRING = 0xffffffff;
+
+/// tags of the encoded values
+enum ValueTag : quint8
+{
+    NullValue = 0,
+    /// builtin core type, stored using QDataStream
+    CoreValue,
+    DoubleVector,
+    IntList,
+    BoolList,
+    PointFList,
+    /// any other type, stored as string similar to the XML format
+    TextValue
+};
+
+/// tags of the encoded dom nodes
+enum NodeTag : quint8
+{
+    ElementNode = 0,
+    TextNode
+};
+
+constexpr bool isLittleEndianHost()
+{
+    return QSysInfo::ByteOrder == QSysInfo::LittleEndian;
+}
+
+void
+setupStream(QDataStream& stream)
+{
+    stream.setVersion(QDataStream::Qt_5_12);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream.setFloatingPointPrecision(QDataStream::DoublePrecision);
+}
+
+bool
+hasMagic(const QByteArray& data, const char* magic)
+{
+    return data.size() >= S_MAGIC_SIZE + int(sizeof(quint16)) &&
+           std::equal(magic, magic + S_MAGIC_SIZE, data.constData());
+}
+
+class Writer
+{
+public:
+    Writer(QByteArray& data, const char* magic) :
+        m_buffer(&data)
+    {
+        m_buffer.open(QIODevice::WriteOnly);
+        m_stream.setDevice(&m_buffer);
+        setupStream(m_stream);
+
+        m_stream.writeRawData(magic, S_MAGIC_SIZE);
+        m_stream << gt::detail::binary::S_FORMAT_VERSION;
+    }
+
+    void writeMemento(const GtObjectMemento& memento)
+    {
+        writeName(memento.className());
+        m_stream << memento.uuid() << memento.ident();
+
+        writeProperties(memento.properties);
+        writeProperties(memento.propertyContainers);
+
+        m_stream << quint32(memento.childObjects.size());
+        for (const GtObjectMemento& child : memento.childObjects)
+        {
+            writeMemento(child);
+        }
+    }
+
+    void writeNodes(const QDomNode& parent)
+    {
+        QVector<QDomNode> nodes;
+        for (QDomNode n = parent.firstChild(); !n.isNull(); n = n.nextSibling())
+        {
+            if (n.isElement() || n.isText()) nodes.push_back(n);
+        }
+
+        m_stream << quint32(nodes.size());
+        for (const QDomNode& n : qAsConst(nodes))
+        {
+            if (n.isText())
+            {
+                m_stream << quint8(TextNode) << n.nodeValue();
+                continue;
+            }
+
+            QDomElement e = n.toElement();
+            m_stream << quint8(ElementNode);
+            writeName(e.tagName());
+
+            QDomNamedNodeMap attributes = e.attributes();
+            m_stream << quint32(attributes.size());
+            for (int i = 0; i < attributes.size(); ++i)
+            {
+                QDomAttr attr = attributes.item(i).toAttr();
+                writeName(attr.name());
+                m_stream << attr.value();
+            }
+
+            writeNodes(e);
+        }
+    }
+
+private:
+    QBuffer m_buffer;
+    QDataStream m_stream;
+
+    /// interned names
+    QHash<QString, quint32> m_names;
+
+    void writeName(const QString& name)
+    {
+        auto iter = m_names.constFind(name);
+        if (iter != m_names.constEnd())
+        {
+            m_stream << *iter;
+            return;
+        }
+
+        m_names.insert(name, quint32(m_names.size()));
+        m_stream << S_NEW_STRING << name;
+    }
+
+    void writeProperties(const QVector<PD>& properties)
+    {
+        m_stream << quint32(properties.size());
+        for (const PD& p : properties)
+        {
+            writeName(p.name);
+            m_stream << p.isActive << quint8(p.type());
+            writeName(p.dataType());
+            writeValue(p.data());
+            writeProperties(p.childProperties);
+        }
+    }
+
+    template <typename List>
+    void writeList(ValueTag tag, const List& list)
+    {
+        m_stream << quint8(tag) << quint32(list.size());
+        for (const auto& v : list) m_stream << v;
+    }
+
+    void writeValue(const QVariant& var)
+    {
+        int const type = var.userType();
+
+        if (!var.isValid())
+        {
+            m_stream << quint8(NullValue);
+        }
+        else if (type == qMetaTypeId<QVector<double>>())
+        {
+            auto const values = var.value<QVector<double>>();
+            m_stream << quint8(DoubleVector) << quint32(values.size());
+
+            if (isLittleEndianHost())
+            {
+                m_stream.writeRawData(
+                    reinterpret_cast<const char*>(values.constData()),
+                    values.size() * int(sizeof(double)));
+            }
+            else
+            {
+                for (double v : values) m_stream << v;
+            }
+        }
+        else if (type == qMetaTypeId<QList<int>>())
+        {
+            writeList(IntList, var.value<QList<int>>());
+        }
+        else if (type == qMetaTypeId<QList<bool>>())
+        {
+            writeList(BoolList, var.value<QList<bool>>());
+        }
+        else if (type == qMetaTypeId<QList<QPointF>>())
+        {
+            writeList(PointFList, var.value<QList<QPointF>>());
+        }
+        else if (type <= QMetaType::LastCoreType)
+        {
+            m_stream << quint8(CoreValue) << var;
+        }
+        else
+        {
+            m_stream << quint8(TextValue);
+            writeName(var.typeName());
+            m_stream << GtObjectIO::variantToString(var);
+        }
+    }
+};
+
+class Reader
+{
+public:
+    explicit Reader(const QByteArray& data) :
+        m_stream(data)
+    {
+        setupStream(m_stream);
+        m_stream.skipRawData(S_MAGIC_SIZE);
+
+        quint16 version = 0;
+        m_stream >> version;
+
+        if (version > gt::detail::binary::S_FORMAT_VERSION)
+        {
+            gtWarning() << QObject::tr("Unsupported version of the binary "
+                                       "format (%1)!").arg(version);
+            m_stream.setStatus(QDataStream::ReadCorruptData);
+        }
+    }
+
+    bool ok() const { return m_stream.status() == QDataStream::Ok; }
+
+    bool readMemento(GtObjectMemento& memento)
+    {
+        QString uuid, ident;
+
+        memento.setClassName(readName());
+        m_stream >> uuid >> ident;
+        memento.setUuid(uuid);
+        memento.setIdent(ident);
+
+        if (!readProperties(memento.properties) ||
+            !readProperties(memento.propertyContainers))
+        {
+            return false;
+        }
+
+        quint32 nChildren = readCount();
+        memento.childObjects.reserve(int(nChildren));
+        for (quint32 i = 0; i < nChildren && ok(); ++i)
+        {
+            GtObjectMemento child;
+            if (!readMemento(child)) return false;
+            memento.childObjects.push_back(std::move(child));
+        }
+
+        return ok();
+    }
+
+    bool readNodes(QDomDocument& doc, QDomNode& parent)
+    {
+        quint32 nNodes = readCount();
+        for (quint32 i = 0; i < nNodes && ok(); ++i)
+        {
+            quint8 tag = 0;
+            m_stream >> tag;
+
+            if (tag == TextNode)
+            {
+                QString text;
+                m_stream >> text;
+                parent.appendChild(doc.createTextNode(text));
+                continue;
+            }
+
+            if (tag != ElementNode)
+            {
+                m_stream.setStatus(QDataStream::ReadCorruptData);
+                return false;
+            }
+
+            QDomElement e = doc.createElement(readName());
+
+            quint32 nAttributes = readCount();
+            for (quint32 j = 0; j < nAttributes && ok(); ++j)
+            {
+                QString name = readName();
+                QString value;
+                m_stream >> value;
+                e.setAttribute(name, value);
+            }
+
+            parent.appendChild(e);
+
+            if (!readNodes(doc, e)) return false;
+        }
+
+        return ok();
+    }
+
+private:
+    QDataStream m_stream;
+
+    /// interned names
+    QVector<QString> m_names;
+
+    /// reads a count and checks it against the remaining data to avoid
+    /// huge allocations for corrupt data
+    quint32 readCount()
+    {
+        quint32 count = 0;
+        m_stream >> count;
+
+        if (m_stream.device() &&
+            count > quint64(m_stream.device()->bytesAvailable()))
+        {
+            m_stream.setStatus(QDataStream::ReadCorruptData);
+            return 0;
+        }
+
+        return count;
+    }
+
+    QString readName()
+    {
+        quint32 index = 0;
+        m_stream >> index;
+
+        if (index == S_NEW_STRING)
+        {
+            QString name;
+            m_stream >> name;
+            m_names.push_back(name);
+            return name;
+        }
+
+        if (index >= quint32(m_names.size()))
+        {
+            m_stream.setStatus(QDataStream::ReadCorruptData);
+            return {};
+        }
+
+        return m_names.at(int(index));
+    }
+
+    bool readProperties(QVector<PD>& properties)
+    {
+        quint32 nProperties = readCount();
+        properties.reserve(int(nProperties));
+
+        for (quint32 i = 0; i < nProperties && ok(); ++i)
+        {
+            PD p;
+            p.name = readName();
+
+            quint8 type = 0;
+            m_stream >> p.isActive >> type;
+            QString dataType = readName();
+            QVariant value = readValue();
+
+            if (type == PD::STRUCT_T)
+            {
+                p.toStruct(dataType);
+            }
+            else
+            {
+                // enums are restored as string like in the XML format
+                p.setData(value);
+            }
+
+            if (!readProperties(p.childProperties)) return false;
+
+            properties.push_back(std::move(p));
+        }
+
+        return ok();
+    }
+
+    template <typename List>
+    QVariant readList()
+    {
+        List list;
+        quint32 n = readCount();
+        list.reserve(int(n));
+
+        for (quint32 i = 0; i < n && ok(); ++i)
+        {
+            typename List::value_type v;
+            m_stream >> v;
+            list.push_back(v);
+        }
+
+        return QVariant::fromValue(list);
+    }
+
+    QVariant readValue()
+    {
+        quint8 tag = 0;
+        m_stream >> tag;
+
+        switch (tag)
+        {
+        case NullValue:
+            return {};
+        case CoreValue:
+        {
+            QVariant var;
+            m_stream >> var;
+            return var;
+        }
+        case DoubleVector:
+        {
+            quint32 n = readCount();
+            QVector<double> values(int(n));
+
+            if (isLittleEndianHost())
+            {
+                int size = int(n) * int(sizeof(double));
+                if (m_stream.readRawData(
+                        reinterpret_cast<char*>(values.data()), size) != size)
+                {
+                    m_stream.setStatus(QDataStream::ReadPastEnd);
+                }
+            }
+            else
+            {
+                for (double& v : values) m_stream >> v;
+            }
+
+            return QVariant::fromValue(values);
+        }
+        case IntList:
+            return readList<QList<int>>();
+        case BoolList:
+            return readList<QList<bool>>();
+        case PointFList:
+            return readList<QList<QPointF>>();
+        case TextValue:
+        {
+            QString typeName = readName();
+            QString text;
+            m_stream >> text;
+
+            QVariant var(text);
+            QVariant::Type type = QVariant::nameToType(
+                        typeName.toLatin1().constData());
+            if (type != QVariant::Invalid) var.convert(type);
+            return var;
+        }
+        default:
+            m_stream.setStatus(QDataStream::ReadCorruptData);
+            return {};
+        }
+    }
+};
+
+} // namespace
+
+bool
+gt::detail::binary::isMemento(const QByteArray& data)
+{
+    return hasMagic(data, S_MEMENTO_MAGIC);
+}
+
+QByteArray
+gt::detail::binary::write(const GtObjectMemento& memento)
+{
+    QByteArray data;
+    {
+        Writer writer(data, S_MEMENTO_MAGIC);
+        writer.writeMemento(memento);
+    }
+    return data;
+}
+
+bool
+gt::detail::binary::read(const QByteArray& data, GtObjectMemento& memento)
+{
+    if (!isMemento(data)) return false;
+
+    Reader reader(data);
+    if (!reader.ok()) return false;
+
+    GtObjectMemento tmp;
+    if (!reader.readMemento(tmp))
+    {
+        gtWarning() << QObject::tr("Failed to read binary memento data!");
+        return false;
+    }
+
+    memento = std::move(tmp);
+    return true;
+}
+
+bool
+gt::detail::binary::isDocument(const QByteArray& data)
+{
+    return hasMagic(data, S_DOCUMENT_MAGIC);
+}
+
+QByteArray
+gt::detail::binary::write(const QDomDocument& doc)
+{
+    QByteArray data;
+    {
+        Writer writer(data, S_DOCUMENT_MAGIC);
+        writer.writeNodes(doc);
+    }
+    return data;
+}
+
+bool
+gt::detail::binary::read(const QByteArray& data, QDomDocument& doc)
+{
+    if (!isDocument(data)) return false;
+
+    Reader reader(data);
+    if (!reader.ok()) return false;
+
+    if (!reader.readNodes(doc, doc))
+    {
+        gtWarning() << QObject::tr("Failed to read binary document data!");
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,89 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef GT_INTERNAL_BINARYFORMAT_H
+#define GT_INTERNAL_BINARYFORMAT_H
+
+#include "gt_datamodel_exports.h"
+
+#include <QByteArray>
+
+class QDomDocument;
+class GtObjectMemento;
+
+namespace gt
+{
+    namespace detail
+    {
+
+        /**
+         * @brief Compact binary encoding of mementos and memento diffs.
+         *
+         * The encoding starts with a magic number and a format version.
+         * Values are stored typed (double arrays as raw data) and class,
+         * property and tag names are interned. It is intended for transient
+         * data (clipboard, process runner). Project files are still stored
+         * as XML.
+         */
+        namespace binary
+        {
+
+            /// current version of the binary format
+            constexpr quint16 S_FORMAT_VERSION = 1;
+
+            /**
+             * @brief Returns whether the data is a binary encoded memento
+             * @param data Data
+             * @return Whether the data starts with the memento magic number
+             */
+            GT_DATAMODEL_EXPORT bool isMemento(const QByteArray& data);
+
+            /**
+             * @brief Encodes the memento including all children
+             * @param memento Memento
+             * @return Encoded data
+             */
+            GT_DATAMODEL_EXPORT QByteArray write(const GtObjectMemento& memento);
+
+            /**
+             * @brief Decodes a memento
+             * @param data Encoded data
+             * @param memento Decoded memento (output)
+             * @return Success
+             */
+            GT_DATAMODEL_EXPORT bool read(const QByteArray& data,
+                                          GtObjectMemento& memento);
+
+            /**
+             * @brief Returns whether the data is a binary encoded document
+             * @param data Data
+             * @return Whether the data starts with the document magic number
+             */
+            GT_DATAMODEL_EXPORT bool isDocument(const QByteArray& data);
+
+            /**
+             * @brief Encodes the elements and text nodes of a dom document
+             * @param doc Document
+             * @return Encoded data
+             */
+            GT_DATAMODEL_EXPORT QByteArray write(const QDomDocument& doc);
+
+            /**
+             * @brief Decodes a dom document. The nodes are appended to the
+             * document.
+             * @param data Encoded data
+             * @param doc Document (output)
+             * @return Success
+             */
+            GT_DATAMODEL_EXPORT bool read(const QByteArray& data,
+                                          QDomDocument& doc);
+
+        } // namespace binary
+
+    } // namespace detail
+} // namespace gt
+
+#endif // GT_INTERNAL_BINARYFORMAT_H
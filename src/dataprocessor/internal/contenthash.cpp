@@ -0,0 +1,214 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "contenthash.h"
+
+#include "gt_object.h"
+
+#include <cstring>
+
+namespace
+{
+
+// XXH64, see https://github.com/Cyan4973/xxHash (BSD-2-Clause)
+constexpr uint64_t P1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t P2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t P3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t P4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t P5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t
+rotl(uint64_t x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t
+read64(const unsigned char* p)
+{
+    // little endian independent of the platform
+    uint64_t v = 0;
+    for (int i = 7; i >= 0; --i) v = (v << 8) | p[i];
+    return v;
+}
+
+inline uint32_t
+read32(const unsigned char* p)
+{
+    return uint32_t(p[0]) | (uint32_t(p[1]) << 8) |
+           (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+}
+
+inline uint64_t
+xxRound(uint64_t acc, uint64_t input)
+{
+    acc += input * P2;
+    acc = rotl(acc, 31);
+    return acc * P1;
+}
+
+inline uint64_t
+mergeRound(uint64_t acc, uint64_t val)
+{
+    acc ^= xxRound(0, val);
+    return acc * P1 + P4;
+}
+
+} // namespace
+
+namespace gt
+{
+    namespace detail
+    {
+
+        ContentHash::ContentHash(HashAlgorithm algorithm) :
+            m_algorithm(algorithm)
+        {
+            if (m_algorithm == HashAlgorithm::Sha256)
+            {
+                m_sha = std::make_unique<QCryptographicHash>(
+                            QCryptographicHash::Sha256);
+            }
+
+            reset();
+        }
+
+        void ContentHash::addData(const char* data, int length)
+        {
+            if (m_algorithm == HashAlgorithm::Sha256)
+            {
+                m_sha->addData(data, length);
+                return;
+            }
+
+            if (length <= 0) return;
+
+            auto const* p = reinterpret_cast<const unsigned char*>(data);
+            auto const* end = p + length;
+
+            m_total += length;
+
+            // fill the buffer of the previous call first
+            if (m_bufferSize + length < 32)
+            {
+                std::memcpy(m_buffer + m_bufferSize, p, length);
+                m_bufferSize += length;
+                return;
+            }
+
+            if (m_bufferSize > 0)
+            {
+                int fill = 32 - m_bufferSize;
+                std::memcpy(m_buffer + m_bufferSize, p, fill);
+                p += fill;
+
+                for (int i = 0; i < 4; ++i)
+                {
+                    m_acc[i] = xxRound(m_acc[i], read64(m_buffer + i * 8));
+                }
+                m_bufferSize = 0;
+            }
+
+            for (; p + 32 <= end; p += 32)
+            {
+                for (int i = 0; i < 4; ++i)
+                {
+                    m_acc[i] = xxRound(m_acc[i], read64(p + i * 8));
+                }
+            }
+
+            if (p < end)
+            {
+                m_bufferSize = static_cast<int>(end - p);
+                std::memcpy(m_buffer, p, m_bufferSize);
+            }
+        }
+
+        void ContentHash::addData(const QByteArray& data)
+        {
+            addData(data.constData(), data.size());
+        }
+
+        QByteArray ContentHash::result() const
+        {
+            if (m_algorithm == HashAlgorithm::Sha256)
+            {
+                return m_sha->result();
+            }
+
+            uint64_t h;
+
+            if (m_total >= 32)
+            {
+                h = rotl(m_acc[0], 1) + rotl(m_acc[1], 7) +
+                    rotl(m_acc[2], 12) + rotl(m_acc[3], 18);
+
+                for (int i = 0; i < 4; ++i)
+                {
+                    h = mergeRound(h, m_acc[i]);
+                }
+            }
+            else
+            {
+                // seed 0
+                h = P5;
+            }
+
+            h += m_total;
+
+            const unsigned char* p = m_buffer;
+            const unsigned char* end = m_buffer + m_bufferSize;
+
+            for (; p + 8 <= end; p += 8)
+            {
+                h ^= xxRound(0, read64(p));
+                h = rotl(h, 27) * P1 + P4;
+            }
+
+            if (p + 4 <= end)
+            {
+                h ^= uint64_t(read32(p)) * P1;
+                h = rotl(h, 23) * P2 + P3;
+                p += 4;
+            }
+
+            for (; p < end; ++p)
+            {
+                h ^= (*p) * P5;
+                h = rotl(h, 11) * P1;
+            }
+
+            h ^= h >> 33;
+            h *= P2;
+            h ^= h >> 29;
+            h *= P3;
+            h ^= h >> 32;
+
+            // big endian, thus the hex representation matches the
+            // canonical representation of XXH64
+            QByteArray retval(8, Qt::Uninitialized);
+            for (int i = 7; i >= 0; --i)
+            {
+                retval[i] = static_cast<char>(h & 0xff);
+                h >>= 8;
+            }
+            return retval;
+        }
+
+        void ContentHash::reset()
+        {
+            if (m_sha) m_sha->reset();
+
+            m_acc[0] = P1 + P2;
+            m_acc[1] = P2;
+            m_acc[2] = 0;
+            m_acc[3] = 0 - P1;
+            m_total = 0;
+            m_bufferSize = 0;
+        }
+
+    } // namespace detail
+} // namespace gt
@@ -0,0 +1,60 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef GT_INTERNAL_CONTENTHASH_H
+#define GT_INTERNAL_CONTENTHASH_H
+
+#include "gt_datamodel_exports.h"
+
+#include <QByteArray>
+#include <QCryptographicHash>
+
+#include <cstdint>
+#include <memory>
+
+namespace gt
+{
+    enum class HashAlgorithm;
+
+    namespace detail
+    {
+
+        /**
+         * @brief Incremental hash used for the content hashes of objects.
+         * Either computes a fast non-cryptographic hash (XXH64) or SHA-256.
+         */
+        class ContentHash
+        {
+        public:
+            GT_DATAMODEL_EXPORT explicit ContentHash(HashAlgorithm algorithm);
+
+            GT_DATAMODEL_EXPORT void addData(const char* data, int length);
+
+            GT_DATAMODEL_EXPORT void addData(const QByteArray& data);
+
+            GT_DATAMODEL_EXPORT QByteArray result() const;
+
+            GT_DATAMODEL_EXPORT void reset();
+
+            HashAlgorithm algorithm() const { return m_algorithm; }
+
+        private:
+            HashAlgorithm m_algorithm;
+
+            /// only created for SHA-256
+            std::unique_ptr<QCryptographicHash> m_sha;
+
+            /// XXH64 state
+            uint64_t m_acc[4];
+            uint64_t m_total{0};
+            unsigned char m_buffer[32];
+            int m_bufferSize{0};
+        };
+
+    } // namespace detail
+} // namespace gt
+
+#endif // GT_INTERNAL_CONTENTHASH_H
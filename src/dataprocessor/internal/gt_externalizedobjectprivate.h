@@ -14,6 +14,7 @@
 #include "gt_boolproperty.h"
 #include "gt_stringproperty.h"
 #include "gt_variantproperty.h"
+#include "gt_externalizeddataselection.h"
 
 namespace gt
 {
@@ -85,6 +86,15 @@ struct GtExternalizedObjectPrivate
     /// keeps track of number of accesses
     int refCount{0};
 
+    /// keeps track of number of accesses to a selection of the data
+    int partialRefCount{0};
+
+    /// indicates whether only a selection of the data is fetched
+    bool partiallyFetched{false};
+
+    /// selection of the data that is partially fetched
+    GtExternalizedDataSelection selection{};
+
     /// object states
     ExternalizeStates states{ ExternalizeState::ExternalizeOnSave };
 
@@ -0,0 +1,46 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef GT_INTERNAL_SUBTREECONCURRENCY_H
+#define GT_INTERNAL_SUBTREECONCURRENCY_H
+
+#include "gt_objectmemento.h"
+
+namespace gt
+{
+    namespace detail
+    {
+
+        /// Minimum number of objects of sibling subtrees to process the
+        /// siblings concurrently. Smaller trees are processed serially, as
+        /// the overhead of the thread pool dominates.
+        constexpr int S_CONCURRENT_SUBTREE_SIZE = 256;
+
+        /**
+         * @brief Counts the objects of the memento including all children.
+         * Stops counting once the limit is reached.
+         * @param memento Memento
+         * @param limit Maximum number of objects to count
+         * @return Number of objects (at most limit)
+         */
+        inline int countObjects(const GtObjectMemento& memento, int limit)
+        {
+            int count = 1;
+
+            for (const GtObjectMemento& child : memento.childObjects)
+            {
+                if (count >= limit) break;
+
+                count += countObjects(child, limit - count);
+            }
+
+            return count;
+        }
+
+    } // namespace detail
+} // namespace gt
+
+#endif // GT_INTERNAL_SUBTREECONCURRENCY_H
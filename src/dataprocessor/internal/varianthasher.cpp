@@ -7,6 +7,7 @@
  */
 
 #include "varianthasher.h"
+#include "contenthash.h"
 
 namespace gt
 {
@@ -19,8 +20,8 @@ namespace gt
             buff.open(QIODevice::WriteOnly);
         }
 
-        void VariantHasher::addToHash(QCryptographicHash& hash,
-                                      const QVariant& variant)
+        template <typename Hash>
+        void VariantHasher::addToHashImpl(Hash& hash, const QVariant& variant)
         {
             static QVariant::Type type_QString =
                 QVariant::nameToType("QString");
@@ -50,6 +51,17 @@ namespace gt
             }
         }
 
+        void VariantHasher::addToHash(QCryptographicHash& hash,
+                                      const QVariant& variant)
+        {
+            addToHashImpl(hash, variant);
+        }
+
+        void VariantHasher::addToHash(ContentHash& hash,
+                                      const QVariant& variant)
+        {
+            addToHashImpl(hash, variant);
+        }
 
     } // namespace detail
 } // namespace gt
@@ -21,6 +21,8 @@ namespace gt
     namespace detail
     {
 
+        class ContentHash;
+
         /**
          * @brief Helper class to compute hashes from QVariants
          */
@@ -30,8 +32,13 @@ namespace gt
             GT_DATAMODEL_EXPORT VariantHasher();
             GT_DATAMODEL_EXPORT void addToHash(QCryptographicHash& hash,
                                                const QVariant& variant);
+            GT_DATAMODEL_EXPORT void addToHash(ContentHash& hash,
+                                               const QVariant& variant);
 
         private:
+            template <typename Hash>
+            void addToHashImpl(Hash& hash, const QVariant& variant);
+
             QByteArray bb;
             QBuffer buff;
             QDataStream ds;
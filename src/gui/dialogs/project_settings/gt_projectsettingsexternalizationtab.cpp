@@ -13,6 +13,8 @@
 
 #include <QLabel>
 #include <QCheckBox>
+#include <QFormLayout>
+#include <QSpinBox>
 #include <QVBoxLayout>
 #include <QSpacerItem>
 #include <QMessageBox>
@@ -99,13 +101,94 @@ GtProjectSettingsExternalizationTab::GtProjectSettingsExternalizationTab(
     layout()->addWidget(m_extCheckBox);
     layout()->addWidget(objectCountLabel);
     layout()->addWidget(warningLabel);
+    layout()->addLayout(initStorageLayoutWidgets(project));
     layout()->addItem(new QSpacerItem(1, 1, QSizePolicy::Minimum,
                                       QSizePolicy::Expanding));
 }
 
+QLayout*
+GtProjectSettingsExternalizationTab::initStorageLayoutWidgets(
+        GtProject* project)
+{
+    const QString group = QStringLiteral("ExternalizationSettings");
+
+    m_chunkedState = gtStateHandler->initializeState(project, group,
+                                    QStringLiteral("Chunked Layout"),
+                                    project->objectPath() + ";chunkedLayout",
+                                    false, project);
+    m_compressionState = gtStateHandler->initializeState(project, group,
+                                    QStringLiteral("Compression Level"),
+                                    project->objectPath() + ";compressionLevel",
+                                    0, project);
+    m_shuffleState = gtStateHandler->initializeState(project, group,
+                                    QStringLiteral("Shuffle Filter"),
+                                    project->objectPath() + ";shuffleFilter",
+                                    false, project);
+
+    m_chunkedCheckBox = new QCheckBox{tr("Store data in resizable chunks")};
+    m_chunkedCheckBox->setToolTip(tr("Chunked datasets are extended instead "
+                                     "of recreated if the size of the data "
+                                     "changes. Required for compression."));
+    m_chunkedCheckBox->setChecked(m_chunkedState->getValue().toBool());
+
+    m_compressionSpinBox = new QSpinBox;
+    m_compressionSpinBox->setRange(0, 9);
+    m_compressionSpinBox->setSpecialValueText(tr("None"));
+    m_compressionSpinBox->setToolTip(tr("Deflate compression level "
+                                        "(1: fastest, 9: smallest file)"));
+    m_compressionSpinBox->setValue(m_compressionState->getValue().toInt());
+
+    m_shuffleCheckBox = new QCheckBox{tr("Shuffle data before compressing")};
+    m_shuffleCheckBox->setToolTip(tr("Improves the compression ratio of "
+                                     "numeric data"));
+    m_shuffleCheckBox->setChecked(m_shuffleState->getValue().toBool());
+
+    const auto updateEnabled = [this](){
+        bool chunked = m_chunkedCheckBox->isChecked();
+        m_compressionSpinBox->setEnabled(chunked);
+        m_shuffleCheckBox->setEnabled(chunked &&
+                                      m_compressionSpinBox->value() > 0);
+    };
+    updateEnabled();
+
+    connect(m_chunkedCheckBox, &QCheckBox::toggled, this, updateEnabled);
+    connect(m_compressionSpinBox, qOverload<int>(&QSpinBox::valueChanged),
+            this, updateEnabled);
+
+    auto* formLayout = new QFormLayout;
+    formLayout->addRow(m_chunkedCheckBox);
+    formLayout->addRow(tr("Compression:"), m_compressionSpinBox);
+    formLayout->addRow(m_shuffleCheckBox);
+
+    return formLayout;
+}
+
+void
+GtProjectSettingsExternalizationTab::saveStorageLayoutSettings()
+{
+    bool chunked = m_chunkedCheckBox->isChecked();
+    int compression = chunked ? m_compressionSpinBox->value() : 0;
+    bool shuffle = compression > 0 && m_shuffleCheckBox->isChecked();
+
+    if (m_chunkedState->getValue().toBool() != chunked)
+    {
+        m_chunkedState->setValue(chunked);
+    }
+    if (m_compressionState->getValue().toInt() != compression)
+    {
+        m_compressionState->setValue(compression);
+    }
+    if (m_shuffleState->getValue().toBool() != shuffle)
+    {
+        m_shuffleState->setValue(shuffle);
+    }
+}
+
 void
 GtProjectSettingsExternalizationTab::saveSettings()
 {
+    saveStorageLayoutSettings();
+
     bool checked = m_extCheckBox->isChecked();
     // check if setting changed
     if (m_extState->getValue().toBool() == checked)
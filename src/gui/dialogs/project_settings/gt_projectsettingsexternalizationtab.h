@@ -16,6 +16,7 @@
 
 class GtState;
 class QCheckBox;
+class QSpinBox;
 /**
  * @brief The GtProjectSettingsExternalizationTab class
  */
@@ -50,6 +51,31 @@ private:
     QCheckBox* m_extCheckBox{};
     /// state for enabling externalization
     GtState* m_extState{};
+
+    /// checkbox for enabling the chunked layout of datasets
+    QCheckBox* m_chunkedCheckBox{};
+    /// state for enabling the chunked layout
+    GtState* m_chunkedState{};
+    /// spinbox for the compression level of datasets
+    QSpinBox* m_compressionSpinBox{};
+    /// state for the compression level
+    GtState* m_compressionState{};
+    /// checkbox for enabling the shuffle filter
+    QCheckBox* m_shuffleCheckBox{};
+    /// state for enabling the shuffle filter
+    GtState* m_shuffleState{};
+
+    /**
+     * @brief Initializes the widgets for the storage layout of the datasets
+     * @param project Project
+     * @return layout containing the widgets
+     */
+    QLayout* initStorageLayoutWidgets(GtProject* project);
+
+    /**
+     * @brief Stores the storage layout states
+     */
+    void saveStorageLayoutSettings();
 };
 
 #endif // GTPROJECTSETTINGSEXTERNALIZATIONTAB_H
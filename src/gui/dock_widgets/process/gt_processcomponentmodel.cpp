@@ -495,14 +495,8 @@ GtProcessComponentModel::dropMimeData(const QMimeData* mimeData,
         return false;
     }
 
-    // check mime data format
-    if (!mimeData->hasFormat(QStringLiteral("GtObject")))
-    {
-        return false;
-    }
-
     // restore memento from mime data
-    GtObjectMemento memento(mimeData->data(QStringLiteral("GtObject")));
+    GtObjectMemento memento = GtCoreDatamodel::mementoFromMimeData(mimeData);
 
     // check memento
     if (memento.isNull())
@@ -29,6 +29,7 @@
 #include "gt_icons.h"
 #include "gt_shortcuts.h"
 #include "gt_projectui.h"
+#include "internal/gt_startupprofiler.h"
 
 #include <QMessageBox>
 #include <QIcon>
@@ -109,6 +110,8 @@ GtApplication::initMdiLauncher()
 void
 GtApplication::loadModules()
 {
+    auto phase = gt::detail::startupPhase(QStringLiteral("load modules"));
+
     if (!m_moduleLoader)
     {
         m_guiModuleLoader = new GtGuiModuleLoader;
@@ -974,5 +977,8 @@ GtApplication::onGuiInitializationFinished()
 
     // update theme
     emit themeChanged(m_darkMode);
+
+    // the startup of the application is complete
+    gt::detail::StartupProfiler::instance().finish();
 }
 
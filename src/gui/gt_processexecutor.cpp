@@ -64,6 +64,12 @@ GtProcessExecutor::execute()
     }
 }
 
+bool
+GtProcessExecutor::supportsConcurrentExecution() const
+{
+    return false;
+}
+
 bool
 GtProcessExecutor::terminateCurrentTask()
 {
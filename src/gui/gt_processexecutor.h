@@ -52,6 +52,13 @@ protected:
      */
     bool terminateCurrentTask() override;
 
+    /**
+     * @brief Concurrent execution is not supported, as the loading helper
+     * merges a single task at a time.
+     * @return false
+     */
+    bool supportsConcurrentExecution() const override;
+
 private slots:
 
     /**
@@ -69,6 +69,12 @@ GtProcessRunner::connectionState() const
     return pimpl->transceiver->connectionState();
 }
 
+bool
+GtProcessRunner::supportsConcurrentExecution() const
+{
+    return false;
+}
+
 bool
 GtProcessRunner::terminateCurrentTask()
 {
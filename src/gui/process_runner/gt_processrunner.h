@@ -78,6 +78,13 @@ protected:
      */
     void execute() override;
 
+    /**
+     * @brief Concurrent execution is not supported, as the remote process
+     * runner executes a single task at a time.
+     * @return false
+     */
+    bool supportsConcurrentExecution() const override;
+
 private:
 
     /// private impl
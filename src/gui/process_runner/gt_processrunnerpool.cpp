@@ -0,0 +1,514 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gt_processrunnerpool.h"
+
+#include "gt_application.h"
+#include "gt_eventloop.h"
+#include "gt_exceptions.h"
+#include "gt_logging.h"
+#include "gt_processrunnerglobals.h"
+#include "gt_utilities.h"
+
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QLockFile>
+#include <QProcess>
+#include <QRandomGenerator>
+#include <QTimer>
+
+#include <algorithm>
+
+const int GtProcessRunnerPool::S_MAX_SESSIONS = 50;
+const int GtProcessRunnerPool::S_IDLE_TIMEOUT = 10 * 60;
+
+/// number of ports reserved for process runners
+static const int S_PORT_RANGE = 20;
+
+/// time to wait for a process runner to terminate
+static const int S_TERMINATE_TIMEOUT = 1000;
+
+GtProcessRunnerPool::GtProcessRunnerPool(QObject* parent) :
+    QObject(parent)
+{
+    setObjectName("ProcessRunnerPool");
+}
+
+GtProcessRunnerPool::~GtProcessRunnerPool()
+{
+    shutdown();
+}
+
+void
+GtProcessRunnerPool::setSize(int size)
+{
+    m_size = std::max(0, size);
+
+    // terminate idle process runners exceeding the size
+    int surplus = activeRunners() - m_size;
+
+    for (auto& runner : m_runners)
+    {
+        if (surplus <= 0) break;
+
+        if (!runner.stopping && !runner.busy)
+        {
+            stopRunner(runner);
+            surplus -= 1;
+        }
+    }
+}
+
+int
+GtProcessRunnerPool::size() const
+{
+    return m_size;
+}
+
+int
+GtProcessRunnerPool::activeRunners() const
+{
+    return static_cast<int>(std::count_if(m_runners.begin(), m_runners.end(),
+                                          [](Runner const& runner) {
+        return !runner.stopping;
+    }));
+}
+
+quint16
+GtProcessRunnerPool::acquire(int timeout, QString const& logFile)
+{
+    auto isIdle = [](Runner const& runner) {
+        return runner.ready && !runner.busy && !runner.stopping &&
+               runner.process &&
+               runner.process->state() == QProcess::Running;
+    };
+    auto isStarting = [](Runner const& runner) {
+        return !runner.ready && !runner.stopping && runner.process;
+    };
+
+    recycleOutdatedRunners();
+    warmUp();
+
+    auto iter = std::find_if(m_runners.begin(), m_runners.end(), isIdle);
+
+    // wait for a process runner that is still starting up
+    if (iter == m_runners.end() &&
+        std::any_of(m_runners.begin(), m_runners.end(), isStarting))
+    {
+        gtDebugId(GT_EXEC_ID) << tr("Waiting for Process Runner to start...");
+
+        GtEventLoop loop{timeout};
+        loop.connectSuccess(this, &GtProcessRunnerPool::runnerReady);
+        loop.exec();
+
+        iter = std::find_if(m_runners.begin(), m_runners.end(), isIdle);
+    }
+
+    if (iter == m_runners.end())
+    {
+        return 0;
+    }
+
+    iter->busy = true;
+    beginSessionLog(*iter, logFile);
+
+    return iter->port;
+}
+
+void
+GtProcessRunnerPool::release(quint16 port, bool healthy)
+{
+    auto iter = std::find_if(m_runners.begin(), m_runners.end(),
+                             [port](Runner const& runner) {
+        return runner.port == port;
+    });
+
+    if (iter == m_runners.end()) return;
+
+    endSessionLog(*iter);
+
+    iter->busy = false;
+    iter->sessions += 1;
+
+    if (!healthy)
+    {
+        gtDebugId(GT_EXEC_ID)
+                << tr("Replacing Process Runner on port %1...").arg(port);
+        stopRunner(*iter);
+        return warmUp();
+    }
+
+    if (iter->sessions >= S_MAX_SESSIONS)
+    {
+        gtDebugId(GT_EXEC_ID)
+                << tr("Recycling Process Runner on port %1...").arg(port);
+        stopRunner(*iter);
+        return warmUp();
+    }
+
+    // pool size may have changed
+    if (activeRunners() > m_size)
+    {
+        stopRunner(*iter);
+    }
+}
+
+void
+GtProcessRunnerPool::warmUp()
+{
+    while (activeRunners() < m_size)
+    {
+        if (!startRunner()) return;
+    }
+}
+
+void
+GtProcessRunnerPool::shutdown()
+{
+    // move runners, no new runners should be started
+    auto runners = std::move(m_runners);
+    m_runners.clear();
+
+    for (auto& runner : runners)
+    {
+        QProcess* process = runner.process;
+        if (!process) continue;
+
+        disconnect(process, nullptr, this, nullptr);
+
+        process->terminate();
+        if (!process->waitForFinished(S_TERMINATE_TIMEOUT))
+        {
+            process->kill();
+            process->waitForFinished(S_TERMINATE_TIMEOUT);
+        }
+
+        delete process;
+    }
+}
+
+bool
+GtProcessRunnerPool::startRunner()
+{
+    QList<quint16> reserved;
+    for (auto const& runner : m_runners)
+    {
+        reserved.append(runner.port);
+    }
+
+    quint16 port{};
+    try
+    {
+        port = reservePort(reserved);
+    }
+    catch (GTlabException const& /*e*/)
+    {
+        return false;
+    }
+
+    QProcess* process = createProcess(port);
+    process->setParent(this);
+    process->setProcessChannelMode(QProcess::MergedChannels);
+
+    // the output is forwarded to the log file to detect when the process
+    // runner is ready
+    QDir tempDir = gtApp ? gtApp->applicationTempDir() : QDir::temp();
+    auto* logfile = new QFile(tempDir.absoluteFilePath(
+                                  QStringLiteral("process_runner_%1.log")
+                                      .arg(port)), process);
+    logfile->open(QIODevice::WriteOnly | QIODevice::Truncate);
+
+    connect(process, &QProcess::readyReadStandardOutput,
+            this, [this, process, logfile]() {
+        while (process->canReadLine())
+        {
+            QByteArray line = process->readLine();
+            logfile->write(line);
+
+            auto iter = find(process);
+            if (iter != m_runners.end() && iter->sessionLog)
+            {
+                iter->sessionLog->write(line);
+                iter->sessionLog->flush();
+            }
+
+            if (iter != m_runners.end() && !iter->ready &&
+                line.startsWith(gt::process_runner::S_READY_MESSAGE.toUtf8()))
+            {
+                iter->ready = true;
+
+                gtDebugId(GT_EXEC_ID)
+                        << tr("Process Runner on port %1 is ready")
+                               .arg(iter->port);
+                emit runnerReady();
+            }
+        }
+        logfile->flush();
+    });
+
+    connect(process, qOverload<int, QProcess::ExitStatus>(&QProcess::finished),
+            this, [this, process]() {
+        onRunnerExited(process);
+    });
+    connect(process, &QProcess::errorOccurred,
+            this, [this, process](QProcess::ProcessError error) {
+        if (error == QProcess::FailedToStart)
+        {
+            gtErrorId(GT_EXEC_ID)
+                    << tr("Failed to start the Process Runner!")
+                    << tr("Error:") << process->errorString();
+            onRunnerExited(process);
+        }
+    });
+
+    gtDebugId(GT_EXEC_ID)
+            << tr("Starting Process Runner on port %1...").arg(port)
+            << tr("Logfile is located at %1").arg(logfile->fileName());
+
+    Runner runner;
+    runner.process = process;
+    runner.port = port;
+    runner.log = logfile;
+    // the process runner inherits the current environment
+    if (process->processEnvironment().isEmpty())
+    {
+        runner.environment = QProcessEnvironment::systemEnvironment();
+    }
+    m_runners.push_back(runner);
+
+    process->start();
+
+    // process runner may have failed to start already
+    return find(process) != m_runners.end();
+}
+
+quint16
+GtProcessRunnerPool::reservePort(QList<quint16> const& reserved)
+    noexcept(false)
+{
+    return findAvailablePort(reserved);
+}
+
+QProcess*
+GtProcessRunnerPool::createProcess(quint16 port)
+{
+    QStringList args{
+        QStringLiteral("process_runner"),
+        QStringLiteral("--port=%1").arg(port),
+        QStringLiteral("--timeout=%1").arg(S_IDLE_TIMEOUT),
+        QStringLiteral("--persistent")
+    };
+    // append dev mode
+    if (gtApp->devMode())
+    {
+        args << QStringLiteral("--dev");
+    }
+
+    auto* process = new QProcess;
+
+    QDir appDir = qApp->applicationDirPath();
+    process->setProgram(appDir.absoluteFilePath(QStringLiteral("GTlabConsole")));
+    process->setArguments(args);
+
+    return process;
+}
+
+void
+GtProcessRunnerPool::stopRunner(Runner& runner)
+{
+    // the process runner no longer counts against the pool size
+    runner.stopping = true;
+
+    QProcess* process = runner.process;
+    if (!process) return;
+
+    // the process runner is removed once it exited
+    process->terminate();
+
+    // terminate has no effect on console applications on Windows
+    QTimer::singleShot(S_TERMINATE_TIMEOUT, process, [process]() {
+        if (process->state() != QProcess::NotRunning) process->kill();
+    });
+}
+
+void
+GtProcessRunnerPool::recycleOutdatedRunners()
+{
+    QProcessEnvironment environment = QProcessEnvironment::systemEnvironment();
+
+    for (auto& runner : m_runners)
+    {
+        if (runner.busy || runner.stopping || runner.environment.isEmpty() ||
+            runner.environment == environment)
+        {
+            continue;
+        }
+
+        gtDebugId(GT_EXEC_ID)
+                << tr("Environment changed, recycling Process Runner on "
+                      "port %1...").arg(runner.port);
+        stopRunner(runner);
+    }
+}
+
+void
+GtProcessRunnerPool::beginSessionLog(Runner& runner, QString const& logFile)
+{
+    QString date = QDateTime::currentDateTime().toString(Qt::ISODate);
+
+    if (!logFile.isEmpty())
+    {
+        auto* log = new QFile(logFile, runner.process);
+        if (log->open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            runner.sessionLog = log;
+
+            gtDebugId(GT_EXEC_ID)
+                    << tr("Logfile is located at %1").arg(logFile);
+        }
+        else
+        {
+            gtWarningId(GT_EXEC_ID)
+                    << tr("Failed to open the log file '%1'!").arg(logFile);
+            delete log;
+        }
+    }
+
+    if (runner.log)
+    {
+        runner.log->write(QStringLiteral("--- Session %1 started at %2 "
+                                         "(log file: %3) ---\n")
+                              .arg(runner.sessions + 1)
+                              .arg(date, logFile).toUtf8());
+        runner.log->flush();
+    }
+}
+
+void
+GtProcessRunnerPool::endSessionLog(Runner& runner)
+{
+    if (runner.log)
+    {
+        runner.log->write(QStringLiteral("--- Session %1 finished at %2 ---\n")
+                              .arg(runner.sessions + 1)
+                              .arg(QDateTime::currentDateTime()
+                                       .toString(Qt::ISODate)).toUtf8());
+        runner.log->flush();
+    }
+
+    if (runner.sessionLog)
+    {
+        runner.sessionLog->close();
+        runner.sessionLog->deleteLater();
+        runner.sessionLog = nullptr;
+    }
+}
+
+void
+GtProcessRunnerPool::onRunnerExited(QProcess* process)
+{
+    auto iter = find(process);
+    if (iter == m_runners.end()) return;
+
+    bool wasReady = iter->ready;
+    bool wasBusy = iter->busy;
+    bool wasStopping = iter->stopping;
+    quint16 port = iter->port;
+
+    m_runners.erase(iter);
+    process->deleteLater();
+
+    // process runner was replaced already
+    if (wasStopping) return;
+
+    if (!wasReady)
+    {
+        // do not restart the process runner if it fails to start up
+        gtWarningId(GT_EXEC_ID)
+                << tr("Process Runner exited during startup!");
+        return;
+    }
+
+    // an idle process runner only exits on its own on the idle timeout (the
+    // exit code depends on whether it had a session). It is not replaced
+    // right away, as it would time out again, but on the next acquire
+    if (!wasBusy && process->exitStatus() == QProcess::NormalExit)
+    {
+        gtDebugId(GT_EXEC_ID)
+                << tr("Process Runner on port %1 exited after being idle")
+                       .arg(port);
+        return;
+    }
+
+    // replace process runner
+    warmUp();
+}
+
+std::vector<GtProcessRunnerPool::Runner>::iterator
+GtProcessRunnerPool::find(QProcess const* process)
+{
+    return std::find_if(m_runners.begin(), m_runners.end(),
+                        [process](Runner const& runner) {
+        return runner.process == process;
+    });
+}
+
+quint16
+GtProcessRunnerPool::findAvailablePort(QList<quint16> const& reserved)
+    noexcept(false)
+{
+    using namespace gt::process_runner;
+
+    std::vector<quint16> ports;
+    for (int i = 0; i < S_PORT_RANGE; ++i)
+    {
+        quint16 port = S_DEFAULT_PORT + i;
+        if (!reserved.contains(port)) ports.push_back(port);
+    }
+
+    while (!ports.empty())
+    {
+        // randomly select a port
+        size_t idx = QRandomGenerator::global()->bounded(
+                         0, static_cast<int>(ports.size()));
+        quint16 port = ports[idx];
+
+        // check lock file
+        QString lockFilePath = portLockFilePath(port);
+
+        // lockfile
+        QLockFile portLockFile{lockFilePath};
+        // unlock file on exit
+        auto finally = gt::finally(&portLockFile, &QLockFile::unlock);
+
+        // we wont lock the file for long
+        portLockFile.setStaleLockTime(1);
+
+        // check if available
+        if (portLockFile.tryLock())
+        {
+            return port;
+        }
+
+        gtDebugId(GT_EXEC_ID)
+                << QObject::tr("Port %1 is already in use!").arg(port);
+        // remove port
+        ports.erase(std::begin(ports) + idx);
+    }
+
+    // error message
+    gtErrorId(GT_EXEC_ID)
+            << QObject::tr("All resvered ports are currently in use (%1-%2). "
+                           "If you think this is an error, remove the "
+                           "lock files manually (%3)")
+                        .arg(S_DEFAULT_PORT)
+                        .arg(S_DEFAULT_PORT + S_PORT_RANGE - 1)
+                        .arg(portLockFilePath(S_DEFAULT_PORT));
+
+    throw GTlabException{"ProcessRunner::findAvailabePort",
+                         "No port available!"};
+}
@@ -0,0 +1,234 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef GTPROCESSRUNNERPOOL_H
+#define GTPROCESSRUNNERPOOL_H
+
+#include "gt_gui_exports.h"
+
+#include <QObject>
+#include <QPointer>
+#include <QList>
+#include <QProcessEnvironment>
+
+#include <vector>
+
+class QFile;
+class QProcess;
+
+/**
+ * @brief The GtProcessRunnerPool class.
+ * Keeps a number of local process runners running in the background. The
+ * process runners are started in persistent mode, i.e. they accept
+ * successive sessions and reset their state after each task. Thus, a task
+ * can be dispatched without waiting for a new process runner to start up.
+ *
+ * Process runners that crashed are replaced. Process runners that failed to
+ * execute a session, served many sessions or were started with a different
+ * environment are recycled. A recycled process runner no longer counts
+ * against the pool size and is killed if it does not exit in time. Process
+ * runners that exited on their idle timeout are started again on the next
+ * acquire.
+ *
+ * The output of a process runner is written to a log file per port. The
+ * output of a session is additionally written to the log file of the
+ * session.
+ */
+class GT_GUI_EXPORT GtProcessRunnerPool : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    /// number of sessions after which a process runner is recycled
+    static const int S_MAX_SESSIONS;
+
+    /// idle timeout of the process runners in seconds. Process runners exit
+    /// after this time if no session was started, e.g. if the application
+    /// crashed
+    static const int S_IDLE_TIMEOUT;
+
+    /**
+     * @brief Constructor
+     * @param parent Parent object
+     */
+    explicit GtProcessRunnerPool(QObject* parent = {});
+
+    /**
+     * @brief Destructor. Terminates all process runners.
+     */
+    ~GtProcessRunnerPool() override;
+
+    /**
+     * @brief Sets the number of process runners to keep running. Idle
+     * process runners exceeding the size are terminated.
+     * @param size Pool size
+     */
+    void setSize(int size);
+
+    /**
+     * @brief Returns the number of process runners to keep running
+     * @return Pool size
+     */
+    int size() const;
+
+    /**
+     * @brief Returns the number of process runners counting against the pool
+     * size, i.e. process runners which are starting up, idle or busy.
+     * Process runners which are terminating are not counted.
+     * @return Number of active process runners
+     */
+    int activeRunners() const;
+
+    /**
+     * @brief Returns the port of an idle process runner, which is ready for
+     * a new session. The process runner is marked as busy until it is
+     * released. Waits for process runners, which are still starting up.
+     * Idle process runners, which were started with a different environment
+     * than the current one, are replaced. Blocking call.
+     * @param timeout Timeout in ms
+     * @param logFile Log file for the output of the session (optional). Is
+     * overwritten.
+     * @return Port of the process runner. 0 if no process runner is
+     * available
+     */
+    quint16 acquire(int timeout, QString const& logFile = {});
+
+    /**
+     * @brief Releases the process runner, such that it can be acquired for
+     * the next session.
+     * @param port Port of the process runner
+     * @param healthy Whether the session was closed peacefully. Otherwise
+     * the process runner is replaced.
+     */
+    void release(quint16 port, bool healthy);
+
+    /**
+     * @brief Starts new process runners until the pool size is reached
+     */
+    void warmUp();
+
+    /**
+     * @brief Terminates all process runners
+     */
+    void shutdown();
+
+    /**
+     * @brief Attempts to find an available port. Ports with a valid lock file
+     * and the ports reserved are skipped.
+     * @param reserved Ports which must not be used
+     * @return Port
+     */
+    static quint16 findAvailablePort(QList<quint16> const& reserved = {})
+        noexcept(false);
+
+signals:
+
+    /**
+     * @brief Emitted once a process runner is ready for connections
+     */
+    void runnerReady();
+
+protected:
+
+    /**
+     * @brief Returns a port for a new process runner. By default, an
+     * available port of the reserved port range is returned.
+     * @param reserved Ports used by the process runners of the pool
+     * @return Port
+     */
+    virtual quint16 reservePort(QList<quint16> const& reserved) noexcept(false);
+
+    /**
+     * @brief Creates the process of a new process runner. The process must
+     * print the ready message once it accepts connections. It is started by
+     * the pool.
+     * @param port Port the process runner should listen to
+     * @return Process (not started yet)
+     */
+    virtual QProcess* createProcess(quint16 port);
+
+private:
+
+    /// process runner instance
+    struct Runner
+    {
+        /// process of the process runner (owned by the pool)
+        QPointer<QProcess> process;
+        /// log file of the process runner (owned by the process)
+        QPointer<QFile> log;
+        /// log file of the current session (owned by the process)
+        QPointer<QFile> sessionLog;
+        /// environment the process runner was started with. Empty if a
+        /// custom environment was set
+        QProcessEnvironment environment;
+        /// port the process runner is listening to
+        quint16 port{};
+        /// whether the process runner accepts connections
+        bool ready{false};
+        /// whether a session is active
+        bool busy{false};
+        /// whether the process runner is terminating
+        bool stopping{false};
+        /// number of sessions served
+        int sessions{0};
+    };
+
+    /// process runners
+    std::vector<Runner> m_runners;
+
+    /// number of process runners to keep running
+    int m_size{0};
+
+    /**
+     * @brief Starts a new process runner
+     * @return Success
+     */
+    bool startRunner();
+
+    /**
+     * @brief Terminates the process runner. The process is killed if it does
+     * not exit in time. It is removed once it exited.
+     * @param runner Process runner
+     */
+    void stopRunner(Runner& runner);
+
+    /**
+     * @brief Replaces idle process runners that were started with a
+     * different environment than the current one
+     */
+    void recycleOutdatedRunners();
+
+    /**
+     * @brief Opens the log file of the session and writes the session marker
+     * to the log file of the process runner
+     * @param runner Process runner
+     * @param logFile Log file of the session. May be empty
+     */
+    void beginSessionLog(Runner& runner, QString const& logFile);
+
+    /**
+     * @brief Writes the session marker to the log file of the process runner
+     * and closes the log file of the session
+     * @param runner Process runner
+     */
+    void endSessionLog(Runner& runner);
+
+    /**
+     * @brief Handles a process runner which exited or failed to start
+     * @param process Process of the process runner
+     */
+    void onRunnerExited(QProcess* process);
+
+    /**
+     * @brief Returns the process runner
+     * @param process Process of the process runner
+     * @return Iterator to the process runner
+     */
+    std::vector<Runner>::iterator find(QProcess const* process);
+};
+
+#endif // GTPROCESSRUNNERPOOL_H
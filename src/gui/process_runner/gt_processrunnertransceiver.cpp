@@ -23,24 +23,20 @@
 #include "gt_processrunnerresponse.h"
 #include "gt_processrunnernotification.h"
 #include "gt_processrunnerconnectionstrategy.h"
+#include "gt_processrunnerprotocol.h"
+#include "gt_processrunnerpool.h"
+#include "gt_settings.h"
 #include "gt_environment.h"
 
 #include <QUuid>
 #include <QTimer>
 #include <QRunnable>
-#include <QRandomGenerator>
 #include <QtConcurrent>
-#include <QLockFile>
-
-#include <array>
 
 static const int S_SEND_COMMAND_TIMEOUT = 60 * 1000;
 static const int S_CONNECTION_TIMEOUT   = 10 * 1000;
 static const int S_ABORT_TIMEOUT        =  3 * 1000;
-
-static const uint S_PORT_RANGE = 20;
-
-static std::array<quint16, S_PORT_RANGE> S_PORTS{};
+static const int S_POOL_ACQUIRE_TIMEOUT = 30 * 1000;
 
 static const QString S_ENV_PROJECT_PATH =
         QStringLiteral("GT_REMOTE_PROJECT_PATH");
@@ -62,12 +58,6 @@ bool terminateProcessRunner(QString const& sessionId,
                             quint16 port,
                             int timeout);
 
-/**
- * @brief Attempts to find an available port. Returns 0 if none is empty.
- * @return port
- */
-quint16 findAvailablePort() noexcept(false);
-
 /**
  * @brief Returns the project path to use for the execution
  * @param isLocalhost Whether the remote project path should be used
@@ -104,10 +94,6 @@ GtProcessRunnerTransceiver::GtProcessRunnerTransceiver(
 
     m_connection->setParent(this);
 
-    // init port range
-    std::iota(std::begin(S_PORTS), std::end(S_PORTS),
-              gt::process_runner::S_DEFAULT_PORT);
-
     // register enum
     qRegisterMetaType<GtProcessRunnerTransceiver::ConnectionState>(
                 "GtProcessRunnerTransceiver::ConnectionState");
@@ -132,6 +118,10 @@ GtProcessRunnerTransceiver::GtProcessRunnerTransceiver(
 GtProcessRunnerTransceiver::~GtProcessRunnerTransceiver()
 {
     gtDebugId(GT_EXEC_ID).medium() << tr("Closing down Process Runner...");
+    // terminate warm process runners
+    QMetaObject::invokeMethod(this,
+                              &GtProcessRunnerTransceiver::doShutdownPool,
+                              Qt::BlockingQueuedConnection);
     // join thread - should happen instantaneously
     m_thread.quit();
     m_thread.wait(std::chrono::seconds{1});
@@ -274,6 +264,8 @@ GtProcessRunnerTransceiver::doClose()
     setConnectionState(ConnectionClosed);
     m_connection->close();
 
+    releasePooledProcessRunner(true);
+
     if (m_session)
     {
         m_session->deleteLater();
@@ -293,6 +285,10 @@ GtProcessRunnerTransceiver::doAbort()
 
     bool hadConnection = m_connection->hasConnection();
 
+    // the pool replaces the warm process runner and kills it if the abort
+    // command has no effect
+    releasePooledProcessRunner(false);
+
     // disconnect to gurantee that any stalling send/recieve action has
     // been stopped
     doClose();
@@ -580,7 +576,7 @@ GtProcessRunnerTransceiver::sendCommand(Session* session, Command& command)
         setConnectionState(Transmitting);
 
         // async call
-        m_connection->writeData(loop, command.toMemento().toByteArray());
+        m_connection->writeData(loop, command.toMemento().toBinary());
 
         auto res = loop.exec();
 
@@ -743,11 +739,27 @@ GtProcessRunnerTransceiver::startProcessRunner(GtTask& task)
         return false;
     }
 
+    // log file
+    QDir tempDir = task.tempDir();
+    if (tempDir.path().isEmpty())
+    {
+        tempDir = gtApp->applicationTempDir();
+    }
+
+    QString logfile =
+            tempDir.absoluteFilePath(QStringLiteral("process_runner.log"));
+
+    // reuse a warm process runner if available
+    if (acquirePooledProcessRunner(logfile))
+    {
+        return true;
+    }
+
     // find avialable port
     quint16 port{};
     try
     {
-        port = findAvailablePort();
+        port = GtProcessRunnerPool::findAvailablePort();
     }
     catch (GTlabException const& /*e*/)
     {
@@ -777,15 +789,6 @@ GtProcessRunnerTransceiver::startProcessRunner(GtTask& task)
     process.setProgram(appDir.absoluteFilePath(QStringLiteral("GTlabConsole")));
     process.setArguments(args);
 
-    // log file
-    QDir tempDir = task.tempDir();
-    if (tempDir.path().isEmpty())
-    {
-        tempDir = gtApp->applicationTempDir();
-    }
-
-    QString logfile =
-            tempDir.absoluteFilePath(QStringLiteral("process_runner.log"));
     process.setStandardOutputFile(logfile);
     process.setStandardErrorFile(logfile);
 
@@ -803,6 +806,60 @@ GtProcessRunnerTransceiver::startProcessRunner(GtTask& task)
     return true;
 }
 
+bool
+GtProcessRunnerTransceiver::acquirePooledProcessRunner(QString const& logFile)
+{
+    int poolSize = gtApp->settings()->processRunnerPoolSize();
+
+    if (poolSize <= 0)
+    {
+        if (m_pool) m_pool->setSize(0);
+        return false;
+    }
+
+    if (!m_pool)
+    {
+        m_pool = new GtProcessRunnerPool(this);
+    }
+    m_pool->setSize(poolSize);
+
+    // blocking call
+    quint16 port = m_pool->acquire(S_POOL_ACQUIRE_TIMEOUT, logFile);
+    if (port == 0)
+    {
+        gtDebugId(GT_EXEC_ID)
+                << tr("No warm Process Runner available, starting a new one...");
+        return false;
+    }
+
+    // update port
+    auto address = m_connection->targetAddress();
+    address.port = port;
+    m_connection->setTargetAddress(address);
+
+    m_pooledPort = port;
+
+    gtDebugId(GT_EXEC_ID)
+            << tr("Using warm Process Runner on port %1").arg(port);
+    return true;
+}
+
+void
+GtProcessRunnerTransceiver::releasePooledProcessRunner(bool healthy)
+{
+    if (m_pool && m_pooledPort != 0)
+    {
+        m_pool->release(m_pooledPort, healthy);
+    }
+    m_pooledPort = 0;
+}
+
+void
+GtProcessRunnerTransceiver::doShutdownPool()
+{
+    delete m_pool;
+}
+
 void
 GtProcessRunnerTransceiver::setConnectionState(GtProcessRunnerTransceiver::ConnectionState state)
 {
@@ -849,8 +906,9 @@ terminateProcessRunner(QString const& sessionId,
 
     // write command
     loop.clear();
-    socket.write(loop, cmd.toMemento().toByteArray(),
-                 GtTcpSocket::PrependDataSize);
+    socket.write(loop,
+                 gt::process_runner::makeFrame(cmd.toMemento().toBinary()),
+                 GtTcpSocket::RawData);
 
     // wait until written
     if (loop.exec() != GtEventLoop::Success)
@@ -872,56 +930,6 @@ terminateProcessRunner(QString const& sessionId,
     return true;
 }
 
-quint16 findAvailablePort() noexcept(false)
-{
-    using namespace gt::process_runner;
-
-    // local copy of ports
-    std::vector<quint16> ports{S_PORTS.cbegin(), S_PORTS.cend()};
-
-    while (!ports.empty())
-    {
-        // randomly select a port
-        size_t idx = QRandomGenerator::global()->bounded(
-                         0, static_cast<int>(ports.size()));
-        quint16 port = ports[idx];
-
-        // check lock file
-        QString lockFilePath = portLockFilePath(port);
-
-        // lockfile
-        QLockFile portLockFile{lockFilePath};
-        // unlock file on exit
-        auto finally = gt::finally(&portLockFile, &QLockFile::unlock);
-
-        // we wont lock the file for long
-        portLockFile.setStaleLockTime(1);
-
-        // check if available
-        if (portLockFile.tryLock())
-        {
-            return port;
-        }
-
-        gtDebugId(GT_EXEC_ID)
-                << QObject::tr("Port %1 is already in use!").arg(port);
-        // remove port
-        ports.erase(std::begin(ports) + idx);
-    }
-
-    // error message
-    gtErrorId(GT_EXEC_ID)
-            << QObject::tr("All resvered ports are currently in use (%1-%2). "
-                           "If you think this is an error, remove the "
-                           "lock files manually (%3)")
-                        .arg(S_DEFAULT_PORT)
-                        .arg(S_DEFAULT_PORT + S_PORT_RANGE - 1)
-                        .arg(portLockFilePath(S_DEFAULT_PORT));
-
-    throw GTlabException{"ProcessRunner::findAvailabePort",
-                         "No port available!"};
-}
-
 QString
 projectPath(bool isLocalhost)
 {
@@ -25,6 +25,7 @@ class GtProcessRunnerCommand;
 class GtProcessRunnerResponse;
 class GtProcessRunnerNotification;
 class GtProcessRunnerConnectionStrategy;
+class GtProcessRunnerPool;
 /**
  * @brief The GtProcessRunnerTransceiver class
  * Abstracts the communication and handling of the remote process runner.
@@ -198,6 +199,13 @@ private:
     /// whether the connection points to localhost
     bool m_isLocalhost{false};
 
+    /// Process runners kept running in the background (autostart only)
+    QPointer<GtProcessRunnerPool> m_pool;
+
+    /// Port of the process runner acquired from the pool. 0 if the process
+    /// runner is not part of the pool
+    quint16 m_pooledPort{0};
+
     /**
      * @brief Actual close function. Will disconnect and delete the current
      * session if any existed
@@ -215,6 +223,11 @@ private:
      */
     Q_INVOKABLE void doReconnect();
 
+    /**
+     * @brief Terminates all process runners of the pool
+     */
+    Q_INVOKABLE void doShutdownPool();
+
     /**
      * @brief Actuual function which starts the process runner
      * (if specified), establishes a new session and send the run task command
@@ -270,6 +283,21 @@ private:
      */
     bool startProcessRunner(GtTask& task);
 
+    /**
+     * @brief Helper function, which acquires a process runner from the pool.
+     * Updates the target address if successful.
+     * @param logFile Log file for the output of the session
+     * @return success
+     */
+    bool acquirePooledProcessRunner(QString const& logFile);
+
+    /**
+     * @brief Releases the process runner acquired from the pool (if any)
+     * @param healthy Whether the process runner may be used for the next
+     * session
+     */
+    void releasePooledProcessRunner(bool healthy);
+
     /**
      * @brief Setter for the connection state
      * @param state New state
@@ -16,6 +16,7 @@
 #include "gt_linenumberarea.h"
 #include "gt_application.h"
 #include "gt_colors.h"
+#include "gt_objectmemento.h"
 
 GtCodeEditor::GtCodeEditor(QWidget* parent) : QPlainTextEdit(parent)
 {
@@ -122,7 +123,9 @@ GtCodeEditor::dropEvent(QDropEvent* event)
     if (event->mimeData()->formats().contains("GtObject"))
     {
         clear();
-        setPlainText(event->mimeData()->data("GtObject"));
+        // object data may be binary
+        GtObjectMemento memento{event->mimeData()->data("GtObject")};
+        setPlainText(memento.toByteArray());
     }
 
     QPlainTextEdit::dropEvent(event);
@@ -0,0 +1,135 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+/*
+ * Compares the write throughput and the file size of the storage layouts of
+ * externalized datasets (contiguous, chunked, chunked with deflate and
+ * shuffle filter).
+ */
+
+#include "gt_externalizationmanager.h"
+#include "gt_externalizedobject.h"
+#include "gt_h5externalizationinterface.h"
+#include "gt_h5externalizehelper.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QTemporaryDir>
+
+#include <algorithm>
+#include <iostream>
+
+namespace
+{
+
+/// externalized object, which only provides the meta data of the dataset
+class BenchmarkObject : public GtExternalizedObject
+{
+protected:
+
+    bool doFetchData(QVariant&, bool) override { return true; }
+
+    bool doExternalizeData(QVariant&) override { return true; }
+
+    void doClearExternalizedData() override { }
+};
+
+/// writes the values with the given layout and prints the throughput
+bool
+benchmark(QVector<double> const& values,
+          GtExternalizationManager::StorageLayout layout,
+          char const* name)
+{
+    gtExternalizationManager->setStorageLayout(layout);
+
+    BenchmarkObject object;
+    GtH5ExternalizeHelper helper{object};
+
+    QString filePath = gtH5ExternalizationInterface->projectHDF5FilePath(false);
+    qint64 size = QFileInfo(filePath).size();
+
+    QElapsedTimer timer;
+    timer.start();
+
+    QVariant ref;
+    if (!helper.write(GenH5::Data<double>{values}, ref))
+    {
+        std::cerr << "Failed to write the " << name << " dataset"
+                  << std::endl;
+        return false;
+    }
+
+    qint64 elapsed = std::max<qint64>(timer.elapsed(), 1);
+    qint64 fileSize = QFileInfo(filePath).size() - size;
+
+    double mib = values.size() * sizeof(double) / 1024.0 / 1024.0;
+
+    std::cout << name << ": " << elapsed << " ms ("
+              << mib / (elapsed / 1000.0) << " MiB/s), "
+              << fileSize / 1024 << " KiB" << std::endl;
+
+    return true;
+}
+
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+        QStringLiteral("Compares the storage layouts of externalized data"));
+    parser.addHelpOption();
+    parser.addOptions({
+        {"values", "Number of values per dataset.", "n", "1000000"}
+    });
+    parser.process(app);
+
+    int n = std::max(1, parser.value("values").toInt());
+
+    QVector<double> values(n);
+    for (int i = 0; i < n; ++i)
+    {
+        values[i] = 0.5 * (i % 1000);
+    }
+
+    QTemporaryDir projectDir;
+    if (!projectDir.isValid()) return 1;
+
+    gtExternalizationManager->enableExternalization(true);
+    gtExternalizationManager->onProjectLoaded(projectDir.path());
+
+    GtExternalizationManager::StorageLayout contiguous;
+
+    GtExternalizationManager::StorageLayout chunked;
+    chunked.chunked = true;
+
+    GtExternalizationManager::StorageLayout compressed;
+    compressed.chunked = true;
+    compressed.compressionLevel = 4;
+    compressed.shuffle = true;
+
+    try
+    {
+        if (!benchmark(values, contiguous, "contiguous") ||
+            !benchmark(values, chunked, "chunked") ||
+            !benchmark(values, compressed, "chunked+deflate+shuffle"))
+        {
+            return 1;
+        }
+    }
+    catch (GenH5::Exception const& e)
+    {
+        std::cerr << "HDF5 error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,196 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+/*
+ * Measures the startup time of GTlabConsole with the synthetic modules.
+ *
+ * Each run starts "GTlabConsole --help", which performs the full startup
+ * (modules, session, module initialization) before printing the help.
+ *  - cold: every run uses an empty cache directory, thus the meta data of
+ *          all modules has to be read
+ *  - warm: all runs share a cache directory, which is primed by an
+ *          additional run
+ * Caches of the operating system cannot be dropped without privileges,
+ * therefore the libraries themselves are loaded from the page cache in
+ * both modes.
+ */
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QProcess>
+#include <QTemporaryDir>
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+
+struct Options
+{
+    QString console;
+    QString moduleDir;
+    QString traceDir;
+    int runs{5};
+    int timeout{60000};
+};
+
+/// starts the console once and returns the wall time in ms (-1 on failure)
+double
+startConsole(Options const& options,
+             QString const& cacheDir,
+             QString const& traceFile)
+{
+    QProcessEnvironment env = QProcessEnvironment::systemEnvironment();
+    env.insert(QStringLiteral("GTLAB_MODULE_DIR"), options.moduleDir);
+
+    // location of the module meta cache
+    env.insert(QStringLiteral("GTLAB_CACHE_DIR"), cacheDir);
+
+    if (!traceFile.isEmpty())
+    {
+        env.insert(QStringLiteral("GTLAB_STARTUP_TRACE"), traceFile);
+    }
+
+    QProcess process;
+    process.setProcessEnvironment(env);
+    process.setStandardOutputFile(QProcess::nullDevice());
+    process.setStandardErrorFile(QProcess::nullDevice());
+
+    QElapsedTimer timer;
+    timer.start();
+
+    process.start(options.console, {QStringLiteral("--help")});
+
+    if (!process.waitForFinished(options.timeout) ||
+        process.exitStatus() != QProcess::NormalExit ||
+        process.exitCode() != 0)
+    {
+        std::cerr << "Failed to run '" << options.console.toStdString()
+                  << "': " << process.errorString().toStdString()
+                  << std::endl;
+        process.kill();
+        return -1;
+    }
+
+    return timer.nsecsElapsed() / 1e6;
+}
+
+QString
+traceFile(Options const& options, QString const& mode, int run)
+{
+    if (options.traceDir.isEmpty()) return {};
+
+    return QDir(options.traceDir).absoluteFilePath(
+                QStringLiteral("startup_%1_%2.json").arg(mode).arg(run));
+}
+
+double
+median(std::vector<double> times)
+{
+    std::sort(times.begin(), times.end());
+    size_t n = times.size();
+    return n % 2 ? times[n / 2] : 0.5 * (times[n / 2 - 1] + times[n / 2]);
+}
+
+void
+report(char const* mode, std::vector<double> times)
+{
+    std::sort(times.begin(), times.end());
+
+    double mean = std::accumulate(times.begin(), times.end(), 0.0) /
+                  times.size();
+
+    std::cout << mode << ": min " << times.front() << " ms, median "
+              << median(times) << " ms, mean " << mean << " ms, max "
+              << times.back() << " ms (" << times.size() << " runs)"
+              << std::endl;
+}
+
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+        QStringLiteral("Measures the cold and warm startup time of "
+                       "GTlabConsole"));
+    parser.addHelpOption();
+    parser.addOptions({
+        {"console", "Path of the GTlabConsole executable.", "path",
+         QStringLiteral(GT_BENCHMARK_CONSOLE)},
+        {"modules", "Directory of the modules to load.", "dir",
+         QStringLiteral(GT_BENCHMARK_MODULE_DIR)},
+        {"runs", "Number of runs per mode.", "n", "5"},
+        {"trace-dir", "Writes the startup trace of each run to this "
+                      "directory.", "dir"},
+        {"max-warm-ms", "Fails if the median warm startup time exceeds "
+                        "this limit.", "ms"}
+    });
+    parser.process(app);
+
+    Options options;
+    options.console = parser.value("console");
+    options.moduleDir = parser.value("modules");
+    options.traceDir = parser.value("trace-dir");
+    options.runs = std::max(1, parser.value("runs").toInt());
+
+    if (!options.traceDir.isEmpty())
+    {
+        QDir().mkpath(options.traceDir);
+    }
+
+    int nModules = QDir(options.moduleDir).entryList(QDir::Files).size();
+    std::cout << "Starting '" << options.console.toStdString() << "' with "
+              << nModules << " modules" << std::endl;
+
+    std::vector<double> cold, warm;
+
+    for (int i = 0; i < options.runs; ++i)
+    {
+        QTemporaryDir cacheDir;
+        double t = startConsole(options, cacheDir.path(),
+                                traceFile(options, "cold", i));
+        if (t < 0) return 1;
+        cold.push_back(t);
+    }
+
+    QTemporaryDir warmCacheDir;
+
+    // fills the cache
+    if (startConsole(options, warmCacheDir.path(), {}) < 0) return 1;
+
+    for (int i = 0; i < options.runs; ++i)
+    {
+        double t = startConsole(options, warmCacheDir.path(),
+                                traceFile(options, "warm", i));
+        if (t < 0) return 1;
+        warm.push_back(t);
+    }
+
+    report("cold", cold);
+    report("warm", warm);
+
+    if (parser.isSet("max-warm-ms"))
+    {
+        double limit = parser.value("max-warm-ms").toDouble();
+        if (median(warm) > limit)
+        {
+            std::cerr << "Median warm startup time exceeds " << limit
+                      << " ms" << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
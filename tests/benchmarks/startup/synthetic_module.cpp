@@ -0,0 +1,19 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "synthetic_module.h"
+
+GtVersionNumber
+SyntheticModule::version()
+{
+    return GtVersionNumber(1, 0, 0);
+}
+
+QString
+SyntheticModule::description() const
+{
+    return QStringLiteral("Synthetic module of the startup benchmark");
+}
@@ -0,0 +1,38 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef SYNTHETIC_MODULE_H
+#define SYNTHETIC_MODULE_H
+
+#include "gt_moduleinterface.h"
+#include "gt_versionnumber.h"
+
+/**
+ * @brief The SyntheticModule class.
+ * Minimal module used by the startup benchmark. The module id is defined by
+ * the build system, thus the same sources yield any number of modules.
+ */
+class SyntheticModule : public QObject, public GtModuleInterface
+{
+    Q_OBJECT
+    GT_MODULE()
+
+public:
+
+    /**
+     * @brief Returns current version number of module
+     * @return version number
+     */
+    GtVersionNumber version() override;
+
+    /**
+     * @brief Returns module description
+     * @return description
+     */
+    QString description() const override;
+};
+
+#endif // SYNTHETIC_MODULE_H
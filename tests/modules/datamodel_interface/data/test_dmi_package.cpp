@@ -30,3 +30,9 @@ TestDmiPackage::TestDmiPackage() :
 
     registerProperty(m_link);
 }
+
+bool
+TestDmiPackage::supportsStreamIO() const
+{
+    return true;
+}
@@ -30,6 +30,12 @@ public:
       */
     Q_INVOKABLE TestDmiPackage();
 
+    /**
+     * @brief Package data is read and saved using the stream based methods.
+     * @return true
+     */
+    bool supportsStreamIO() const override;
+
 private:
     GtObjectLinkProperty m_link;
 
@@ -15,3 +15,9 @@ TestMdiPackage::TestMdiPackage()
 {
     setObjectName("Test MDI Package");
 }
+
+bool
+TestMdiPackage::supportsStreamIO() const
+{
+    return true;
+}
@@ -29,6 +29,12 @@ public:
       */
     Q_INVOKABLE TestMdiPackage();
 
+    /**
+     * @brief Package data is read and saved using the stream based methods.
+     * @return true
+     */
+    bool supportsStreamIO() const override;
+
 };
 
 #endif // TEST_DMI_PACKAGE_H
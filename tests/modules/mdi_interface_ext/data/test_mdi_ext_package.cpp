@@ -15,3 +15,9 @@ TestMdiExtPackage::TestMdiExtPackage()
 {
     setObjectName("Test MDI EXT Package");
 }
+
+bool
+TestMdiExtPackage::supportsStreamIO() const
+{
+    return true;
+}
@@ -28,6 +28,12 @@ public:
       */
     Q_INVOKABLE TestMdiExtPackage();
 
+    /**
+     * @brief Package data is read and saved using the stream based methods.
+     * @return true
+     */
+    bool supportsStreamIO() const override;
+
 };
 
 #endif // TEST_DMI_EXT_PACKAGE_H
@@ -0,0 +1,245 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "gt_coreprocessexecutor.h"
+#include "gt_externalizationmanager.h"
+#include "gt_objectfactory.h"
+#include "gt_processrunnercommand.h"
+#include "gt_processrunnerresponse.h"
+#include "gt_project.h"
+#include "gt_remoteprocessrunner.h"
+#include "gt_remoteprocessrunnersession.h"
+#include "gt_task.h"
+
+#include "gt_testhelper.h"
+#include "test_gt_remoteprocessrunnerclasses.h"
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QPointer>
+
+#include <functional>
+
+using Session = GtRemoteProcessRunnerSession;
+
+class TestGtRemoteProcessRunner : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        for (QMetaObject const& meta : {GtTask::staticMetaObject,
+                                        TestRunnerPackage::staticMetaObject,
+                                        TestBlockingCalculator::staticMetaObject})
+        {
+            if (!gtObjectFactory->knownClass(meta.className()))
+            {
+                gtObjectFactory->registerClass(meta);
+            }
+        }
+
+        TestBlockingCalculator::released() = false;
+        TestBlockingCalculator::running() = 0;
+
+        m_projectDir = gtExternalizationManager->projectDir();
+
+        runner.setMaxSessions(2);
+    }
+
+    void TearDown() override
+    {
+        TestBlockingCalculator::released() = true;
+
+        gtExternalizationManager->setProjectDir(m_projectDir);
+    }
+
+    /// appends a task blocking until the calculators are released
+    static GtTask* appendTask(GtProject& project)
+    {
+        project.appendChild(new TestRunnerPackage);
+
+        auto* task = new GtTask;
+        task->appendChild(new TestBlockingCalculator);
+        project.appendChild(task);
+
+        return task;
+    }
+
+    static bool initSession(Session& session, QString const& sessionId)
+    {
+        GtProcessRunnerInitSessionCommand cmd;
+        cmd.setSessionId(sessionId);
+
+        auto response = session.handleCommand(cmd);
+        return response && response->success();
+    }
+
+    static bool runTask(Session& session, GtTask& task,
+                        QString const& projectPath)
+    {
+        GtProcessRunnerRunTaskCommand cmd{&task, projectPath};
+        cmd.setSessionId(session.sessionId());
+
+        auto response = session.handleCommand(cmd);
+        return response && response->success();
+    }
+
+    static bool collectTask(Session& session, GtTask& task)
+    {
+        GtProcessRunnerCollectTaskCommand cmd{task.uuid()};
+        cmd.setSessionId(session.sessionId());
+
+        auto response = session.handleCommand(cmd);
+        return response && response->success();
+    }
+
+    static bool isFinished(Session const& session)
+    {
+        return session.state().state() ==
+               gt::process_runner::FinishedTaskState;
+    }
+
+    /// processes events until the condition is met
+    static bool waitFor(std::function<bool()> const& condition)
+    {
+        QElapsedTimer timer;
+        timer.start();
+
+        while (!condition())
+        {
+            if (timer.elapsed() > 10000) return false;
+            QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+        }
+        return true;
+    }
+
+    GtRemoteProcessRunner runner;
+
+    QString m_projectDir;
+};
+
+/// the tasks of two sessions of the same project are executed at once
+TEST_F(TestGtRemoteProcessRunner, concurrentSessions)
+{
+    QString projectPath = gtTestHelper->newTempDir().absolutePath();
+
+    GtProject projectA{QString{}};
+    GtProject projectB{QString{}};
+
+    GtTask* taskA = appendTask(projectA);
+    GtTask* taskB = appendTask(projectB);
+
+    Session sessionA{runner};
+    Session sessionB{runner};
+
+    ASSERT_TRUE(initSession(sessionA, QStringLiteral("A")));
+    ASSERT_TRUE(initSession(sessionB, QStringLiteral("B")));
+
+    ASSERT_TRUE(runTask(sessionA, *taskA, projectPath));
+    ASSERT_TRUE(runTask(sessionB, *taskB, projectPath));
+
+    EXPECT_EQ(gtExternalizationManager->projectDir(), projectPath);
+
+    // both calculators are running at the same time
+    EXPECT_TRUE(waitFor([]() {
+        return TestBlockingCalculator::running() == 2;
+    }));
+
+    TestBlockingCalculator::released() = true;
+
+    ASSERT_TRUE(waitFor([&]() {
+        return isFinished(sessionA) && isFinished(sessionB);
+    }));
+
+    EXPECT_TRUE(collectTask(sessionA, *taskA));
+    EXPECT_TRUE(collectTask(sessionB, *taskB));
+}
+
+/// the externalization directory is global, a task of a different project is
+/// refused until the running task was collected
+TEST_F(TestGtRemoteProcessRunner, differentProjectIsRefused)
+{
+    QString projectPathA = gtTestHelper->newTempDir().absolutePath();
+    QString projectPathB = gtTestHelper->newTempDir().absolutePath();
+
+    GtProject projectA{QString{}};
+    GtProject projectB{QString{}};
+
+    GtTask* taskA = appendTask(projectA);
+    GtTask* taskB = appendTask(projectB);
+
+    Session sessionA{runner};
+    Session sessionB{runner};
+
+    ASSERT_TRUE(initSession(sessionA, QStringLiteral("A")));
+    ASSERT_TRUE(initSession(sessionB, QStringLiteral("B")));
+
+    ASSERT_TRUE(runTask(sessionA, *taskA, projectPathA));
+    EXPECT_FALSE(runTask(sessionB, *taskB, projectPathB));
+
+    EXPECT_EQ(gtExternalizationManager->projectDir(), projectPathA);
+    EXPECT_EQ(sessionB.state().state(), gt::process_runner::InitializedState);
+
+    TestBlockingCalculator::released() = true;
+
+    ASSERT_TRUE(waitFor([&]() { return isFinished(sessionA); }));
+
+    // the project directory is reserved until the task was collected
+    EXPECT_FALSE(runTask(sessionB, *taskB, projectPathB));
+    ASSERT_TRUE(collectTask(sessionA, *taskA));
+
+    ASSERT_TRUE(runTask(sessionB, *taskB, projectPathB));
+    EXPECT_EQ(gtExternalizationManager->projectDir(), projectPathB);
+
+    ASSERT_TRUE(waitFor([&]() { return isFinished(sessionB); }));
+}
+
+/// closing a session (i.e. aborting it) only terminates its own task
+TEST_F(TestGtRemoteProcessRunner, abortSession)
+{
+    QString projectPath = gtTestHelper->newTempDir().absolutePath();
+
+    GtProject projectA{QString{}};
+    GtProject projectB{QString{}};
+
+    GtTask* taskA = appendTask(projectA);
+    GtTask* taskB = appendTask(projectB);
+
+    Session sessionA{runner};
+    Session sessionB{runner};
+
+    ASSERT_TRUE(initSession(sessionA, QStringLiteral("A")));
+    ASSERT_TRUE(initSession(sessionB, QStringLiteral("B")));
+
+    ASSERT_TRUE(runTask(sessionA, *taskA, projectPath));
+    ASSERT_TRUE(runTask(sessionB, *taskB, projectPath));
+
+    ASSERT_TRUE(waitFor([]() {
+        return TestBlockingCalculator::running() == 2;
+    }));
+
+    QPointer<GtTask> runningA = sessionA.executor().currentRunningTask();
+    ASSERT_FALSE(runningA.isNull());
+
+    bool closedA = false;
+    QObject::connect(&sessionA, &Session::closed, [&closedA]() {
+        closedA = true;
+    });
+
+    sessionA.close();
+
+    TestBlockingCalculator::released() = true;
+
+    ASSERT_TRUE(waitFor([&]() { return closedA && isFinished(sessionB); }));
+
+    ASSERT_FALSE(runningA.isNull());
+    EXPECT_EQ(runningA->currentState(), GtProcessComponent::TERMINATED);
+
+    EXPECT_FALSE(sessionB.isTaskRunning());
+    EXPECT_TRUE(collectTask(sessionB, *taskB));
+}
@@ -0,0 +1,79 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef TEST_GT_REMOTEPROCESSRUNNERCLASSES_H
+#define TEST_GT_REMOTEPROCESSRUNNERCLASSES_H
+
+#include "gt_calculator.h"
+#include "gt_package.h"
+
+#include <QElapsedTimer>
+#include <QThread>
+
+#include <atomic>
+
+/**
+ * @brief Package holding the data of the tasks sent to the process runner
+ */
+class TestRunnerPackage : public GtPackage
+{
+    Q_OBJECT
+
+public:
+
+    Q_INVOKABLE TestRunnerPackage() = default;
+};
+
+/**
+ * @brief Calculator blocking until it is released, thus the task can be
+ * aborted while it is running.
+ */
+class TestBlockingCalculator : public GtCalculator
+{
+    Q_OBJECT
+
+public:
+
+    Q_INVOKABLE TestBlockingCalculator() = default;
+
+    /// whether the calculators may finish
+    static std::atomic<bool>& released()
+    {
+        static std::atomic<bool> flag{false};
+        return flag;
+    }
+
+    /// number of running calculators
+    static std::atomic<int>& running()
+    {
+        static std::atomic<int> count{0};
+        return count;
+    }
+
+    bool run() override
+    {
+        running() += 1;
+
+        QElapsedTimer timer;
+        timer.start();
+
+        bool success = true;
+        while (!released())
+        {
+            if (timer.elapsed() > 5000)
+            {
+                success = false;
+                break;
+            }
+            QThread::msleep(1);
+        }
+
+        running() -= 1;
+        return success;
+    }
+};
+
+#endif // TEST_GT_REMOTEPROCESSRUNNERCLASSES_H
@@ -0,0 +1,76 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef TEST_GT_CONCURRENTCALCULATOR_H
+#define TEST_GT_CONCURRENTCALCULATOR_H
+
+#include "gt_calculator.h"
+#include "gt_objectlinkproperty.h"
+
+#include <QElapsedTimer>
+#include <QThread>
+
+#include <atomic>
+
+/**
+ * @brief Calculator renaming the linked object. Waits until the given number
+ * of calculators has been started, thus it only succeeds if the
+ * calculators are executed concurrently.
+ */
+class TestConcurrentCalculator : public GtCalculator
+{
+    Q_OBJECT
+
+public:
+
+    Q_INVOKABLE TestConcurrentCalculator() :
+        m_target("target", "Target", "Target object", {}, this, {})
+    {
+        registerProperty(m_target);
+    }
+
+    /// number of started calculators
+    static std::atomic<int>& started()
+    {
+        static std::atomic<int> count{0};
+        return count;
+    }
+
+    /// number of calculators to wait for
+    static std::atomic<int>& expected()
+    {
+        static std::atomic<int> count{1};
+        return count;
+    }
+
+    void setTarget(QString const& uuid) { m_target.setVal(uuid); }
+
+    bool run() override
+    {
+        started() += 1;
+
+        QElapsedTimer timer;
+        timer.start();
+
+        while (started() < expected())
+        {
+            if (timer.elapsed() > 5000) return false;
+            QThread::msleep(1);
+        }
+
+        GtObject* target = data(m_target);
+        if (!target) return false;
+
+        target->setObjectName(QStringLiteral("Done"));
+        return true;
+    }
+
+private:
+
+    GtObjectLinkProperty m_target;
+};
+
+#endif // TEST_GT_CONCURRENTCALCULATOR_H
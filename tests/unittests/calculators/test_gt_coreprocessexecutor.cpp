@@ -0,0 +1,209 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "gt_coreprocessexecutor.h"
+#include "gt_objectfactory.h"
+#include "gt_objectgroup.h"
+#include "gt_project.h"
+#include "gt_task.h"
+
+#include "test_gt_concurrentcalculator.h"
+
+#include <QEventLoop>
+#include <QTimer>
+
+namespace
+{
+
+/// executor using a fixed application preference for the concurrent tasks
+class TestPreferenceProcessExecutor : public GtCoreProcessExecutor
+{
+public:
+
+    using GtCoreProcessExecutor::GtCoreProcessExecutor;
+
+    /// max. concurrent tasks of the application preferences
+    int preference{1};
+
+protected:
+
+    int preferredMaxConcurrentTasks() const override { return preference; }
+};
+
+} // namespace
+
+class TestGtCoreProcessExecutor : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        if (!gtObjectFactory->knownClass(GT_CLASSNAME(GtTask)))
+        {
+            gtObjectFactory->registerClass(GtTask::staticMetaObject);
+        }
+
+        if (!gtObjectFactory->knownClass(
+                GT_CLASSNAME(TestConcurrentCalculator)))
+        {
+            gtObjectFactory->registerClass(
+                        TestConcurrentCalculator::staticMetaObject);
+        }
+
+        TestConcurrentCalculator::started() = 0;
+        TestConcurrentCalculator::expected() = 2;
+    }
+
+    /// appends a task renaming a new object of the project
+    GtTask* appendTask(GtProject& project, GtObjectGroup*& target)
+    {
+        target = new GtObjectGroup;
+        target->setObjectName("Target");
+        project.appendChild(target);
+
+        auto* calc = new TestConcurrentCalculator;
+        calc->setTarget(target->uuid());
+
+        auto* task = new GtTask;
+        task->appendChild(calc);
+        project.appendChild(task);
+
+        return task;
+    }
+
+    /// waits until all tasks have been executed
+    static bool waitForCompletion(GtCoreProcessExecutor& executor)
+    {
+        QEventLoop loop;
+        QTimer timeout;
+        timeout.setSingleShot(true);
+
+        QObject::connect(&executor, &GtCoreProcessExecutor::allTasksCompleted,
+                         &loop, &QEventLoop::quit);
+        QObject::connect(&timeout, &QTimer::timeout,
+                         &loop, &QEventLoop::quit);
+
+        timeout.start(10000);
+        loop.exec();
+
+        return timeout.isActive();
+    }
+};
+
+/// tasks of different projects are executed concurrently and are merged into
+/// their own project
+TEST_F(TestGtCoreProcessExecutor, concurrentTasksOfDifferentProjects)
+{
+    GtProject projectA{QString{}};
+    GtProject projectB{QString{}};
+
+    GtObjectGroup* targetA{};
+    GtObjectGroup* targetB{};
+
+    GtTask* taskA = appendTask(projectA, targetA);
+    GtTask* taskB = appendTask(projectB, targetB);
+
+    GtCoreProcessExecutor executor{nullptr, gt::NonBlockingExecution};
+    executor.setMaxConcurrentTasks(2);
+    EXPECT_EQ(executor.maxConcurrentTasks(), 2);
+
+    ASSERT_TRUE(executor.queueTask(taskA));
+    ASSERT_TRUE(executor.queueTask(taskB));
+    ASSERT_TRUE(executor.executeNextTask());
+
+    EXPECT_TRUE(executor.taskCurrentlyRunning());
+    EXPECT_NE(executor.currentRunningTask(), nullptr);
+
+    ASSERT_TRUE(waitForCompletion(executor));
+
+    EXPECT_FALSE(executor.taskCurrentlyRunning());
+    EXPECT_TRUE(executor.queue().isEmpty());
+
+    EXPECT_EQ(taskA->currentState(), GtProcessComponent::FINISHED);
+    EXPECT_EQ(taskB->currentState(), GtProcessComponent::FINISHED);
+
+    EXPECT_EQ(targetA->objectName(), QStringLiteral("Done"));
+    EXPECT_EQ(targetB->objectName(), QStringLiteral("Done"));
+}
+
+/// tasks sharing a linked object are executed one after another
+TEST_F(TestGtCoreProcessExecutor, tasksSharingDataAreSequential)
+{
+    TestConcurrentCalculator::expected() = 1;
+
+    GtProject project{QString{}};
+
+    GtObjectGroup* target{};
+    GtTask* taskA = appendTask(project, target);
+
+    auto* calc = new TestConcurrentCalculator;
+    calc->setTarget(target->uuid());
+
+    auto* taskB = new GtTask;
+    taskB->appendChild(calc);
+    project.appendChild(taskB);
+
+    GtCoreProcessExecutor executor{nullptr, gt::NonBlockingExecution};
+    executor.setMaxConcurrentTasks(2);
+
+    ASSERT_TRUE(executor.queueTask(taskA));
+    ASSERT_TRUE(executor.queueTask(taskB));
+    ASSERT_TRUE(executor.executeNextTask());
+
+    // the second task is postponed
+    EXPECT_TRUE(executor.taskCurrentlyRunning());
+    EXPECT_EQ(executor.currentRunningTask(), taskA);
+
+    ASSERT_TRUE(waitForCompletion(executor));
+
+    EXPECT_EQ(taskA->currentState(), GtProcessComponent::FINISHED);
+    EXPECT_EQ(taskB->currentState(), GtProcessComponent::FINISHED);
+    EXPECT_EQ(TestConcurrentCalculator::started(), 2);
+}
+
+TEST_F(TestGtCoreProcessExecutor, maxConcurrentTasksDefault)
+{
+    GtCoreProcessExecutor executor;
+
+    // without application preferences the tasks are executed sequentially
+    EXPECT_EQ(executor.maxConcurrentTasks(), 1);
+
+    executor.setMaxConcurrentTasks(4);
+    EXPECT_EQ(executor.maxConcurrentTasks(), 4);
+
+    executor.setMaxConcurrentTasks(0);
+    EXPECT_EQ(executor.maxConcurrentTasks(), 1);
+}
+
+/// by default the limit is taken from the application preferences
+TEST_F(TestGtCoreProcessExecutor, maxConcurrentTasksFromPreference)
+{
+    GtProject projectA{QString{}};
+    GtProject projectB{QString{}};
+
+    GtObjectGroup* targetA{};
+    GtObjectGroup* targetB{};
+
+    GtTask* taskA = appendTask(projectA, targetA);
+    GtTask* taskB = appendTask(projectB, targetB);
+
+    TestPreferenceProcessExecutor executor{nullptr, gt::NonBlockingExecution};
+    executor.preference = 2;
+    EXPECT_EQ(executor.maxConcurrentTasks(), 2);
+
+    ASSERT_TRUE(executor.queueTask(taskA));
+    ASSERT_TRUE(executor.queueTask(taskB));
+    ASSERT_TRUE(executor.executeNextTask());
+
+    ASSERT_TRUE(waitForCompletion(executor));
+
+    // the calculators only succeed if both tasks run at once
+    EXPECT_EQ(taskA->currentState(), GtProcessComponent::FINISHED);
+    EXPECT_EQ(taskB->currentState(), GtProcessComponent::FINISHED);
+    EXPECT_EQ(TestConcurrentCalculator::started(), 2);
+}
@@ -0,0 +1,120 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "gt_parameterloop.h"
+#include "gt_runnable.h"
+#include "gt_objectfactory.h"
+#include "gt_objectgroup.h"
+#include "gt_objectmemento.h"
+
+#include "test_gt_sweepcalculator.h"
+
+class TestGtParameterLoop : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        if (!gtObjectFactory->knownClass(GT_CLASSNAME(GtParameterLoop)))
+        {
+            gtObjectFactory->registerClass(GtParameterLoop::staticMetaObject);
+        }
+
+        if (!gtObjectFactory->knownClass(GT_CLASSNAME(TestSweepCalculator)))
+        {
+            gtObjectFactory->registerClass(
+                        TestSweepCalculator::staticMetaObject);
+        }
+
+        root.setObjectName("Root");
+
+        target = new GtObjectGroup;
+        target->setObjectName("Target");
+        root.appendChild(target);
+
+        loop = new GtParameterLoop;
+        loop->setFactory(gtObjectFactory);
+        loop->findProperty("start")->setValueFromVariant(0.0);
+        loop->findProperty("end")->setValueFromVariant(1.0);
+        loop->findProperty("steps")->setValueFromVariant(4);
+        loop->findProperty("parallel")->setValueFromVariant(true);
+
+        calc = new TestSweepCalculator;
+        calc->setTarget(target->uuid());
+        loop->appendChild(calc);
+
+        QObject::connect(loop, &GtTask::monitoringDataTransfer,
+                         [this](int iteration, GtMonitoringDataSet) {
+            iterations << iteration;
+        });
+
+        runnable.appendSourceData(root.toMemento());
+        runnable.appendProcessComponent(loop);
+    }
+
+    /// name of the target object in the output data
+    QString resultName() const
+    {
+        for (GtObjectMemento const& memento : runnable.outputData())
+        {
+            if (memento.uuid() == target->uuid()) return memento.ident();
+        }
+        return {};
+    }
+
+    GtObjectGroup root;
+    GtObjectGroup* target{};
+
+    GtRunnable runnable;
+    GtParameterLoop* loop{};
+    TestSweepCalculator* calc{};
+
+    /// iterations of the emitted monitoring data
+    QList<int> iterations;
+};
+
+/// monitoring data is emitted in order of the sweep points, the linked data
+/// of the last sweep point is kept
+TEST_F(TestGtParameterLoop, parallelSweep)
+{
+    runnable.run();
+
+    ASSERT_TRUE(runnable.successful());
+    EXPECT_EQ(loop->currentState(), GtProcessComponent::FINISHED);
+
+    EXPECT_EQ(iterations, (QList<int>{1, 2, 3, 4, 5}));
+
+    EXPECT_EQ(resultName(), QStringLiteral("Iteration 5"));
+}
+
+TEST_F(TestGtParameterLoop, parallelSweepFailsOnWarning)
+{
+    calc->setWarnAt(3);
+    calc->setFailOnWarning(true);
+
+    runnable.run();
+
+    EXPECT_FALSE(runnable.successful());
+    EXPECT_EQ(loop->currentState(), GtProcessComponent::FAILED);
+
+    // the sweep points are reported until the failed one
+    EXPECT_EQ(iterations, (QList<int>{1, 2, 3}));
+
+    EXPECT_TRUE(runnable.outputData().isEmpty());
+}
+
+/// a warning does not fail the sweep unless requested
+TEST_F(TestGtParameterLoop, parallelSweepWithWarning)
+{
+    calc->setWarnAt(3);
+
+    runnable.run();
+
+    ASSERT_TRUE(runnable.successful());
+    EXPECT_EQ(resultName(), QStringLiteral("Iteration 5"));
+}
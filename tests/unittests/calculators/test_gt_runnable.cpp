@@ -12,6 +12,13 @@
 #include "gtest/gtest.h"
 #include "gt_runnable.h"
 #include "gt_calculator.h"
+#include "gt_objectgroup.h"
+#include "gt_objectmemento.h"
+#include "gt_objectfactory.h"
+
+#include "datamodel/test_gt_object.h"
+
+#include <functional>
 
 class TestGtRunnable : public ::testing::Test
 {
@@ -28,6 +35,48 @@ protected:
     GtRunnable obj;
 };
 
+namespace
+{
+
+/// renames the target object, does nothing if no target is set
+class TestRenameCalculator : public GtCalculator
+{
+public:
+    QString targetUuid;
+
+    bool run() override
+    {
+        if (targetUuid.isEmpty())
+        {
+            return true;
+        }
+
+        GtObject* target = runnable()->data<GtObject*>(targetUuid);
+
+        if (!target)
+        {
+            return false;
+        }
+
+        target->setObjectName(QStringLiteral("Renamed"));
+        return true;
+    }
+};
+
+/// runs the given function
+class TestFunctionCalculator : public GtCalculator
+{
+public:
+    std::function<bool(GtAbstractRunnable&)> func;
+
+    bool run() override
+    {
+        return func(*runnable());
+    }
+};
+
+} // namespace
+
 //class TestCalculator : public GtCalculator
 //{
 //public:
@@ -46,3 +95,180 @@ protected:
 ////    ASSERT_FALSE(obj.appendCalculator(nullptr));
 ////    ASSERT_FALSE(obj.appendCalculator(&myCalc));
 //}
+
+TEST_F(TestGtRunnable, outputDataContainsChangedObjectsOnly)
+{
+    GtObjectGroup root;
+    root.setObjectName("Root");
+
+    auto* a = new GtObjectGroup;
+    a->setObjectName("A");
+    root.appendChild(a);
+
+    auto* b = new GtObjectGroup;
+    b->setObjectName("B");
+    root.appendChild(b);
+
+    auto* a1 = new GtObjectGroup;
+    a1->setObjectName("A1");
+    a->appendChild(a1);
+
+    obj.appendSourceData(root.toMemento());
+
+    auto* calc = new TestRenameCalculator;
+    calc->targetUuid = a1->uuid();
+    ASSERT_TRUE(obj.appendProcessComponent(calc));
+
+    obj.run();
+
+    ASSERT_TRUE(obj.successful());
+
+    // only the renamed object is transferred back
+    ASSERT_EQ(obj.outputData().size(), 1);
+    EXPECT_EQ(obj.outputData().first().uuid(), a1->uuid());
+    EXPECT_EQ(obj.outputData().first().ident(), QStringLiteral("Renamed"));
+}
+
+TEST_F(TestGtRunnable, outputDataEmptyWithoutChanges)
+{
+    GtObjectGroup root;
+    root.setObjectName("Root");
+    root.appendChild(new GtObjectGroup);
+
+    obj.appendSourceData(root.toMemento());
+
+    ASSERT_TRUE(obj.appendProcessComponent(new TestRenameCalculator));
+
+    obj.run();
+
+    ASSERT_TRUE(obj.successful());
+    EXPECT_TRUE(obj.outputData().isEmpty());
+}
+
+/// meta properties are changed without flagging the object as changed
+TEST_F(TestGtRunnable, outputDataContainsMetaPropertyChanges)
+{
+    if (!gtObjectFactory->knownClass("TestSpecialGtObject"))
+    {
+        gtObjectFactory->registerClass(TestSpecialGtObject::staticMetaObject);
+    }
+
+    GtObjectGroup root;
+    root.setObjectName("Root");
+    root.appendChild(new GtObjectGroup);
+
+    auto* special = new TestSpecialGtObject;
+    special->setObjectName("Special");
+    root.appendChild(special);
+
+    obj.appendSourceData(root.toMemento());
+
+    auto* calc = new TestFunctionCalculator;
+    calc->func = [uuid = special->uuid()](GtAbstractRunnable& runnable) {
+        auto* target = runnable.data<TestSpecialGtObject*>(uuid);
+        if (!target) return false;
+
+        target->setProperty("strList", QStringList{"changed"});
+        return true;
+    };
+    ASSERT_TRUE(obj.appendProcessComponent(calc));
+
+    obj.run();
+
+    ASSERT_TRUE(obj.successful());
+
+    ASSERT_EQ(obj.outputData().size(), 1);
+    EXPECT_EQ(obj.outputData().first().uuid(), special->uuid());
+}
+
+TEST_F(TestGtRunnable, outputDataContainsBothParentsOfMovedChild)
+{
+    GtObjectGroup root;
+    root.setObjectName("Root");
+
+    auto* a = new GtObjectGroup;
+    a->setObjectName("A");
+    root.appendChild(a);
+
+    auto* b = new GtObjectGroup;
+    b->setObjectName("B");
+    root.appendChild(b);
+
+    auto* c = new GtObjectGroup;
+    c->setObjectName("C");
+    root.appendChild(c);
+
+    auto* a1 = new GtObjectGroup;
+    a1->setObjectName("A1");
+    a->appendChild(a1);
+
+    obj.appendSourceData(root.toMemento());
+
+    auto* calc = new TestFunctionCalculator;
+    calc->func = [a1Uuid = a1->uuid(), bUuid = b->uuid()]
+                 (GtAbstractRunnable& runnable) {
+        auto* child = runnable.data<GtObject*>(a1Uuid);
+        auto* target = runnable.data<GtObject*>(bUuid);
+        if (!child || !target) return false;
+
+        return target->appendChild(child);
+    };
+    ASSERT_TRUE(obj.appendProcessComponent(calc));
+
+    obj.run();
+
+    ASSERT_TRUE(obj.successful());
+
+    QStringList uuids;
+    for (GtObjectMemento const& m : obj.outputData())
+    {
+        uuids << m.uuid();
+    }
+    uuids.sort();
+
+    QStringList expected{a->uuid(), b->uuid()};
+    expected.sort();
+
+    // the child is removed from its old parent and added to the new one
+    EXPECT_EQ(uuids, expected);
+}
+
+/// removing a child without deleting it does not flag the parent as changed
+TEST_F(TestGtRunnable, outputDataContainsParentOfDetachedChild)
+{
+    GtObjectGroup root;
+    root.setObjectName("Root");
+
+    auto* a = new GtObjectGroup;
+    a->setObjectName("A");
+    root.appendChild(a);
+
+    auto* b = new GtObjectGroup;
+    b->setObjectName("B");
+    root.appendChild(b);
+
+    auto* a1 = new GtObjectGroup;
+    a1->setObjectName("A1");
+    a->appendChild(a1);
+
+    obj.appendSourceData(root.toMemento());
+
+    auto* calc = new TestFunctionCalculator;
+    calc->func = [a1Uuid = a1->uuid()](GtAbstractRunnable& runnable) {
+        auto* child = runnable.data<GtObject*>(a1Uuid);
+        if (!child) return false;
+
+        child->disconnectFromParent();
+        delete child;
+        return true;
+    };
+    ASSERT_TRUE(obj.appendProcessComponent(calc));
+
+    obj.run();
+
+    ASSERT_TRUE(obj.successful());
+
+    ASSERT_EQ(obj.outputData().size(), 1);
+    EXPECT_EQ(obj.outputData().first().uuid(), a->uuid());
+    EXPECT_TRUE(obj.outputData().first().childObjects.isEmpty());
+}
@@ -0,0 +1,64 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef TEST_GT_SWEEPCALCULATOR_H
+#define TEST_GT_SWEEPCALCULATOR_H
+
+#include "gt_calculator.h"
+#include "gt_task.h"
+#include "gt_intproperty.h"
+#include "gt_objectlinkproperty.h"
+
+/**
+ * @brief Calculator renaming the linked object after the current iteration
+ * of the parent task. Finishes with a warning in the given iteration.
+ */
+class TestSweepCalculator : public GtCalculator
+{
+    Q_OBJECT
+
+public:
+
+    Q_INVOKABLE TestSweepCalculator() :
+        m_target("target", "Target", "Target object", {}, this, {}),
+        m_warnAt("warnAt", "Warn at", "Iteration with a warning", -1)
+    {
+        registerProperty(m_target);
+        registerProperty(m_warnAt);
+    }
+
+    void setTarget(QString const& uuid) { m_target.setVal(uuid); }
+
+    void setWarnAt(int iteration) { m_warnAt.setVal(iteration); }
+
+    void setFailOnWarning(bool val)
+    {
+        findProperty(QStringLiteral("failOnWarn"))->setValueFromVariant(val);
+    }
+
+    bool run() override
+    {
+        auto* task = findParent<GtTask*>();
+        GtObject* target = data(m_target);
+
+        if (!task || !target) return false;
+
+        int iteration = task->currentIterationStep();
+        target->setObjectName(QStringLiteral("Iteration %1").arg(iteration));
+
+        if (iteration == m_warnAt) setWarningFlag(true);
+
+        return true;
+    }
+
+private:
+
+    GtObjectLinkProperty m_target;
+
+    GtIntProperty m_warnAt;
+};
+
+#endif // TEST_GT_SWEEPCALCULATOR_H
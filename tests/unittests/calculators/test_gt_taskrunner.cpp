@@ -0,0 +1,131 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "gt_taskrunner.h"
+#include "gt_task.h"
+#include "gt_calculator.h"
+#include "gt_objectgroup.h"
+#include "gt_objectlinkproperty.h"
+
+namespace
+{
+
+/// calculator linking two objects
+class TestLinkCalculator : public GtCalculator
+{
+public:
+
+    TestLinkCalculator() :
+        first("first", "First", "First link", {}, this, {}),
+        second("second", "Second", "Second link", {}, this, {})
+    {
+        registerProperty(first);
+        registerProperty(second);
+    }
+
+    bool run() override { return true; }
+
+    void requireFullSourceData() { setRequiresFullSourceData(true); }
+
+    GtObjectLinkProperty first;
+    GtObjectLinkProperty second;
+};
+
+} // namespace
+
+class TestGtTaskRunner : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        root.setObjectName("Root");
+
+        p = new GtObjectGroup;
+        p->setObjectName("P");
+        root.appendChild(p);
+
+        a = new GtObjectGroup;
+        a->setObjectName("A");
+        p->appendChild(a);
+
+        a1 = new GtObjectGroup;
+        a1->setObjectName("A1");
+        a->appendChild(a1);
+
+        q = new GtObjectGroup;
+        q->setObjectName("Q");
+        root.appendChild(q);
+
+        calc = new TestLinkCalculator;
+        task.appendChild(calc);
+    }
+
+    GtObjectGroup root;
+    GtObjectGroup* p{};
+    GtObjectGroup* a{};
+    GtObjectGroup* a1{};
+    GtObjectGroup* q{};
+
+    GtTask task;
+    TestLinkCalculator* calc{};
+};
+
+/// linked objects within another linked object are part of its snapshot
+TEST_F(TestGtTaskRunner, nestedLinksAreNoSeparateRoots)
+{
+    // the nested object is discovered first
+    calc->first.setVal(a1->uuid());
+    calc->second.setVal(a->uuid());
+
+    auto data = GtTaskRunner::collectSourceData(task, root);
+
+    ASSERT_EQ(data.size(), 1);
+    EXPECT_EQ(data.first(), a);
+}
+
+TEST_F(TestGtTaskRunner, independentLinks)
+{
+    calc->first.setVal(a1->uuid());
+    calc->second.setVal(q->uuid());
+
+    auto data = GtTaskRunner::collectSourceData(task, root);
+
+    ASSERT_EQ(data.size(), 2);
+    EXPECT_EQ(data.at(0), a1);
+    EXPECT_EQ(data.at(1), q);
+}
+
+TEST_F(TestGtTaskRunner, fullSourceData)
+{
+    calc->requireFullSourceData();
+
+    auto data = GtTaskRunner::collectSourceData(task, root);
+
+    ASSERT_EQ(data.size(), 2);
+    EXPECT_EQ(data.at(0), p);
+    EXPECT_EQ(data.at(1), q);
+}
+
+/// the user may request the full source data for process components, which
+/// access objects they do not reference
+TEST_F(TestGtTaskRunner, fullSourceDataRequestedByTask)
+{
+    calc->first.setVal(a1->uuid());
+
+    GtAbstractProperty* prop = task.findProperty("fullSourceData");
+    ASSERT_TRUE(prop);
+    ASSERT_TRUE(prop->setValueFromVariant(true));
+    EXPECT_TRUE(task.fullSourceDataRequested());
+
+    auto data = GtTaskRunner::collectSourceData(task, root);
+
+    ASSERT_EQ(data.size(), 2);
+    EXPECT_EQ(data.at(0), p);
+    EXPECT_EQ(data.at(1), q);
+}
@@ -13,6 +13,13 @@
 
 #include "gt_coredatamodel.h"
 #include "gt_object.h"
+#include "gt_objectgroup.h"
+#include "gt_objectmemento.h"
+
+#include <QDomDocument>
+#include <QMimeData>
+
+#include <memory>
 
 class TestCoreDataModel : public GtCoreDatamodel
 {
@@ -105,3 +112,48 @@ TEST_F(TestGtCoreDataModel, makeUnqiueName_null_parent)
     auto newName = gt::makeUniqueName("Test", nullptr);
     EXPECT_EQ(newName.toStdString(), "Test");
 }
+
+/// object data is provided in the binary format and in the xml format for
+/// other applications
+TEST_F(TestGtCoreDataModel, mimeDataFromObject)
+{
+    GtObjectGroup obj;
+    obj.setObjectName("Group");
+    obj.appendChild(new GtObjectGroup);
+
+    std::unique_ptr<QMimeData> mime{m_model->mimeDataFromObject(&obj)};
+    ASSERT_TRUE(mime);
+
+    EXPECT_TRUE(mime->hasFormat("GtObjectBinary"));
+    EXPECT_TRUE(mime->hasFormat("GtObject"));
+    EXPECT_TRUE(mime->formats().contains("GtObject"));
+
+    // the xml format is readable by older versions
+    QByteArray xml = mime->data("GtObject");
+    QDomDocument document;
+    EXPECT_TRUE(document.setContent(xml));
+
+    GtObjectMemento xmlMemento(xml);
+    ASSERT_FALSE(xmlMemento.isNull());
+    EXPECT_EQ(xmlMemento.uuid(), obj.uuid());
+
+    GtObjectMemento memento = GtCoreDatamodel::mementoFromMimeData(mime.get());
+    ASSERT_FALSE(memento.isNull());
+    EXPECT_EQ(memento.uuid(), obj.uuid());
+    EXPECT_EQ(memento.childObjects.size(), 1);
+}
+
+/// mime data of older versions only provides the xml format
+TEST_F(TestGtCoreDataModel, mementoFromXmlMimeData)
+{
+    GtObjectGroup obj;
+
+    QMimeData mime;
+    mime.setData("GtObject", obj.toMemento().toByteArray());
+
+    GtObjectMemento memento = GtCoreDatamodel::mementoFromMimeData(&mime);
+    ASSERT_FALSE(memento.isNull());
+    EXPECT_EQ(memento.uuid(), obj.uuid());
+
+    EXPECT_TRUE(GtCoreDatamodel::mementoFromMimeData(nullptr).isNull());
+}
@@ -0,0 +1,169 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "gt_logmodel.h"
+
+#include <QStringList>
+
+#include <vector>
+
+namespace
+{
+
+/// row signal emitted by the model
+struct RowSignal
+{
+    /// 'i' for inserted rows, 'r' for removed rows
+    char type;
+    int first;
+    int last;
+
+    bool operator==(RowSignal const& other) const
+    {
+        return type == other.type && first == other.first &&
+               last == other.last;
+    }
+};
+
+} // namespace
+
+class TestGtLogModel : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        // messages logged during the test must not be inserted
+        model.setEnabled(false);
+        insertQueue();
+        model.clearLog();
+
+        QObject::connect(&model, &GtLogModel::rowsInserted, &context,
+                         [this](QModelIndex const&, int first, int last) {
+            rowSignals.push_back({'i', first, last});
+        });
+        QObject::connect(&model, &GtLogModel::rowsRemoved, &context,
+                         [this](QModelIndex const&, int first, int last) {
+            rowSignals.push_back({'r', first, last});
+        });
+    }
+
+    void TearDown() override
+    {
+        insertQueue();
+        model.clearLog();
+        model.setMaxLogLength(2000);
+        model.setEnabled(true);
+    }
+
+    /// queues the messages and inserts them as a single batch
+    void insert(QString const& prefix, int from, int to)
+    {
+        for (int i = from; i <= to; ++i)
+        {
+            model.onMessage(prefix + QString::number(i), 0, GtLogDetails{});
+        }
+        insertQueue();
+    }
+
+    void insertQueue()
+    {
+        QMetaObject::invokeMethod(&model, "insertQueue", Qt::DirectConnection);
+    }
+
+    /// messages of all rows
+    QStringList messages() const
+    {
+        QStringList list;
+        for (int row = 0; row < model.rowCount(); ++row)
+        {
+            list << model.index(row, 0).data(GtLogModel::MessageRole)
+                        .toString();
+        }
+        return list;
+    }
+
+    GtLogModel& model{GtLogModel::instance()};
+
+    /// receiver of the row signals, disconnects them after each test
+    QObject context;
+
+    std::vector<RowSignal> rowSignals;
+};
+
+/// Messages of a batch exceeding the capacity replace the oldest rows, the
+/// messages of the batch exceeding the capacity are skipped
+TEST_F(TestGtLogModel, overflowWithinBatch)
+{
+    model.setMaxLogLength(5);
+
+    insert("a", 0, 2);
+    EXPECT_EQ(rowSignals, (std::vector<RowSignal>{{'i', 0, 2}}));
+
+    rowSignals.clear();
+    insert("b", 0, 7);
+
+    EXPECT_EQ(rowSignals, (std::vector<RowSignal>{{'r', 0, 2}, {'i', 0, 4}}));
+    EXPECT_EQ(messages(), (QStringList{"b3", "b4", "b5", "b6", "b7"}));
+
+    rowSignals.clear();
+    insert("c", 0, 3);
+
+    EXPECT_EQ(rowSignals, (std::vector<RowSignal>{{'r', 0, 3}, {'i', 1, 4}}));
+    EXPECT_EQ(messages(), (QStringList{"b7", "c0", "c1", "c2", "c3"}));
+}
+
+/// Contiguous rows are removed at once, starting with the last range
+TEST_F(TestGtLogModel, removeNonContiguousRows)
+{
+    model.setMaxLogLength(10);
+
+    insert("m", 0, 9);
+    rowSignals.clear();
+
+    QModelIndexList indexes;
+    for (int row : {8, 1, 5, 2, 7})
+    {
+        // an index is listed for each column
+        for (int col = 0; col < model.columnCount(); ++col)
+        {
+            indexes << model.index(row, col);
+        }
+    }
+
+    model.removeElementList(indexes);
+
+    EXPECT_EQ(rowSignals, (std::vector<RowSignal>{
+                           {'r', 7, 8}, {'r', 5, 5}, {'r', 1, 2}}));
+    EXPECT_EQ(messages(), (QStringList{"m0", "m3", "m4", "m6", "m9"}));
+}
+
+/// Shrinking the capacity removes the oldest rows
+TEST_F(TestGtLogModel, shrinkCapacity)
+{
+    model.setMaxLogLength(10);
+
+    insert("m", 0, 7);
+    rowSignals.clear();
+
+    // invalid lengths are ignored
+    model.setMaxLogLength(0);
+    EXPECT_EQ(model.rowCount(), 8);
+    EXPECT_TRUE(rowSignals.empty());
+
+    model.setMaxLogLength(3);
+
+    EXPECT_EQ(rowSignals, (std::vector<RowSignal>{{'r', 0, 4}}));
+    EXPECT_EQ(messages(), (QStringList{"m5", "m6", "m7"}));
+
+    rowSignals.clear();
+    insert("n", 0, 0);
+
+    EXPECT_EQ(rowSignals, (std::vector<RowSignal>{{'r', 0, 0}, {'i', 2, 2}}));
+    EXPECT_EQ(messages(), (QStringList{"m6", "m7", "n0"}));
+}
@@ -0,0 +1,152 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "internal/gt_modulemetacache.h"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QTemporaryDir>
+
+using gt::detail::ModuleMetaCache;
+
+namespace
+{
+
+bool writeFile(QString const& path, QByteArray const& data)
+{
+    QFile file(path);
+    return file.open(QIODevice::WriteOnly) && file.write(data) == data.size();
+}
+
+} // namespace
+
+class TestGtModuleMetaCache : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        ASSERT_TRUE(dir.isValid());
+
+        cacheFile = dir.filePath(QStringLiteral("cache/modules.json"));
+        libA = dir.filePath(QStringLiteral("libA.so"));
+        libB = dir.filePath(QStringLiteral("libB.so"));
+
+        ASSERT_TRUE(writeFile(libA, "not a plugin"));
+        ASSERT_TRUE(writeFile(libB, "not a plugin either"));
+    }
+
+    QTemporaryDir dir;
+    QString cacheFile, libA, libB;
+};
+
+TEST_F(TestGtModuleMetaCache, readAndReuse)
+{
+    {
+        ModuleMetaCache cache(cacheFile);
+
+        auto meta = cache.metaData({libA, libB});
+        EXPECT_EQ(meta.size(), 2u);
+        EXPECT_EQ(cache.hits(), 0);
+        EXPECT_EQ(cache.misses(), 2);
+
+        // invalid plugins have no meta data
+        EXPECT_TRUE(meta[libA].isEmpty());
+
+        ASSERT_TRUE(cache.save());
+        EXPECT_TRUE(QFile::exists(cacheFile));
+    }
+
+    ModuleMetaCache cache(cacheFile);
+
+    auto meta = cache.metaData({libA, libB});
+    EXPECT_EQ(meta.size(), 2u);
+    EXPECT_EQ(cache.hits(), 2);
+    EXPECT_EQ(cache.misses(), 0);
+}
+
+/// Entries of modified or removed libraries are invalid
+TEST_F(TestGtModuleMetaCache, invalidate)
+{
+    {
+        ModuleMetaCache cache(cacheFile);
+        cache.metaData({libA, libB});
+        ASSERT_TRUE(cache.save());
+    }
+
+    ASSERT_TRUE(writeFile(libA, "modified library"));
+    ASSERT_TRUE(QFile::remove(libB));
+
+    {
+        ModuleMetaCache cache(cacheFile);
+
+        auto meta = cache.metaData({libA});
+        EXPECT_EQ(meta.size(), 1u);
+        EXPECT_EQ(cache.hits(), 0);
+        EXPECT_EQ(cache.misses(), 1);
+        ASSERT_TRUE(cache.save());
+    }
+
+    // libB was removed from the cache
+    QFile file(cacheFile);
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+    QByteArray content = file.readAll();
+    EXPECT_TRUE(content.contains(libA.toUtf8()));
+    EXPECT_FALSE(content.contains(libB.toUtf8()));
+}
+
+/// Entries of existing libraries, which are not listed (e.g. of another
+/// module directory sharing the cache), are kept
+TEST_F(TestGtModuleMetaCache, keepUnlistedLibraries)
+{
+    {
+        ModuleMetaCache cache(cacheFile);
+        cache.metaData({libA, libB});
+        ASSERT_TRUE(cache.save());
+    }
+
+    {
+        ModuleMetaCache cache(cacheFile);
+        cache.metaData({libA});
+        ASSERT_TRUE(cache.save());
+    }
+
+    ModuleMetaCache cache(cacheFile);
+    cache.metaData({libA, libB});
+    EXPECT_EQ(cache.hits(), 2);
+    EXPECT_EQ(cache.misses(), 0);
+}
+
+TEST_F(TestGtModuleMetaCache, corruptedCacheFile)
+{
+    QDir().mkpath(QFileInfo(cacheFile).absolutePath());
+    ASSERT_TRUE(writeFile(cacheFile, "{ invalid json"));
+
+    ModuleMetaCache cache(cacheFile);
+
+    auto meta = cache.metaData({libA, libB});
+    EXPECT_EQ(meta.size(), 2u);
+    EXPECT_EQ(cache.misses(), 2);
+    EXPECT_TRUE(cache.save());
+}
+
+TEST_F(TestGtModuleMetaCache, cacheDirOverride)
+{
+    QByteArray const var = ModuleMetaCache::S_CACHE_DIR_ENV_VAR;
+
+    ASSERT_TRUE(qputenv(var.constData(), dir.path().toLocal8Bit()));
+
+    QFileInfo info(ModuleMetaCache::defaultCacheFilePath());
+    EXPECT_EQ(info.absolutePath(), QFileInfo(dir.path()).absoluteFilePath());
+
+    qunsetenv(var.constData());
+
+    EXPECT_NE(QFileInfo(ModuleMetaCache::defaultCacheFilePath()).absolutePath(),
+              QFileInfo(dir.path()).absoluteFilePath());
+}
@@ -0,0 +1,156 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "gt_monitoringdatatable.h"
+
+#include <cmath>
+
+class TestGtMonitoringDataTable : public testing::Test
+{
+protected:
+
+    static GtMonitoringDataSet makeDataSet(const QVariant& residual,
+                                           const QVariant& count)
+    {
+        GtMonitoringData data;
+        if (residual.isValid()) data.addData("residual", residual);
+        if (count.isValid()) data.addData("count", count);
+
+        GtMonitoringDataSet set;
+        set.insert("comp", data);
+        return set;
+    }
+};
+
+TEST_F(TestGtMonitoringDataTable, append)
+{
+    GtMonitoringDataTable table;
+
+    EXPECT_FALSE(table.append(0, makeDataSet(1.0, 1)));
+
+    EXPECT_TRUE(table.append(1, makeDataSet(1.0, 1)));
+    EXPECT_TRUE(table.append(2, makeDataSet(0.5, 2)));
+    // iteration 3 is missing
+    EXPECT_TRUE(table.append(4, makeDataSet(0.25, {})));
+
+    // iterations must be increasing
+    EXPECT_FALSE(table.append(4, makeDataSet(0.1, 5)));
+
+    EXPECT_EQ(table.size(), 4);
+
+    const auto* residual = table.column("comp", "residual");
+    ASSERT_TRUE(residual);
+    EXPECT_EQ(residual->type(), GtMonitoringDataTable::Column::Double);
+    ASSERT_EQ(residual->doubles().size(), 4);
+    EXPECT_DOUBLE_EQ(residual->doubles()[0], 1.0);
+    EXPECT_DOUBLE_EQ(residual->doubles()[1], 0.5);
+    EXPECT_TRUE(std::isnan(residual->doubles()[2]));
+    EXPECT_DOUBLE_EQ(residual->doubles()[3], 0.25);
+
+    const auto* count = table.column("comp", "count");
+    ASSERT_TRUE(count);
+    EXPECT_EQ(count->type(), GtMonitoringDataTable::Column::Int);
+    EXPECT_EQ(count->size(), 4);
+    EXPECT_EQ(count->ints()[1], 2);
+    EXPECT_FALSE(count->hasValue(2));
+    EXPECT_FALSE(count->hasValue(3));
+
+    EXPECT_EQ(table.column("comp", "unknown"), nullptr);
+
+    table.clear();
+    EXPECT_EQ(table.size(), 0);
+    EXPECT_EQ(table.column("comp", "residual"), nullptr);
+}
+
+TEST_F(TestGtMonitoringDataTable, getData)
+{
+    GtMonitoringDataTable table;
+
+    ASSERT_TRUE(table.append(1, makeDataSet(1.0, 1)));
+    ASSERT_TRUE(table.append(3, makeDataSet(0.5, 3)));
+
+    QVector<QVariant> residual = table.getData("comp", "residual");
+    ASSERT_EQ(residual.size(), 3);
+    EXPECT_EQ(residual[0], QVariant(1.0));
+    EXPECT_FALSE(residual[1].isValid());
+    EXPECT_EQ(residual[2], QVariant(0.5));
+
+    QVector<QVariant> unknown = table.getData("other", "residual");
+    ASSERT_EQ(unknown.size(), 3);
+    EXPECT_FALSE(unknown[0].isValid());
+}
+
+/// Columns are promoted if values of a different type are appended
+TEST_F(TestGtMonitoringDataTable, promoteColumn)
+{
+    GtMonitoringDataTable table;
+
+    ASSERT_TRUE(table.append(1, makeDataSet({}, 1)));
+    ASSERT_TRUE(table.append(2, makeDataSet({}, 2.5)));
+
+    const auto* count = table.column("comp", "count");
+    ASSERT_TRUE(count);
+    EXPECT_EQ(count->type(), GtMonitoringDataTable::Column::Double);
+    EXPECT_DOUBLE_EQ(count->doubles()[0], 1.0);
+    EXPECT_DOUBLE_EQ(count->doubles()[1], 2.5);
+    EXPECT_TRUE(count->ints().isEmpty());
+
+    ASSERT_TRUE(table.append(3, makeDataSet({}, QString("text"))));
+
+    count = table.column("comp", "count");
+    ASSERT_TRUE(count);
+    EXPECT_EQ(count->type(), GtMonitoringDataTable::Column::Variant);
+    EXPECT_EQ(count->value(0), QVariant(1.0));
+    EXPECT_EQ(count->value(2), QVariant("text"));
+    EXPECT_TRUE(std::isnan(count->toDouble(2)));
+    EXPECT_TRUE(count->doubles().isEmpty());
+}
+
+/// Values are converted to the storage type of the column, 64 bit integers
+/// keep their precision
+TEST_F(TestGtMonitoringDataTable, storageTypeConversion)
+{
+    GtMonitoringDataTable table;
+
+    // not representable by a double
+    const qlonglong big = (qlonglong{1} << 53) + 1;
+
+    ASSERT_TRUE(table.append(1, makeDataSet(1.5f, big)));
+    ASSERT_TRUE(table.append(2, makeDataSet(2u, 3)));
+
+    const auto* residual = table.column("comp", "residual");
+    ASSERT_TRUE(residual);
+    EXPECT_EQ(residual->type(), GtMonitoringDataTable::Column::Double);
+    // float and unsigned int values are returned as double
+    EXPECT_EQ(residual->value(0), QVariant(1.5));
+    EXPECT_EQ(residual->value(0).userType(), QMetaType::Double);
+    EXPECT_EQ(residual->value(1), QVariant(2.0));
+
+    const auto* count = table.column("comp", "count");
+    ASSERT_TRUE(count);
+    EXPECT_EQ(count->type(), GtMonitoringDataTable::Column::Variant);
+    EXPECT_EQ(count->value(0).userType(), QMetaType::LongLong);
+    EXPECT_EQ(count->value(0).toLongLong(), big);
+    EXPECT_EQ(count->value(1), QVariant(3));
+
+    QVector<QVariant> data = table.getData("comp", "count");
+    ASSERT_EQ(data.size(), 2);
+    EXPECT_EQ(data[0].toLongLong(), big);
+
+    // booleans are returned as int
+    GtMonitoringDataSet set;
+    GtMonitoringData flags;
+    flags.addData("converged", true);
+    set.insert("comp", flags);
+    ASSERT_TRUE(table.append(3, set));
+
+    const auto* converged = table.column("comp", "converged");
+    ASSERT_TRUE(converged);
+    EXPECT_EQ(converged->type(), GtMonitoringDataTable::Column::Int);
+    EXPECT_EQ(converged->value(2), QVariant(1));
+}
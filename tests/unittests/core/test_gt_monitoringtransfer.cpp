@@ -0,0 +1,102 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "gt_task.h"
+#include "gt_doublemonitoringproperty.h"
+#include "internal/gt_monitoringtransfer.h"
+
+namespace
+{
+
+class TestMonitoringTask : public GtTask
+{
+public:
+
+    TestMonitoringTask() :
+        m_residual(QStringLiteral("residual"), QStringLiteral("Residual"))
+    {
+        registerMonitoringProperty(m_residual);
+    }
+
+    /// sets the residual and triggers a transfer of the monitoring data
+    void iterate(int iteration, double residual)
+    {
+        m_residual = residual;
+        emit transferMonitoringProperties();
+
+        GtMonitoringData data;
+        data.addData(QStringLiteral("residual"), residual);
+
+        GtMonitoringDataSet set;
+        set.insert(QStringLiteral("task"), data);
+
+        emit monitoringDataTransfer(iteration, set);
+    }
+
+    GtDoubleMonitoringProperty m_residual;
+};
+
+} // namespace
+
+class TestGtMonitoringTransfer : public testing::Test
+{
+protected:
+
+    TestMonitoringTask orig;
+    TestMonitoringTask cloned;
+    gt::detail::MonitoringTransfer transfer;
+};
+
+/// Monitoring data is only transferred on flush, property updates are
+/// coalesced and data sets are appended at once
+TEST_F(TestGtMonitoringTransfer, flush)
+{
+    transfer.registerComponent(cloned, orig);
+
+    int available = 0;
+    QObject::connect(&orig, &GtTask::monitoringDataAvailable,
+                     [&available]() { ++available; });
+
+    for (int i = 1; i <= 10; ++i)
+    {
+        cloned.iterate(i, 1.0 / i);
+    }
+
+    // nothing transferred yet
+    EXPECT_DOUBLE_EQ(orig.m_residual.getVal(), 0.0);
+    EXPECT_EQ(orig.monitoringDataSize(), 0);
+
+    transfer.flush();
+
+    EXPECT_DOUBLE_EQ(orig.m_residual.getVal(), 0.1);
+    EXPECT_EQ(orig.monitoringDataSize(), 10);
+    EXPECT_EQ(available, 1);
+
+    // nothing pending
+    transfer.flush();
+    EXPECT_EQ(available, 1);
+}
+
+/// Clearing the monitoring data discards data sets that are pending
+TEST_F(TestGtMonitoringTransfer, clearMonitoringData)
+{
+    transfer.registerComponent(cloned, orig);
+
+    cloned.iterate(1, 1.0);
+    transfer.flush();
+    ASSERT_EQ(orig.monitoringDataSize(), 1);
+
+    cloned.iterate(2, 0.5);
+    emit cloned.triggerClearMonitoringData();
+    cloned.iterate(1, 0.25);
+
+    transfer.stop();
+
+    EXPECT_EQ(orig.monitoringDataSize(), 1);
+    EXPECT_DOUBLE_EQ(orig.m_residual.getVal(), 0.25);
+}
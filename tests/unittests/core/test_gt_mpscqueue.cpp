@@ -0,0 +1,69 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "internal/gt_mpscqueue.h"
+
+#include <thread>
+
+using gt::detail::MpscQueue;
+
+TEST(TestGtMpscQueue, order)
+{
+    MpscQueue<int> queue;
+    EXPECT_TRUE(queue.empty());
+
+    EXPECT_TRUE(queue.push(1));
+    EXPECT_FALSE(queue.push(2));
+    EXPECT_FALSE(queue.push(3));
+
+    EXPECT_EQ(queue.takeAll(), (std::vector<int>{1, 2, 3}));
+    EXPECT_TRUE(queue.empty());
+    EXPECT_TRUE(queue.takeAll().empty());
+}
+
+/// elements of each producer are taken in order of their insertion
+TEST(TestGtMpscQueue, multipleProducers)
+{
+    constexpr int nProducers = 4;
+    constexpr int nElements = 10000;
+
+    MpscQueue<int> queue;
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < nProducers; ++p)
+    {
+        producers.emplace_back([&queue, p](){
+            for (int i = 0; i < nElements; ++i)
+            {
+                queue.push(p * nElements + i);
+            }
+        });
+    }
+
+    std::vector<int> last(nProducers, -1);
+    int taken = 0;
+    bool ordered = true;
+
+    while (taken < nProducers * nElements)
+    {
+        for (int value : queue.takeAll())
+        {
+            int p = value / nElements;
+            int i = value % nElements;
+
+            ordered &= i > last[p];
+            last[p] = i;
+            taken += 1;
+        }
+    }
+
+    for (auto& producer : producers) producer.join();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(queue.empty());
+}
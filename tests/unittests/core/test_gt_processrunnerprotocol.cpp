@@ -0,0 +1,126 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "gt_processrunnerprotocol.h"
+
+using namespace gt::process_runner;
+
+TEST(TestGtProcessRunnerProtocol, makeFrame)
+{
+    QByteArray frame = makeFrame("payload");
+
+    ASSERT_EQ(frame.size(), S_FRAME_HEADER_SIZE + 7);
+    EXPECT_EQ(frame.left(4), QByteArray("GTPR"));
+    EXPECT_EQ(frame.mid(S_FRAME_HEADER_SIZE), QByteArray("payload"));
+}
+
+/// Frames are reassembled from chunks of arbitrary size
+TEST(TestGtProcessRunnerProtocol, readChunked)
+{
+    QByteArray data = makeFrame("first") + makeFrame(QByteArray(1000, 'x')) +
+                      makeFrame({});
+
+    FrameReader reader;
+    Frame frame;
+    QList<QByteArray> payloads;
+
+    for (int i = 0; i < data.size(); i += 7)
+    {
+        reader.append(data.mid(i, 7));
+
+        FrameReader::Status status;
+        while ((status = reader.next(frame)) == FrameReader::FrameAvailable)
+        {
+            EXPECT_EQ(frame.type, MementoPayload);
+            payloads.append(QByteArray(frame.payload.constData(),
+                                       frame.payload.size()));
+        }
+        ASSERT_EQ(status, FrameReader::Incomplete);
+    }
+
+    ASSERT_EQ(payloads.size(), 3);
+    EXPECT_EQ(payloads[0], QByteArray("first"));
+    EXPECT_EQ(payloads[1], QByteArray(1000, 'x'));
+    EXPECT_TRUE(payloads[2].isEmpty());
+    EXPECT_EQ(reader.bufferedSize(), 0);
+}
+
+/// Frames prepending the size as ASCII digits are still accepted
+TEST(TestGtProcessRunnerProtocol, readLegacy)
+{
+    FrameReader reader;
+    Frame frame;
+
+    reader.append("1");
+    EXPECT_EQ(reader.next(frame), FrameReader::Incomplete);
+
+    reader.append("2hello");
+    EXPECT_EQ(reader.next(frame), FrameReader::Incomplete);
+
+    reader.append(" world!");
+    ASSERT_EQ(reader.next(frame), FrameReader::FrameAvailable);
+    EXPECT_EQ(frame.payload, QByteArray("hello world!"));
+    EXPECT_EQ(reader.next(frame), FrameReader::Incomplete);
+}
+
+TEST(TestGtProcessRunnerProtocol, readInvalid)
+{
+    FrameReader reader;
+    Frame frame;
+
+    reader.append("invalid frame data");
+    EXPECT_EQ(reader.next(frame), FrameReader::Error);
+    EXPECT_FALSE(reader.errorString().isEmpty());
+
+    reader.clear();
+    EXPECT_EQ(reader.bufferedSize(), 0);
+
+    // unknown version
+    QByteArray data = makeFrame("payload");
+    data[4] = char(S_FRAME_VERSION + 1);
+
+    reader.append(data);
+    EXPECT_EQ(reader.next(frame), FrameReader::Error);
+}
+
+/// Frames announcing a length above the limit are rejected before the
+/// payload is received
+TEST(TestGtProcessRunnerProtocol, readOversized)
+{
+    FrameReader reader;
+    Frame frame;
+
+    EXPECT_EQ(reader.maxFrameSize(), S_MAX_FRAME_SIZE);
+
+    // forged header announcing ~2 GB of payload
+    QByteArray data = makeFrame({});
+    data[8] = char(0x7f);
+    data[9] = char(0xff);
+    data[10] = char(0xff);
+    data[11] = char(0x00);
+
+    reader.append(data);
+    EXPECT_EQ(reader.next(frame), FrameReader::Error);
+    EXPECT_FALSE(reader.errorString().isEmpty());
+
+    reader.clear();
+    reader.setMaxFrameSize(S_FRAME_HEADER_SIZE + 10);
+
+    reader.append(makeFrame(QByteArray(10, 'x')));
+    EXPECT_EQ(reader.next(frame), FrameReader::FrameAvailable);
+
+    reader.append(makeFrame(QByteArray(11, 'x')));
+    EXPECT_EQ(reader.next(frame), FrameReader::Error);
+
+    // previous protocol version
+    reader.clear();
+    reader.append("2000000000");
+    EXPECT_EQ(reader.next(frame), FrameReader::Incomplete);
+    reader.append("x");
+    EXPECT_EQ(reader.next(frame), FrameReader::Error);
+}
@@ -0,0 +1,94 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "internal/gt_ringbuffer.h"
+
+#include <QString>
+
+using gt::detail::RingBuffer;
+
+namespace
+{
+
+std::vector<int> toVector(RingBuffer<int> const& buffer)
+{
+    std::vector<int> values;
+    for (size_t i = 0; i < buffer.size(); ++i)
+    {
+        values.push_back(buffer[i]);
+    }
+    return values;
+}
+
+} // namespace
+
+TEST(TestGtRingBuffer, overwriteOldest)
+{
+    RingBuffer<int> buffer(3);
+    EXPECT_TRUE(buffer.empty());
+
+    for (int i = 0; i < 5; ++i) buffer.push_back(i);
+
+    EXPECT_TRUE(buffer.full());
+    EXPECT_EQ(toVector(buffer), (std::vector<int>{2, 3, 4}));
+}
+
+TEST(TestGtRingBuffer, popFront)
+{
+    RingBuffer<int> buffer(4);
+    for (int i = 0; i < 6; ++i) buffer.push_back(i);
+
+    buffer.pop_front(3);
+    EXPECT_EQ(toVector(buffer), (std::vector<int>{5}));
+
+    buffer.push_back(6);
+    buffer.push_back(7);
+    EXPECT_EQ(toVector(buffer), (std::vector<int>{5, 6, 7}));
+
+    buffer.pop_front(10);
+    EXPECT_TRUE(buffer.empty());
+}
+
+TEST(TestGtRingBuffer, erase)
+{
+    RingBuffer<int> buffer(5);
+    for (int i = 0; i < 7; ++i) buffer.push_back(i);
+
+    buffer.erase(1, 2);
+    EXPECT_EQ(toVector(buffer), (std::vector<int>{2, 5, 6}));
+
+    buffer.erase(2, 5);
+    EXPECT_EQ(toVector(buffer), (std::vector<int>{2, 5}));
+
+    buffer.erase(0, 1);
+    EXPECT_EQ(toVector(buffer), (std::vector<int>{5}));
+}
+
+TEST(TestGtRingBuffer, setCapacity)
+{
+    RingBuffer<QString> buffer(3);
+    buffer.push_back(QStringLiteral("a"));
+    buffer.push_back(QStringLiteral("b"));
+    buffer.push_back(QStringLiteral("c"));
+    buffer.push_back(QStringLiteral("d"));
+
+    // the newest entries are kept
+    buffer.setCapacity(2);
+    ASSERT_EQ(buffer.size(), 2u);
+    EXPECT_EQ(buffer[0], QStringLiteral("c"));
+    EXPECT_EQ(buffer[1], QStringLiteral("d"));
+
+    buffer.setCapacity(4);
+    buffer.push_back(QStringLiteral("e"));
+    ASSERT_EQ(buffer.size(), 3u);
+    EXPECT_EQ(buffer[2], QStringLiteral("e"));
+
+    buffer.clear();
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(buffer.capacity(), 4u);
+}
@@ -0,0 +1,113 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "internal/gt_startupprofiler.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
+
+using gt::detail::StartupProfiler;
+
+TEST(TestGtStartupProfiler, nestedPhases)
+{
+    StartupProfiler profiler;
+    profiler.setEnabled(true);
+
+    {
+        auto outer = profiler.phase(QStringLiteral("load modules"));
+        {
+            auto inner = profiler.phase(QStringLiteral("load A"),
+                                        StartupProfiler::S_MODULE);
+        }
+    }
+
+    auto events = profiler.events();
+    ASSERT_EQ(events.size(), 2u);
+
+    // phases are recorded once they have ended
+    EXPECT_EQ(events[0].name, QStringLiteral("load A"));
+    EXPECT_EQ(events[0].category, StartupProfiler::S_MODULE);
+    EXPECT_EQ(events[0].depth, 1);
+
+    EXPECT_EQ(events[1].name, QStringLiteral("load modules"));
+    EXPECT_EQ(events[1].category, StartupProfiler::S_STARTUP);
+    EXPECT_EQ(events[1].depth, 0);
+
+    EXPECT_GE(events[0].start, events[1].start);
+    EXPECT_LE(events[0].duration, events[1].duration);
+
+    QString summary = profiler.summary();
+    EXPECT_TRUE(summary.startsWith(QStringLiteral("load modules [startup]")));
+    EXPECT_TRUE(summary.contains(QStringLiteral("\n  load A [module]")));
+}
+
+TEST(TestGtStartupProfiler, endPhase)
+{
+    StartupProfiler profiler;
+    profiler.setEnabled(true);
+
+    auto phase = profiler.phase(QStringLiteral("main window"));
+    phase.end();
+    phase.end();
+
+    EXPECT_EQ(profiler.events().size(), 1u);
+}
+
+TEST(TestGtStartupProfiler, disabled)
+{
+    StartupProfiler profiler;
+    profiler.setEnabled(false);
+
+    {
+        auto phase = profiler.phase(QStringLiteral("init"));
+    }
+
+    EXPECT_TRUE(profiler.events().empty());
+
+    // no phases are recorded after the startup
+    profiler.setEnabled(true);
+    profiler.finish();
+
+    {
+        auto phase = profiler.phase(QStringLiteral("open project"));
+    }
+
+    EXPECT_TRUE(profiler.events().empty());
+}
+
+TEST(TestGtStartupProfiler, chromeTrace)
+{
+    StartupProfiler profiler;
+    profiler.setEnabled(true);
+
+    {
+        auto phase = profiler.phase(QStringLiteral("init"));
+    }
+
+    QJsonParseError error;
+    auto doc = QJsonDocument::fromJson(profiler.toChromeTrace(), &error);
+    ASSERT_EQ(error.error, QJsonParseError::NoError);
+
+    QJsonArray events = doc.object().value(QStringLiteral("traceEvents"))
+                            .toArray();
+    ASSERT_EQ(events.size(), 1);
+
+    QJsonObject event = events.first().toObject();
+    EXPECT_EQ(event.value(QStringLiteral("name")).toString(),
+              QStringLiteral("init"));
+    EXPECT_EQ(event.value(QStringLiteral("ph")).toString(),
+              QStringLiteral("X"));
+    EXPECT_TRUE(event.contains(QStringLiteral("ts")));
+    EXPECT_TRUE(event.contains(QStringLiteral("dur")));
+
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    EXPECT_TRUE(profiler.writeChromeTrace(dir.filePath("trace.json")));
+}
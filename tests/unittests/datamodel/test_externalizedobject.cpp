@@ -23,6 +23,14 @@ TestExternalizedObjectData::TestExternalizedObjectData(TestExternalizedObject* b
 
 }
 
+TestExternalizedObjectData::TestExternalizedObjectData(
+        TestExternalizedObject* base,
+        GtExternalizedDataSelection const& selection) :
+    GtExternalizedObjectData{base, selection}
+{
+
+}
+
 const QVector<double>&
 TestExternalizedObjectData::values() const
 {
@@ -209,6 +217,31 @@ TestExternalizedObject::doExternalizeData(QVariant& /*metaData*/)
     return success;
 }
 
+bool
+TestExternalizedObject::canFetchPartially() const
+{
+    return true;
+}
+
+bool
+TestExternalizedObject::doFetchPartialData(
+        QVariant& metaData,
+        bool fetchInitialVersion,
+        GtExternalizedDataSelection const& selection)
+{
+    // simulates reading a hyperslab
+    if (!doFetchData(metaData, fetchInitialVersion))
+    {
+        return false;
+    }
+
+    int offset = static_cast<int>(selection.rowOffset);
+    int count = static_cast<int>(selection.rowCount);
+    m_values = m_values.mid(offset, count);
+    m_params = m_params.mid(offset, count);
+    return true;
+}
+
 void
 TestExternalizedObject::doClearExternalizedData()
 {
@@ -27,6 +27,9 @@ public:
 
     explicit TestExternalizedObjectData(TestExternalizedObject* base);
 
+    TestExternalizedObjectData(TestExternalizedObject* base,
+                               GtExternalizedDataSelection const& selection);
+
     const QVector<double>& values() const;
 
     void setValues(const QVector<double>& values) &;
@@ -108,6 +111,22 @@ protected:
      */
     bool doExternalizeData(QVariant& metaData) override;
 
+    /**
+     * @brief partial fetching is supported
+     * @return true
+     */
+    bool canFetchPartially() const override;
+
+    /**
+     * @brief fetches the selected rows of the data.
+     * @param metaData meta data
+     * @param selection selection to fetch
+     * @return success
+     */
+    bool doFetchPartialData(QVariant& metaData, bool fetchInitialVersion,
+                            GtExternalizedDataSelection const& selection
+                            ) override;
+
     /**
      * @brief clears intData.
      */
@@ -370,6 +370,166 @@ TEST_F(TestGtExternalizedObject, hasModifiedData)
     }
 }
 
+/// A selection of the data can be fetched. The partial data is cleared once
+/// it is no longer accessed
+TEST_F(TestGtExternalizedObject, fetchPartially)
+{
+    using Selection = GtExternalizedDataSelection;
+
+    { // access data
+        auto data = obj->fetchData();
+        data.setValues(m_values);
+    }
+
+    EXPECT_TRUE(obj->externalize());
+    ASSERT_FALSE(obj->isFetched());
+
+    {
+        auto part = obj->fetchData(Selection::rows(2, 3));
+        ASSERT_TRUE(part.isValid());
+
+        EXPECT_FALSE(obj->isFetched());
+        EXPECT_TRUE(obj->isPartiallyFetched());
+        EXPECT_EQ(obj->refCount(), 0);
+        EXPECT_EQ(obj->partialRefCount(), 1);
+        EXPECT_EQ(part.selection(), Selection::rows(2, 3));
+        EXPECT_EQ(part.values(), m_values.mid(2, 3));
+
+        { // a contained selection reuses the fetched data
+            auto part2 = obj->fetchData(Selection::rows(3, 1));
+            EXPECT_EQ(obj->partialRefCount(), 2);
+            EXPECT_EQ(part2.selection(), Selection::rows(2, 3));
+        }
+
+        { // a selection accessed by others is not replaced
+            auto part2 = obj->fetchData(Selection::rows(3, 1));
+
+            // otherwise the whole data is fetched
+            auto part3 = obj->fetchData(Selection::rows(6, 2));
+            ASSERT_TRUE(part3.isValid());
+            EXPECT_TRUE(obj->isFetched());
+            EXPECT_FALSE(obj->isPartiallyFetched());
+            EXPECT_EQ(obj->refCount(), 1);
+            EXPECT_EQ(obj->partialRefCount(), 2);
+            EXPECT_TRUE(part3.selection().isFull());
+            EXPECT_EQ(part3.values(), m_values);
+
+            // the other accessors see the whole data
+            EXPECT_TRUE(part2.isValid());
+            EXPECT_TRUE(part2.selection().isFull());
+        }
+
+        EXPECT_EQ(obj->refCount(), 0);
+        EXPECT_EQ(obj->partialRefCount(), 1);
+        EXPECT_TRUE(obj->isFetched());
+        EXPECT_TRUE(part.selection().isFull());
+        EXPECT_EQ(part.values(), m_values);
+
+        { // accessing the whole data reuses the fetched data
+            auto data = obj->fetchData();
+            EXPECT_TRUE(obj->isFetched());
+            EXPECT_FALSE(obj->isPartiallyFetched());
+            EXPECT_EQ(data.values(), m_values);
+
+            EXPECT_TRUE(part.isValid());
+            EXPECT_TRUE(part.selection().isFull());
+        }
+
+        // data is still accessed partially
+        EXPECT_EQ(obj->refCount(), 0);
+        EXPECT_TRUE(obj->isFetched());
+    }
+
+    EXPECT_EQ(obj->partialRefCount(), 0);
+    EXPECT_FALSE(obj->isFetched());
+    EXPECT_FALSE(obj->isPartiallyFetched());
+    EXPECT_TRUE(isDataExternalized());
+}
+
+/// Calculating the hash of the externalized data must not modify the object,
+/// as it may be calculated concurrently
+TEST_F(TestGtExternalizedObject, calcExtHashWithoutSideEffects)
+{
+    auto data = obj->fetchData();
+    data.setValues(m_values);
+
+    int changes = 0;
+    auto connection = QObject::connect(
+        obj.get(), qOverload<GtObject*>(&GtObject::dataChanged),
+        [&changes](GtObject*){ ++changes; });
+
+    QString hash = obj->calcExtHash();
+
+    QObject::disconnect(connection);
+
+    EXPECT_FALSE(hash.isEmpty());
+    EXPECT_EQ(changes, 0);
+    EXPECT_TRUE(obj->isFetched());
+
+    // member properties do not count towards the hash
+    EXPECT_TRUE(obj->externalize());
+    EXPECT_EQ(obj->extHash(), hash);
+    EXPECT_EQ(obj->calcExtHash(), hash);
+}
+
+/// The hashes of externalized data stored in existing projects remain valid
+/// independent of the default hash algorithm
+TEST_F(TestGtExternalizedObject, calcExtHashUsesFixedAlgorithm)
+{
+    auto data = obj->fetchData();
+    data.setValues(m_values);
+
+    gt::HashAlgorithm const algorithm = GtObject::defaultHashAlgorithm();
+
+    GtObject::setDefaultHashAlgorithm(gt::HashAlgorithm::Fast);
+    QString hash = obj->calcExtHash();
+
+    GtObject::setDefaultHashAlgorithm(gt::HashAlgorithm::Sha256);
+    EXPECT_EQ(obj->calcExtHash(), hash);
+
+    GtObject::setDefaultHashAlgorithm(algorithm);
+
+    // SHA-256 (32 bytes)
+    EXPECT_EQ(hash.size(), 64);
+}
+
+/// Multiple objects can be externalized within one session. The hashes are
+/// calculated upfront
+TEST_F(TestGtExternalizedObject, externalizeBatch)
+{
+    GtObject root;
+
+    QList<GtExternalizedObject*> objects;
+    for (int i = 0; i < 4; ++i)
+    {
+        auto* child = new TestExternalizedObject;
+        child->setObjectName(QStringLiteral("Child_%1").arg(i));
+        // nest the last object, thus its parent is hashed serially
+        GtObject* parent = i == 3 ? objects.front() : &root;
+        ASSERT_TRUE(parent->appendChild(child));
+
+        auto data = child->fetchData();
+        data.setValues(m_values);
+
+        objects.append(child);
+    }
+
+    EXPECT_FALSE(gtExternalizationManager->isSessionActive());
+    EXPECT_TRUE(gtExternalizationManager->externalize(objects));
+    EXPECT_FALSE(gtExternalizationManager->isSessionActive());
+
+    for (auto* o : qAsConst(objects))
+    {
+        auto* child = static_cast<TestExternalizedObject*>(o);
+        EXPECT_FALSE(child->isFetched());
+        EXPECT_TRUE(child->internalValues().isEmpty());
+        EXPECT_FALSE(child->extHash().isEmpty());
+
+        auto data = child->fetchData();
+        EXPECT_EQ(data.values(), m_values);
+    }
+}
+
 /// Once an externalized object was externalized and thus had written
 /// modified data to disk it should no longer fetch its initial version but the
 /// modified one
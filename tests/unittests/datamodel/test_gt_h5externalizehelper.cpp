@@ -14,9 +14,12 @@
 
 #include "gt_h5externalizehelper.h"
 #include "gt_externalizationmanager.h"
+#include "gt_h5externalizationinterface.h"
 
 #include "test_externalizedobject.h"
 
+#include <QFileInfo>
+
 /// This is a test fixture that does a init for each test
 struct TestGtH5ExternalizeHelper : public ::testing::Test
 {
@@ -28,6 +31,11 @@ struct TestGtH5ExternalizeHelper : public ::testing::Test
         obj->setObjectName("TestObject");
     }
 
+    void TearDown() override
+    {
+        gtExternalizationManager->setStorageLayout({});
+    }
+
     std::unique_ptr<TestExternalizedObject> obj{};
 };
 
@@ -106,4 +114,150 @@ TEST_F(TestGtH5ExternalizeHelper, overwriteDataSet_issue_453)
     }
 }
 
+/// Chunked datasets are extended instead of recreated
+TEST_F(TestGtH5ExternalizeHelper, overwriteDataSet_chunked)
+{
+    GtExternalizationManager::StorageLayout layout;
+    layout.chunked = true;
+    layout.compressionLevel = 6;
+    layout.shuffle = true;
+    gtExternalizationManager->setStorageLayout(layout);
+
+    GtH5ExternalizeHelper helper{*obj};
+
+    try
+    {
+        GenH5::DataType dtype = GenH5::dataType<double>();
+        QVariant ref;
+
+        {
+            auto dset = helper.overwriteDataSet(dtype,
+                                                GenH5::DataSpace::linear(100),
+                                                ref);
+            EXPECT_EQ(dset.dataSpace().dimensions().at(0), 100);
+        }
+
+        QVariant oldRef = ref;
+
+        // dataset is extended
+        {
+            auto dset = helper.overwriteDataSet(dtype,
+                                                GenH5::DataSpace::linear(300),
+                                                ref);
+            EXPECT_EQ(dset.dataSpace().dimensions().at(0), 300);
+            EXPECT_EQ(ref, oldRef);
+        }
+
+        // and shrinked
+        {
+            auto dset = helper.overwriteDataSet(dtype,
+                                                GenH5::DataSpace::linear(10),
+                                                ref);
+            EXPECT_EQ(dset.dataSpace().dimensions().at(0), 10);
+            EXPECT_EQ(ref, oldRef);
+        }
+    }
+    catch (GenH5::Exception const& e)
+    {
+        gtError() << "EXPECTION:" << e.what();
+        ASSERT_NO_THROW(throw e);
+    }
+}
+
+/// Data is written with all storage layouts, compression reduces the size
+TEST_F(TestGtH5ExternalizeHelper, storageLayouts)
+{
+    constexpr int n = 10000;
+
+    QVector<double> values(n);
+    for (int i = 0; i < n; ++i)
+    {
+        values[i] = 0.5 * (i % 100);
+    }
+
+    // returns the number of bytes the file grew
+    const auto write = [&](GtExternalizationManager::StorageLayout layout) {
+        gtExternalizationManager->setStorageLayout(layout);
+
+        TestExternalizedObject object;
+        GtH5ExternalizeHelper helper{object};
+
+        QString filePath =
+            gtH5ExternalizationInterface->projectHDF5FilePath(false);
+        qint64 size = QFileInfo(filePath).size();
+
+        QVariant ref;
+        EXPECT_TRUE(helper.write(GenH5::Data<double>{values}, ref));
+        EXPECT_TRUE(ref.isValid());
+
+        return QFileInfo(filePath).size() - size;
+    };
+
+    try
+    {
+        GtExternalizationManager::StorageLayout contiguous;
+
+        GtExternalizationManager::StorageLayout chunked;
+        chunked.chunked = true;
+
+        GtExternalizationManager::StorageLayout compressed;
+        compressed.chunked = true;
+        compressed.compressionLevel = 4;
+        compressed.shuffle = true;
+
+        qint64 contiguousSize = write(contiguous);
+        write(chunked);
+        qint64 compressedSize = write(compressed);
+
+        EXPECT_LT(compressedSize, contiguousSize);
+    }
+    catch (GenH5::Exception const& e)
+    {
+        gtError() << "EXPECTION:" << e.what();
+        ASSERT_NO_THROW(throw e);
+    }
+}
+
+/// Only the hyperslab of the selection is read, the selection is clamped to
+/// the extent of the dataset
+TEST_F(TestGtH5ExternalizeHelper, readSelection)
+{
+    using Selection = GtExternalizedDataSelection;
+
+    QVector<double> values(100);
+    for (int i = 0; i < values.size(); ++i)
+    {
+        values[i] = 0.5 * i;
+    }
+
+    GtH5ExternalizeHelper helper{*obj};
+
+    try
+    {
+        QVariant ref;
+        ASSERT_TRUE(helper.write(GenH5::Data<double>{values}, ref));
+
+        {
+            GenH5::Data<double> data;
+            ASSERT_TRUE(helper.read(data, ref, false, Selection::rows(10, 5)));
+            ASSERT_EQ(data.size(), 5);
+            EXPECT_EQ(data.value(0), values[10]);
+            EXPECT_EQ(data.value(4), values[14]);
+        }
+
+        // the selection is clamped to the extent
+        {
+            GenH5::Data<double> data;
+            ASSERT_TRUE(helper.read(data, ref, false, Selection::rows(95, 100)));
+            ASSERT_EQ(data.size(), 5);
+            EXPECT_EQ(data.value(4), values[99]);
+        }
+    }
+    catch (GenH5::Exception const& e)
+    {
+        gtError() << "EXPECTION:" << e.what();
+        ASSERT_NO_THROW(throw e);
+    }
+}
+
 #endif
@@ -469,3 +469,157 @@ TEST_F(TestGtObject, bug539)
     EXPECT_EQ(parent.findDirectChildren<TestObject*>().size(), 1);
     EXPECT_EQ(parent.findDirectChildren<TestSpecialGtObject*>().size(), 1);
 }
+
+TEST_F(TestGtObject, getObjectByUuid)
+{
+    auto* child1 = new GtObjectGroup(&obj);
+    auto* child2 = new GtObjectGroup(&obj);
+    auto* child3 = new GtObjectGroup(child1);
+
+    EXPECT_EQ(obj.getObjectByUuid(obj.uuid()), &obj);
+    EXPECT_EQ(obj.getObjectByUuid(child3->uuid()), child3);
+    EXPECT_EQ(child1->getObjectByUuid(child3->uuid()), child3);
+    // only children are found
+    EXPECT_EQ(child2->getObjectByUuid(child3->uuid()), nullptr);
+    EXPECT_EQ(child3->getObjectByUuid(obj.uuid()), nullptr);
+
+    // objects appended after the first lookup
+    auto* child4 = new GtObjectGroup(child2);
+    EXPECT_EQ(obj.getObjectByUuid(child4->uuid()), child4);
+
+    // uuid changes
+    QString oldUuid = child4->uuid();
+    child4->newUuid();
+    EXPECT_EQ(obj.getObjectByUuid(oldUuid), nullptr);
+    EXPECT_EQ(obj.getObjectByUuid(child4->uuid()), child4);
+
+    child4->setUuid(QStringLiteral("my_uuid"));
+    EXPECT_EQ(obj.getObjectByUuid(QStringLiteral("my_uuid")), child4);
+
+    // moving subtrees
+    child1->setParent(child2);
+    EXPECT_EQ(child2->getObjectByUuid(child3->uuid()), child3);
+    EXPECT_EQ(obj.getObjectByUuid(child3->uuid()), child3);
+
+    child1->disconnectFromParent();
+    EXPECT_EQ(obj.getObjectByUuid(child1->uuid()), nullptr);
+    EXPECT_EQ(obj.getObjectByUuid(child3->uuid()), nullptr);
+    EXPECT_EQ(child1->getObjectByUuid(child3->uuid()), child3);
+
+    obj.appendChild(child1);
+    EXPECT_EQ(obj.getObjectByUuid(child3->uuid()), child3);
+
+    // deleting objects
+    QString uuid3 = child3->uuid();
+    delete child1;
+    EXPECT_EQ(obj.getObjectByUuid(uuid3), nullptr);
+
+    QString uuid2 = child2->uuid();
+    delete child2;
+    EXPECT_EQ(obj.getObjectByUuid(uuid2), nullptr);
+    EXPECT_EQ(obj.getObjectByUuid(QStringLiteral("my_uuid")), nullptr);
+
+    // clones with identical uuids in the same tree
+    auto* a = new GtObjectGroup(&obj);
+    auto* b = new GtObjectGroup(&obj);
+    auto* clone = new GtObjectGroup(b);
+    clone->setUuid(a->uuid());
+    EXPECT_EQ(b->getObjectByUuid(a->uuid()), clone);
+    EXPECT_EQ(a->getObjectByUuid(a->uuid()), a);
+}
+
+TEST_F(TestGtObject, childAt)
+{
+    QList<QPointer<GtObject>> children;
+    for (int i = 0; i < 5; ++i)
+    {
+        children << new GtObjectGroup(&obj);
+    }
+
+    ASSERT_EQ(obj.childCount<GtObject*>(), 5);
+    EXPECT_EQ(obj.childAt(-1), nullptr);
+    EXPECT_EQ(obj.childAt(5), nullptr);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(obj.childAt(i), children.at(i));
+        EXPECT_EQ(children.at(i)->childNumber(), i);
+    }
+
+    // removing a child in the middle
+    delete children.at(1);
+    children.removeAt(1);
+
+    // moving a child to the end
+    children.at(0)->setParent(nullptr);
+    obj.appendChild(children.at(0));
+    children.append(children.takeFirst());
+
+    // inserting a child
+    auto* inserted = new GtObjectGroup;
+    obj.insertChild(1, inserted);
+    children.insert(1, inserted);
+
+    // non GtObject children are ignored
+    new QObject(&obj);
+
+    QList<GtObject*> directChildren = obj.findDirectChildren();
+    ASSERT_EQ(directChildren.size(), children.size());
+    ASSERT_EQ(obj.childCount<GtObject*>(), children.size());
+
+    for (int i = 0; i < children.size(); ++i)
+    {
+        EXPECT_EQ(directChildren.at(i), children.at(i));
+        EXPECT_EQ(obj.childAt(i), children.at(i));
+        EXPECT_EQ(children.at(i)->childNumber(), i);
+    }
+}
+
+TEST_F(TestGtObject, calcHash)
+{
+    auto* child = new GtObjectGroup;
+    child->setObjectName("Child");
+    obj.appendChild(child);
+
+    auto* special = new TestSpecialGtObject;
+    special->setObjectName("Special");
+    child->appendChild(special);
+
+    QString hash = obj.calcHash();
+    EXPECT_FALSE(hash.isEmpty());
+
+    // cached hash is stable
+    EXPECT_EQ(obj.calcHash(), hash);
+
+    // hash matches the hash of the memento
+    GtObjectMemento memento = obj.toMemento();
+    memento.calculateHashes();
+    EXPECT_EQ(memento.fullHash().toHex(), hash);
+
+    // sha256 is optional
+    QString sha = obj.calcHash(gt::HashAlgorithm::Sha256);
+    EXPECT_NE(sha, hash);
+    EXPECT_EQ(sha.size(), 64);
+    EXPECT_EQ(obj.calcHash(gt::HashAlgorithm::Fast), hash);
+
+    // changes of a child are propagated to the parents
+    child->setObjectName("Renamed");
+    QString renamedHash = obj.calcHash();
+    EXPECT_NE(renamedHash, hash);
+
+    child->setObjectName("Child");
+    EXPECT_EQ(obj.calcHash(), hash);
+
+    // changes of properties of nested objects
+    special->setDouble(42.0);
+    QString changedHash = obj.calcHash();
+    EXPECT_NE(changedHash, hash);
+
+    // adding and removing children
+    auto* newChild = new GtObjectGroup;
+    obj.appendChild(newChild);
+    EXPECT_NE(obj.calcHash(), changedHash);
+
+    delete newChild;
+    EXPECT_EQ(obj.calcHash(), changedHash);
+}
@@ -16,6 +16,7 @@
 #include "gt_object.h"
 #include "test_gt_object.h"
 #include "gt_objectfactory.h"
+#include "gt_objectgroup.h"
 
 
 /// This is a test fixture that does a init for each test
@@ -1352,3 +1353,146 @@ TEST_F(TestGtObjectMementoDiff, childIndexChanges)
     ASSERT_STREQ(childs[2]->objectName().toStdString().c_str(), "O3");
 }
 
+
+/// Benchmark of diffs of containers with many inserted and removed children
+TEST_F(TestGtObjectMementoDiff, largeContainerIndexChanges)
+{
+    constexpr int nChildren = 10000;
+
+    if (!gtObjectFactory->knownClass("GtObjectGroup"))
+    {
+        gtObjectFactory->registerClass(GtObjectGroup::staticMetaObject);
+    }
+
+    GtObjectGroup container;
+    container.setFactory(gtObjectFactory);
+
+    for (int i = 0; i < nChildren; ++i)
+    {
+        auto* child = new GtObjectGroup;
+        child->setObjectName(QString::number(i));
+        container.appendChild(child);
+    }
+
+    GtObjectMemento mem1 = container.toMemento();
+    QString hash1 = container.calcHash();
+
+    // remove every 10th child and insert a new child at every 7th position
+    GtObjectList children = container.findDirectChildren();
+    for (int i = 0; i < nChildren; i += 10)
+    {
+        delete children.at(i);
+    }
+
+    for (int i = 0; i < nChildren; i += 7)
+    {
+        auto* child = new GtObjectGroup;
+        child->setObjectName(QStringLiteral("new_%1").arg(i));
+        ASSERT_TRUE(container.insertChild(i, child));
+    }
+
+    GtObjectMemento mem2 = container.toMemento();
+    QString hash2 = container.calcHash();
+
+    GtObjectMementoDiff diff(mem1, mem2);
+
+    ASSERT_FALSE(diff.isNull());
+
+    // inserting and removing children is not a reordering
+    QDomElement root = diff.documentElement();
+    EXPECT_TRUE(root.firstChildElement("diff-index-changed").isNull());
+
+    ASSERT_TRUE(container.revertDiff(diff));
+    EXPECT_EQ(container.calcHash(), hash1);
+
+    ASSERT_TRUE(container.applyDiff(diff));
+    EXPECT_EQ(container.calcHash(), hash2);
+
+    // swapping two children
+    GtObject* toMove = container.childAt(nChildren / 2);
+    toMove->setParent(nullptr);
+    ASSERT_TRUE(container.insertChild(nChildren / 2 + 1, toMove));
+
+    GtObjectMemento mem3 = container.toMemento();
+
+    GtObjectMementoDiff moveDiff(mem2, mem3);
+
+    ASSERT_FALSE(moveDiff.isNull());
+
+    int nIndexChanges = 0;
+    for (QDomElement e = moveDiff.documentElement()
+             .firstChildElement("diff-index-changed");
+         !e.isNull(); e = e.nextSiblingElement("diff-index-changed"))
+    {
+        ++nIndexChanges;
+    }
+    EXPECT_EQ(nIndexChanges, 2);
+
+    GtObjectMemento moved = mem2;
+    GtObject* restored = moved.restore(gtObjectFactory);
+    ASSERT_TRUE(restored);
+    ASSERT_TRUE(restored->applyDiff(moveDiff));
+    EXPECT_EQ(restored->calcHash(), container.calcHash());
+
+    delete restored;
+}
+
+/// Large sibling subtrees are hashed and diffed concurrently
+TEST_F(TestGtObjectMementoDiff, largeSubtreesConcurrent)
+{
+    if (!gtObjectFactory->knownClass("GtObjectGroup"))
+    {
+        gtObjectFactory->registerClass(GtObjectGroup::staticMetaObject);
+    }
+
+    GtObjectGroup root;
+    root.setFactory(gtObjectFactory);
+
+    for (int i = 0; i < 20; ++i)
+    {
+        auto* child = new GtObjectGroup;
+        child->setObjectName(QStringLiteral("child_%1").arg(i));
+        root.appendChild(child);
+
+        for (int j = 0; j < 50; ++j)
+        {
+            auto* grandChild = new GtObjectGroup;
+            grandChild->setObjectName(QStringLiteral("grand_child_%1").arg(j));
+            child->appendChild(grandChild);
+        }
+    }
+
+    GtObjectMemento mem1 = root.toMemento();
+    mem1.calculateHashes();
+    EXPECT_EQ(mem1.fullHash().toHex(), root.calcHash());
+
+    // modify every other child subtree
+    GtObjectList children = root.findDirectChildren();
+    for (int i = 0; i < children.size(); i += 2)
+    {
+        children.at(i)->childAt(i)->setObjectName("modified");
+        delete children.at(i)->childAt(0);
+    }
+
+    GtObjectMemento mem2 = root.toMemento();
+    mem2.calculateHashes();
+    EXPECT_EQ(mem2.fullHash().toHex(), root.calcHash());
+
+    GtObjectMementoDiff diff(mem1, mem2);
+    ASSERT_FALSE(diff.isNull());
+
+    // diffs are deterministic
+    EXPECT_EQ(GtObjectMementoDiff(mem1, mem2).toByteArray(),
+              diff.toByteArray());
+
+    // one diff step for each modified child and renamed grand child
+    EXPECT_EQ(diff.numberOfDiffSteps(), 19);
+
+    QString hash2 = root.calcHash();
+
+    ASSERT_TRUE(root.revertDiff(diff));
+    EXPECT_EQ(root.calcHash(), mem1.fullHash().toHex());
+
+    ASSERT_TRUE(root.applyDiff(diff));
+    EXPECT_EQ(root.calcHash(), hash2);
+}
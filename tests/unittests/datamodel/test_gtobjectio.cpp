@@ -12,6 +12,14 @@
 
 #include "gt_objectio.h"
 #include "gt_objectmemento.h"
+#include "gt_objectmementodiff.h"
+#include "gt_xmlutilities.h"
+#include "gt_objectfactory.h"
+
+#include "test_gt_object.h"
+
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
 
 #include <iostream>
 
@@ -94,3 +102,143 @@ TEST_F(TestGtObjectIO_Read, invalidQVariant)
     EXPECT_FALSE(variant.isValid());
 }
 
+TEST(TestGtObjectIO_Stream, writeEqualsDomOutput)
+{
+    TestSpecialGtObject obj;
+    obj.setDoubleVec({0.1, 0.2, 0.3});
+    obj.setLabel("a<b>&c");
+
+    auto* child = new TestObject;
+    child->addEnvironmentVar("PATH", "/usr/bin");
+    obj.appendChild(child);
+
+    auto* disabled = new TestSpecialGtObject;
+    disabled->findProperty("intProp")->setActive(false);
+    obj.appendChild(disabled);
+
+    GtObjectMemento memento = obj.toMemento();
+
+    QString domXml;
+    QXmlStreamWriter domWriter(&domXml);
+    domWriter.setAutoFormatting(true);
+    ASSERT_TRUE(gt::xml::writeDomElementOrderedAttribute(
+                    memento.documentElement(), domWriter));
+
+    QString streamXml;
+    QXmlStreamWriter streamWriter(&streamXml);
+    streamWriter.setAutoFormatting(true);
+    memento.writeToStream(streamWriter);
+
+    EXPECT_FALSE(streamXml.isEmpty());
+    EXPECT_EQ(domXml.toStdString(), streamXml.toStdString());
+}
+
+TEST(TestGtObjectIO_Stream, readEqualsDomInput)
+{
+    TestSpecialGtObject obj;
+    obj.setDoubleVec({0.1, 0.2, 0.3});
+
+    auto* child = new TestObject;
+    child->addEnvironmentVar("PATH", "/usr/bin");
+    obj.appendChild(child);
+
+    QByteArray xml = obj.toMemento().toByteArray();
+
+    GtObjectMemento domMemento(xml);
+
+    QXmlStreamReader reader(xml);
+    ASSERT_TRUE(reader.readNextStartElement());
+
+    GtObjectMemento streamMemento(reader);
+    EXPECT_FALSE(reader.hasError());
+    EXPECT_TRUE(reader.isEndElement());
+
+    ASSERT_FALSE(streamMemento.isNull());
+    ASSERT_EQ(streamMemento.childObjects.size(), 1);
+    ASSERT_EQ(streamMemento.childObjects.at(0).propertyContainers.size(), 1);
+
+    domMemento.calculateHashes();
+    streamMemento.calculateHashes();
+    EXPECT_EQ(domMemento.fullHash(), streamMemento.fullHash());
+}
+
+TEST(TestGtObjectIO_Binary, mementoRoundTrip)
+{
+    TestSpecialGtObject obj;
+    obj.setDoubleVec({0.1, 0.2, 1.0 / 3.0});
+    obj.setLabel("a<b>&c");
+
+    auto* child = new TestObject;
+    child->addEnvironmentVar("PATH", "/usr/bin");
+    obj.appendChild(child);
+
+    auto* disabled = new TestSpecialGtObject;
+    disabled->findProperty("intProp")->setActive(false);
+    obj.appendChild(disabled);
+
+    GtObjectMemento memento = obj.toMemento();
+
+    QByteArray binary = memento.toBinary();
+    EXPECT_LT(binary.size(), memento.toByteArray().size());
+
+    GtObjectMemento restored(binary);
+    ASSERT_FALSE(restored.isNull());
+    ASSERT_EQ(restored.childObjects.size(), 2);
+    ASSERT_EQ(restored.childObjects.at(0).propertyContainers.size(), 1);
+
+    memento.calculateHashes();
+    restored.calculateHashes();
+    EXPECT_EQ(memento.fullHash(), restored.fullHash());
+
+    // double arrays are stored without loss of precision
+    auto* dVec = GtObjectMemento::findPropertyByName(restored.properties,
+                                                     "dVec");
+    ASSERT_TRUE(dVec != nullptr);
+    EXPECT_EQ(dVec->data().value<QVector<double>>(), obj.getDoubleVec());
+
+    EXPECT_EQ(restored.toByteArray(), memento.toByteArray());
+}
+
+TEST(TestGtObjectIO_Binary, invalidMementoData)
+{
+    TestSpecialGtObject obj;
+    QByteArray binary = obj.toMemento().toBinary();
+
+    // truncated data
+    EXPECT_TRUE(GtObjectMemento(binary.left(binary.size() / 2)).isNull());
+
+    // unsupported version
+    QByteArray newer = binary;
+    newer[4] = char(0xff);
+    newer[5] = char(0xff);
+    EXPECT_TRUE(GtObjectMemento(newer).isNull());
+}
+
+TEST(TestGtObjectIO_Binary, diffRoundTrip)
+{
+    TestSpecialGtObject obj;
+    obj.setLabel("a<b>&c");
+    GtObjectMemento before = obj.toMemento();
+
+    obj.setDouble(42.0);
+    obj.setDoubleVec({0.1, 0.2});
+    obj.appendChild(new TestSpecialGtObject);
+    GtObjectMemento after = obj.toMemento();
+
+    GtObjectMementoDiff diff(before, after);
+    ASSERT_FALSE(diff.isNull());
+
+    GtObjectMementoDiff restored(diff.toBinary());
+    ASSERT_FALSE(restored.isNull());
+    EXPECT_EQ(restored.numberOfDiffSteps(), diff.numberOfDiffSteps());
+
+    if (!gtObjectFactory->knownClass("TestSpecialGtObject"))
+    {
+        gtObjectFactory->registerClass(TestSpecialGtObject::staticMetaObject);
+    }
+
+    std::unique_ptr<GtObject> target(before.restore(gtObjectFactory));
+    ASSERT_TRUE(target != nullptr);
+    ASSERT_TRUE(target->applyDiff(restored));
+    EXPECT_EQ(target->calcHash(), obj.calcHash());
+}
@@ -0,0 +1,247 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "gt_processrunnerpool.h"
+#include "gt_processrunnerglobals.h"
+#include "gt_eventloop.h"
+
+#include <QFile>
+#include <QPointer>
+#include <QProcess>
+#include <QTemporaryDir>
+
+namespace
+{
+
+/// timeout for process runners to start up or exit
+const int S_TIMEOUT = 5000;
+
+/// Pool starting shell processes, which only print the ready message
+class TestProcessRunnerPool : public GtProcessRunnerPool
+{
+public:
+
+    /// whether the process runners ignore terminate requests (i.e. as
+    /// console applications on Windows)
+    bool ignoreTerminate{false};
+
+    /// whether the process runners exit right after startup (i.e. as if
+    /// the idle timeout elapsed)
+    bool exitWhenIdle{false};
+
+    /// whether the process runners print a message periodically
+    bool heartbeat{false};
+
+    /// processes started
+    QList<QPointer<QProcess>> processes;
+
+protected:
+
+    quint16 reservePort(QList<quint16> const& reserved) override
+    {
+        quint16 port = gt::process_runner::S_DEFAULT_PORT;
+        while (reserved.contains(port)) ++port;
+        return port;
+    }
+
+    QProcess* createProcess(quint16 /*port*/) override
+    {
+        QString script = QStringLiteral("echo '%1'; ")
+                             .arg(gt::process_runner::S_READY_MESSAGE);
+        if (exitWhenIdle)
+        {
+            script.append(QStringLiteral("sleep 0.2; exit 2"));
+        }
+        else if (heartbeat)
+        {
+            script.append(QStringLiteral(
+                "while true; do echo 'heartbeat'; sleep 0.05; done"));
+        }
+        else
+        {
+            script.append(QStringLiteral("exec sleep 60"));
+        }
+        if (ignoreTerminate)
+        {
+            script.prepend(QStringLiteral("trap '' TERM; "));
+        }
+
+        auto* process = new QProcess;
+        process->setProgram(QStringLiteral("/bin/sh"));
+        process->setArguments({QStringLiteral("-c"), script});
+
+        processes.append(process);
+        return process;
+    }
+};
+
+/// waits until the process exited. The process may be deleted already
+bool
+waitForExit(QPointer<QProcess> const& process)
+{
+    if (!process || process->state() == QProcess::NotRunning) return true;
+
+    GtEventLoop loop{S_TIMEOUT};
+    loop.connectSuccess(process.data(),
+                        qOverload<int, QProcess::ExitStatus>(
+                            &QProcess::finished));
+    loop.exec();
+
+    return !process || process->state() == QProcess::NotRunning;
+}
+
+} // namespace
+
+class TestGtProcessRunnerPool : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+#ifdef Q_OS_WIN
+        GTEST_SKIP() << "Requires a POSIX shell";
+#endif
+    }
+
+    TestProcessRunnerPool pool;
+};
+
+TEST_F(TestGtProcessRunnerPool, acquireRelease)
+{
+    pool.setSize(1);
+
+    quint16 port = pool.acquire(S_TIMEOUT);
+    ASSERT_NE(port, 0);
+    EXPECT_EQ(pool.activeRunners(), 1);
+
+    // the only process runner is busy
+    EXPECT_EQ(pool.acquire(100), 0);
+
+    pool.release(port, true);
+
+    // the process runner is reused
+    EXPECT_EQ(pool.acquire(S_TIMEOUT), port);
+    EXPECT_EQ(pool.processes.size(), 1);
+}
+
+/// An aborted process runner is replaced immediately and killed if it does
+/// not react on the terminate request
+TEST_F(TestGtProcessRunnerPool, abortReplacesRunner)
+{
+    pool.ignoreTerminate = true;
+    pool.setSize(1);
+
+    quint16 port = pool.acquire(S_TIMEOUT);
+    ASSERT_NE(port, 0);
+    ASSERT_EQ(pool.processes.size(), 1);
+
+    QPointer<QProcess> aborted = pool.processes.first();
+
+    pool.release(port, false);
+
+    // the terminating process runner does not count against the pool size
+    EXPECT_EQ(pool.activeRunners(), 1);
+    ASSERT_EQ(pool.processes.size(), 2);
+
+    quint16 replacement = pool.acquire(S_TIMEOUT);
+    EXPECT_NE(replacement, 0);
+    EXPECT_NE(replacement, port);
+
+    EXPECT_TRUE(waitForExit(aborted));
+
+    pool.release(replacement, true);
+}
+
+TEST_F(TestGtProcessRunnerPool, shrink)
+{
+    pool.setSize(2);
+    pool.warmUp();
+
+    ASSERT_EQ(pool.processes.size(), 2);
+    EXPECT_EQ(pool.activeRunners(), 2);
+
+    pool.setSize(1);
+    EXPECT_EQ(pool.activeRunners(), 1);
+
+    // no replacement is started
+    pool.warmUp();
+    EXPECT_EQ(pool.processes.size(), 2);
+
+    EXPECT_TRUE(waitForExit(pool.processes.first()));
+    EXPECT_EQ(pool.activeRunners(), 1);
+}
+
+/// Process runners that exited on their idle timeout are not replaced until
+/// the next acquire
+TEST_F(TestGtProcessRunnerPool, idleTimeout)
+{
+    pool.exitWhenIdle = true;
+    pool.setSize(1);
+    pool.warmUp();
+
+    ASSERT_EQ(pool.processes.size(), 1);
+    EXPECT_TRUE(waitForExit(pool.processes.first()));
+
+    EXPECT_EQ(pool.activeRunners(), 0);
+    EXPECT_EQ(pool.processes.size(), 1);
+
+    pool.exitWhenIdle = false;
+
+    quint16 port = pool.acquire(S_TIMEOUT);
+    EXPECT_NE(port, 0);
+    EXPECT_EQ(pool.processes.size(), 2);
+
+    pool.release(port, true);
+}
+
+/// Idle process runners started with a different environment are replaced
+TEST_F(TestGtProcessRunnerPool, environmentChanged)
+{
+    pool.setSize(1);
+
+    quint16 port = pool.acquire(S_TIMEOUT);
+    ASSERT_NE(port, 0);
+    pool.release(port, true);
+
+    qputenv("GT_TEST_PROCESS_RUNNER_POOL", "1");
+
+    quint16 replacement = pool.acquire(S_TIMEOUT);
+
+    qunsetenv("GT_TEST_PROCESS_RUNNER_POOL");
+
+    EXPECT_NE(replacement, 0);
+    EXPECT_NE(replacement, port);
+    EXPECT_EQ(pool.processes.size(), 2);
+
+    pool.release(replacement, true);
+}
+
+/// The output of a session is written to the log file of the session
+TEST_F(TestGtProcessRunnerPool, sessionLog)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    QString logFile = dir.filePath(QStringLiteral("process_runner.log"));
+
+    pool.heartbeat = true;
+    pool.setSize(1);
+
+    quint16 port = pool.acquire(S_TIMEOUT, logFile);
+    ASSERT_NE(port, 0);
+
+    // let the process runner print some output
+    GtEventLoop loop{200};
+    loop.exec();
+
+    pool.release(port, true);
+
+    QFile file{logFile};
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+    EXPECT_TRUE(file.readAll().contains("heartbeat"));
+}